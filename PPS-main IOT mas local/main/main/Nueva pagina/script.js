@@ -384,6 +384,14 @@ document.getElementById('vfo-freq-up-btn').addEventListener("click", () => envia
 document.getElementById('vfo-freq-down-btn').addEventListener("click", () => enviarComando({ accion: "vfo_command", sub_accion: "change_freq", direccion: "down" })); 
 document.getElementById('vfo-step-btn').addEventListener("click", () => enviarComando({ accion: "vfo_command", sub_accion: "set_step" })); 
 document.getElementById('vfo-band-btn').addEventListener("click", () => enviarComando({ accion: "vfo_command", sub_accion: "set_band" })); 
+document.getElementById('vfo-set-freq-btn').addEventListener("click", () => { 
+    const freqHz = parseInt(document.getElementById('vfo-freq-input').value); 
+    if (!isNaN(freqHz) && freqHz >= 10000 && freqHz <= 225000000) { 
+        enviarComando({ accion: "vfo_command", sub_accion: "set_freq", frecuencia_hz: freqHz }); 
+    } else { 
+        alert("Frecuencia para VFO debe estar entre 10,000 y 225,000,000 Hz."); 
+    } 
+}); 
 vfoRxTxBtn.addEventListener("click", () => { 
     const nuevoModo = (currentVfoMode === 'RX') ? 'tx' : 'rx'; 
     enviarComando({ accion: "vfo_command", sub_accion: "set_rxtx", modo: nuevoModo }); 
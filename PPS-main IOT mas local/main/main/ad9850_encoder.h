@@ -0,0 +1,87 @@
+#ifndef AD9850_ENCODER_H
+#define AD9850_ENCODER_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+// ==========================================================
+// CODIFICADOR DE FORMA DE ONDA SERIAL DEL AD9850
+// ==========================================================
+// Este módulo no depende de Arduino: solo traduce una palabra de
+// sintonía a la secuencia de niveles de los pines DATA / W_CLK / FQ_UD
+// que genera send_frequency(). Así puede compilarse y verificarse en
+// el PC comparando el tren de bits contra el protocolo serial.
+//
+// Cada muestra es un byte cuyos bits representan el nivel de un pin:
+//   bit0 = DATA, bit1 = W_CLK, bit2 = FQ_UD
+// Por cada bit de datos se emiten 2 muestras (DATA con W_CLK bajo y
+// luego W_CLK alto: el AD9850 captura en el flanco de subida).
+// Tras los 40 bits (32 de frecuencia LSB primero + 8 de control) se
+// emite el pulso de FQ_UD (alto, bajo).
+
+#define AD9850_SAMPLE_DATA   0x01
+#define AD9850_SAMPLE_W_CLK  0x02
+#define AD9850_SAMPLE_FQ_UD  0x04
+
+#define AD9850_WORD_BITS         40
+#define AD9850_SAMPLES_PER_WORD  (AD9850_WORD_BITS * 2 + 2)
+
+/**
+ * @brief Calcula la palabra de sintonía: (freq * 2^32) / clk.
+ * Usa aritmética entera de 64 bits (sin redondeo de double).
+ */
+inline uint32_t ad9850_tuning_word(uint32_t frequency_hz, uint32_t clk_hz) {
+  return (uint32_t)(((uint64_t)frequency_hz << 32) / clk_hz);
+}
+
+/**
+ * @brief Codifica una palabra de 40 bits en AD9850_SAMPLES_PER_WORD muestras.
+ * @param tuning_word Palabra de sintonía de 32 bits.
+ * @param control Byte de control (0x00 = fase 0, power ON).
+ * @param out Buffer de al menos AD9850_SAMPLES_PER_WORD bytes.
+ * @return Cantidad de muestras escritas.
+ */
+inline size_t ad9850_encode_word(uint32_t tuning_word, uint8_t control, uint8_t* out) {
+  uint64_t bits = (uint64_t)tuning_word | ((uint64_t)control << 32);
+  size_t n = 0;
+  for (int i = 0; i < AD9850_WORD_BITS; i++, bits >>= 1) {
+    uint8_t data = (uint8_t)(bits & 0x01) ? AD9850_SAMPLE_DATA : 0;
+    out[n++] = data;                          // DATA estable, W_CLK bajo
+    out[n++] = data | AD9850_SAMPLE_W_CLK;    // Flanco de subida de W_CLK
+  }
+  out[n++] = AD9850_SAMPLE_FQ_UD;             // Latch
+  out[n++] = 0;                               // Todas las líneas en bajo
+  return n;
+}
+
+/**
+ * @brief Reconstruye la palabra que el AD9850 capturaría a partir de un
+ * tren de muestras (flancos de subida de W_CLK). Útil para verificar el
+ * codificador fuera del hardware.
+ * @return true si se capturaron exactamente 40 bits y hubo pulso FQ_UD al final.
+ */
+inline bool ad9850_decode_word(const uint8_t* samples, size_t count,
+                               uint32_t* tuning_word, uint8_t* control) {
+  uint64_t bits = 0;
+  int captured = 0;
+  bool latched = false;
+  uint8_t prev = 0;
+  for (size_t i = 0; i < count; i++) {
+    uint8_t s = samples[i];
+    if ((s & AD9850_SAMPLE_W_CLK) && !(prev & AD9850_SAMPLE_W_CLK)) {
+      if (captured < AD9850_WORD_BITS && (s & AD9850_SAMPLE_DATA)) {
+        bits |= (uint64_t)1 << captured;
+      }
+      captured++;
+    }
+    if ((s & AD9850_SAMPLE_FQ_UD) && !(prev & AD9850_SAMPLE_FQ_UD)) {
+      latched = (captured == AD9850_WORD_BITS);
+    }
+    prev = s;
+  }
+  *tuning_word = (uint32_t)bits;
+  *control = (uint8_t)(bits >> 32);
+  return latched;
+}
+
+#endif // AD9850_ENCODER_H
@@ -2,9 +2,14 @@
 
 #include <WebSocketsServer.h>
 #include <Arduino.h> 
+#include <soc/gpio_struct.h>
 #include "ad9850_handler.h"
+#include "ad9850_encoder.h"
 #include "display_handler.h"
+#include "freq_format.h"
 #include "config.h"
+#include "main_interface.h"
+#include "latency_metrics.h"
 
 // ==========================================================
 // VARIABLES DE ESTADO
@@ -15,6 +20,12 @@ extern DisplayState currentDisplayState;
 static bool ad9850_is_enabled = false;
 static uint32_t ad9850_current_freq_hz = 1000000; 
 static uint32_t ad9850_step_hz = 1000;            
+static uint32_t ad9850_last_word = 0;   // Última palabra cargada en el chip
+
+// Máscaras GPIO precalculadas por valor de muestra (3 bits -> 8 combinaciones)
+static uint32_t stream_set_mask[8];
+static uint32_t stream_clr_mask[8];
+static uint32_t stream_words[AD9850_STREAM_MAX_WORDS];
 
 // ==========================================================
 // FUNCIONES PRIVADAS (PORTADAS DEL NANO)
@@ -37,12 +48,10 @@ void tfr_byte(byte data) {
   }
 }
 
-// Envía la frecuencia calculada
-void send_frequency(uint32_t frequency) {
-  // 1. Calcular Tuning Word
-  // Formula: (Freq * 2^32) / CLK_FREQ
-  // Usamos double para evitar desbordamiento en la multiplicación intermedia
-  uint32_t tuning_word = (uint32_t)((double)frequency * 4294967296.0 / AD9850_CLK_FREQ);
+// Envía una palabra de sintonía ya calculada
+static void send_word(uint32_t tuning_word) {
+  uint32_t t0 = metrics_cycles();
+  ad9850_last_word = tuning_word;
 
   // 2. Enviar los 4 bytes de frecuencia (LSB primero)
   for (int b = 0; b < 4; b++, tuning_word >>= 8) {
@@ -54,39 +63,83 @@ void send_frequency(uint32_t frequency) {
 
   // 4. Latch final para aplicar
   pulse_high(AD9850_PIN_FQ_UD);
+  metrics_record(METRIC_BUS, metrics_cycles() - t0);
 }
 
-void updateDisplayAd9850State() {
-    currentDisplayState.moduleName = "AD9850 (" + String(ad9850_is_enabled ? "ON" : "OFF") + ")";
-    
-    String freq_str;
-    if (ad9850_current_freq_hz >= 1000000) {      
-        freq_str = String(ad9850_current_freq_hz / 1000000.0, 3) + " MHz";
-    } else if (ad9850_current_freq_hz >= 1000) { 
-        freq_str = String(ad9850_current_freq_hz / 1000.0, 3) + " kHz";
-    } else {                                     
-        freq_str = String(ad9850_current_freq_hz) + " Hz";
+// Envía la frecuencia calculada
+void send_frequency(uint32_t frequency) {
+  // 1. Calcular Tuning Word
+  // Formula: (Freq * 2^32) / CLK_FREQ (entera en 64 bits, ver ad9850_encoder.h)
+  send_word(ad9850_tuning_word(frequency, (uint32_t)AD9850_CLK_FREQ));
+}
+
+// ==========================================================
+// REPRODUCCIÓN RÁPIDA DE LISTAS (STREAMING)
+// ==========================================================
+// Cada muestra del codificador se escribe con una sola operación sobre
+// los registros W1TS/W1TC del GPIO, sin digitalWrite() ni delayMicroseconds().
+
+static void stream_prepare_masks() {
+  for (uint8_t v = 0; v < 8; v++) {
+    uint32_t set = 0, clr = 0;
+    if (v & AD9850_SAMPLE_DATA)  set |= (1UL << AD9850_PIN_DATA);  else clr |= (1UL << AD9850_PIN_DATA);
+    if (v & AD9850_SAMPLE_W_CLK) set |= (1UL << AD9850_PIN_W_CLK); else clr |= (1UL << AD9850_PIN_W_CLK);
+    if (v & AD9850_SAMPLE_FQ_UD) set |= (1UL << AD9850_PIN_FQ_UD); else clr |= (1UL << AD9850_PIN_FQ_UD);
+    stream_set_mask[v] = set;
+    stream_clr_mask[v] = clr;
+  }
+}
+
+static inline void IRAM_ATTR stream_hold() {
+#if AD9850_STREAM_HOLD_CYCLES > 0
+  uint32_t start = ESP.getCycleCount();
+  while (ESP.getCycleCount() - start < AD9850_STREAM_HOLD_CYCLES) { }
+#endif
+}
+
+// Reproduce 'count' palabras de sintonía ya calculadas. Devuelve la duración en us.
+uint32_t ad9850_stream_words(const uint32_t* words, size_t count) {
+  uint8_t samples[AD9850_SAMPLES_PER_WORD];
+  uint32_t t0 = micros();
+  for (size_t w = 0; w < count; w++) {
+    size_t n = ad9850_encode_word(words[w], 0x00, samples);
+    for (size_t i = 0; i < n; i++) {
+      GPIO.out_w1ts = stream_set_mask[samples[i]];
+      GPIO.out_w1tc = stream_clr_mask[samples[i]];
+      stream_hold();
     }
-    currentDisplayState.primaryDisplay = freq_str; 
+  }
+  if (count) ad9850_last_word = words[count - 1];
+  return micros() - t0;
+}
 
-    String step_str;
-    if (ad9850_step_hz >= 1000000) step_str = "Paso: " + String(ad9850_step_hz / 1000000.0, 0) + " MHz";
-    else if (ad9850_step_hz >= 1000) step_str = "Paso: " + String(ad9850_step_hz / 1000.0, 0) + " kHz";
-    else step_str = "Paso: " + String(ad9850_step_hz) + " Hz";
+void updateDisplayAd9850State() {
+    snprintf(currentDisplayState.moduleName, DISPLAY_TEXT_LEN, "AD9850 (%s)", ad9850_is_enabled ? "ON" : "OFF");
 
-    currentDisplayState.secondaryDisplay = step_str;
-    currentDisplayState.tertiaryDisplay = ad9850_is_enabled ? "SALIDA ACTIVA" : "SALIDA APAGADA";
+    uint8_t unit = FREQ_UNIT_HZ;
+    if (ad9850_current_freq_hz >= 1000000) unit = FREQ_UNIT_MHZ;
+    else if (ad9850_current_freq_hz >= 1000) unit = FREQ_UNIT_KHZ;
+    format_frequency(currentDisplayState.primaryDisplay, DISPLAY_TEXT_LEN, ad9850_current_freq_hz, unit, 3);
+
+    uint8_t step_unit = FREQ_UNIT_HZ;
+    if (ad9850_step_hz >= 1000000) step_unit = FREQ_UNIT_MHZ;
+    else if (ad9850_step_hz >= 1000) step_unit = FREQ_UNIT_KHZ;
+    strcpy(currentDisplayState.secondaryDisplay, "Paso: ");
+    format_frequency(currentDisplayState.secondaryDisplay + 6, DISPLAY_TEXT_LEN - 6, ad9850_step_hz, step_unit, 0);
+
+    strcpy(currentDisplayState.tertiaryDisplay, ad9850_is_enabled ? "SALIDA ACTIVA" : "SALIDA APAGADA");
 }
 
 // ==========================================================
 // FUNCIONES PÚBLICAS
 // ==========================================================
 
-void ad9850_setup() {
+void ad9850_setup(RestoreSource restore) {
   // Configurar pines como SALIDA
   pinMode(AD9850_PIN_W_CLK, OUTPUT);
   pinMode(AD9850_PIN_FQ_UD, OUTPUT);
   pinMode(AD9850_PIN_DATA, OUTPUT);
+  stream_prepare_masks();
 
   // Estado inicial bajo
   digitalWrite(AD9850_PIN_W_CLK, LOW);
@@ -98,17 +151,55 @@ void ad9850_setup() {
   // =========================================================
   // Como RESET está a GND, necesitamos esta secuencia exacta
   // para habilitar el modo serial en el chip.
-  pulse_high(AD9850_PIN_W_CLK);
-  pulse_high(AD9850_PIN_FQ_UD);
+  // Tras un reinicio en caliente el chip ya está en modo serial: los pulsos
+  // correrían un bit el registro y FQ_UD cargaría esa palabra (glitch).
+  if (restore != RESTORE_RTC) {
+    pulse_high(AD9850_PIN_W_CLK);
+    pulse_high(AD9850_PIN_FQ_UD);
+  }
   // =========================================================
 
-  // Inicializar apagado (Frecuencia 0)
-  send_frequency(0); 
+  // Inicializar apagado (Frecuencia 0), salvo que se vaya a restaurar un estado
+  if (restore == RESTORE_NONE) send_frequency(0);
   Serial.println("Modulo AD9850 (Directo/Serial) inicializado.");
 }
 
+void ad9850_get_state(uint32_t* freq_hz, uint32_t* step_hz, bool* enabled) {
+  *freq_hz = ad9850_current_freq_hz;
+  *step_hz = ad9850_step_hz;
+  *enabled = ad9850_is_enabled;
+}
+
+bool ad9850_apply_state(uint32_t freq_hz, uint32_t step_hz, bool enabled) {
+  if (freq_hz > AD9850_MAX_FREQ) return false;
+  ad9850_current_freq_hz = freq_hz;
+  if (step_hz > 0) ad9850_step_hz = step_hz;
+  ad9850_is_enabled = enabled;
+  send_frequency(enabled ? ad9850_current_freq_hz : 0);   // Una sola palabra al chip
+  updateDisplayAd9850State();
+  return true;
+}
+
+uint32_t ad9850_get_word() {
+  return ad9850_last_word;
+}
+
+bool ad9850_load_word(uint32_t tuning_word, uint32_t freq_hz, uint32_t step_hz, bool enabled) {
+  if (freq_hz > AD9850_MAX_FREQ) return false;
+  ad9850_current_freq_hz = freq_hz;
+  if (step_hz > 0) ad9850_step_hz = step_hz;
+  ad9850_is_enabled = enabled;
+  send_word(tuning_word);   // Sin recalcular: la palabra viene del checkpoint
+  updateDisplayAd9850State();
+  return true;
+}
+
 void handle_ad9850_command(uint8_t clientNum, JsonDocument& doc) {
   const char* sub_accion = doc["sub_accion"];
+  int32_t stream_us = -1;
+  size_t stream_count = 0;
+  uint16_t stream_reps = 0;
+  const char* mensaje_error = nullptr;
 
   if (sub_accion) {
     if (strcmp(sub_accion, "set_freq") == 0) {
@@ -137,6 +228,34 @@ void handle_ad9850_command(uint8_t clientNum, JsonDocument& doc) {
       }
       if (ad9850_is_enabled) send_frequency(ad9850_current_freq_hz);
     }
+    else if (strcmp(sub_accion, "play_list") == 0) {
+      // Lista de frecuencias reproducida palabra tras palabra a máxima velocidad
+      JsonArray lista = doc["frecuencias_hz"].as<JsonArray>();
+      // Con 0 o negativas no se enviaría nada pero la frecuencia cambiaría igual
+      int repeticiones = doc["repeticiones"] | 1;
+      if (repeticiones < 1) {
+        mensaje_error = "'repeticiones' debe ser al menos 1.";
+      } else {
+        if (repeticiones > AD9850_STREAM_MAX_REPEATS) repeticiones = AD9850_STREAM_MAX_REPEATS;
+        uint32_t last_f = 0;
+        for (JsonVariant v : lista) {
+          if (stream_count >= AD9850_STREAM_MAX_WORDS) break;
+          uint32_t f = v.as<uint32_t>();
+          if (f > AD9850_MAX_FREQ) continue;
+          stream_words[stream_count++] = ad9850_tuning_word(f, (uint32_t)AD9850_CLK_FREQ);
+          last_f = f;
+        }
+        if (ad9850_is_enabled && stream_count > 0) {
+          stream_us = 0;
+          stream_reps = repeticiones;
+          for (uint16_t r = 0; r < stream_reps; r++) {
+            stream_us += ad9850_stream_words(stream_words, stream_count);
+          }
+          // El chip queda en la última palabra enviada; con la salida apagada no cambia nada
+          ad9850_current_freq_hz = last_f;
+        }
+      }
+    }
     else if (strcmp(sub_accion, "set_step") == 0) {
       if (doc.containsKey("paso_hz")) {
         ad9850_step_hz = doc["paso_hz"];
@@ -154,17 +273,23 @@ void handle_ad9850_command(uint8_t clientNum, JsonDocument& doc) {
   updateDisplayAd9850State();
   
   StaticJsonDocument<256> responseDoc;
-  responseDoc["status"] = "ok";
+  responseDoc["status"] = mensaje_error ? "error" : "ok";
+  if (mensaje_error) responseDoc["mensaje"] = mensaje_error;
   responseDoc["accion"] = "respuesta_ad9850";
   
   JsonObject data = responseDoc.createNestedObject("datos");
   data["frecuencia_hz"] = ad9850_current_freq_hz;
   data["paso_hz"] = ad9850_step_hz;
   data["habilitado"] = ad9850_is_enabled;
+  if (stream_us >= 0) {
+    data["palabras"] = stream_count;
+    data["repeticiones"] = stream_reps;
+    data["duracion_us"] = stream_us;
+  }
 
   String output;
   serializeJson(responseDoc, output);
-  if (clientNum != 255) webSocket.sendTXT(clientNum, output);
+  if (clientNum != 255) enviarRespuesta(clientNum, output);
   
-  showMainScreen();
+  display_mark_dirty();
 }
\ No newline at end of file
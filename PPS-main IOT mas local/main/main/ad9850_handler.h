@@ -3,9 +3,21 @@
 
 #include <Arduino.h>
 #include <ArduinoJson.h>
+#include "instrument_state.h"
 
-void ad9850_setup();
+void ad9850_setup(RestoreSource restore);
 
 void handle_ad9850_command(uint8_t clientNum, JsonDocument& doc);
 
+// Estado completo (memorias / persistencia). apply_state envía una sola palabra.
+void ad9850_get_state(uint32_t* freq_hz, uint32_t* step_hz, bool* enabled);
+bool ad9850_apply_state(uint32_t freq_hz, uint32_t step_hz, bool enabled);
+
+// Reinicio en caliente: palabra de sintonía vigente y recarga directa (sin recalcular).
+uint32_t ad9850_get_word();
+bool ad9850_load_word(uint32_t tuning_word, uint32_t freq_hz, uint32_t step_hz, bool enabled);
+
+// Reproduce palabras de sintonía precalculadas vía registros GPIO. Devuelve la duración en us.
+uint32_t ad9850_stream_words(const uint32_t* words, size_t count);
+
 #endif // AD9850_HANDLER_H
\ No newline at end of file
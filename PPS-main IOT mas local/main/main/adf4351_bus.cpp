@@ -0,0 +1,36 @@
+#include <SPI.h>
+#include "adf4351_bus.h"
+#include "config.h"
+
+void adf4351_bus_begin() {
+  pinMode(ADF4351_SS_PIN, OUTPUT);
+  digitalWrite(ADF4351_SS_PIN, HIGH);
+
+  SPI.begin();
+  SPI.setDataMode(SPI_MODE0);
+  SPI.setBitOrder(MSBFIRST);
+}
+
+void adf4351_bus_write(const uint32_t regs[6]) {
+  digitalWrite(ADF4351_SS_PIN, LOW);
+  delayMicroseconds(10);
+
+  for (int i = 5; i >= 0; i--) {
+    uint32_t reg_val = regs[i];
+
+    // Transferir en orden MSB first
+    SPI.transfer((reg_val >> 24) & 0xFF);
+    SPI.transfer((reg_val >> 16) & 0xFF);
+    SPI.transfer((reg_val >> 8) & 0xFF);
+    SPI.transfer(reg_val & 0xFF);
+
+    // El flanco de subida de LE carga el registro
+    digitalWrite(ADF4351_SS_PIN, HIGH);
+    delayMicroseconds(10);
+    digitalWrite(ADF4351_SS_PIN, LOW);
+    delayMicroseconds(10);
+  }
+
+  digitalWrite(ADF4351_SS_PIN, HIGH);
+  delayMicroseconds(100);
+}
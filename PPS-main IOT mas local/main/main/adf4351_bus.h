@@ -0,0 +1,24 @@
+#ifndef ADF4351_BUS_H
+#define ADF4351_BUS_H
+
+#include <stdint.h>
+
+// ==========================================================
+// ESCRITURA SPI DEL ADF4351
+// ==========================================================
+// Envía la imagen R0..R5 calculada por adf4351_plan.h: R5 primero, cada
+// registro MSB primero, con un pulso de LE entre registros. Solo usa SPI y
+// digitalWrite(), así que en el PC se compila contra el HAL simulado de
+// host/ y se verifica la trama grabada.
+
+/**
+ * @brief Configura LE y el periférico SPI (modo 0, MSB primero).
+ */
+void adf4351_bus_begin();
+
+/**
+ * @brief Escribe los seis registros. regs[i] es el registro Ri.
+ */
+void adf4351_bus_write(const uint32_t regs[6]);
+
+#endif // ADF4351_BUS_H
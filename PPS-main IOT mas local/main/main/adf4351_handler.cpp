@@ -1,8 +1,12 @@
-#include <SPI.h>
 #include <WebSocketsServer.h>
 #include "adf4351_handler.h"
+#include "adf4351_plan.h"
+#include "adf4351_bus.h"
 #include "display_handler.h"
+#include "freq_format.h"
 #include "config.h"
+#include "main_interface.h"
+#include "latency_metrics.h"
 
 // ==========================================================
 // DEFINICIÓN DE CONSTANTES (solo aquí para evitar múltiples definiciones)
@@ -35,107 +39,34 @@ struct Adf4351State {
 
 static Adf4351State adf_state = {1000000000ULL, false, 3, 1000, {0,0,0,0,0,0}};
 
-// Macro para desplazamiento de bits
-#define SHL(x, y) ((uint32_t)(x) << (y))
-
 // ==========================================================
 // FUNCIONES PRIVADAS DE CONTROL
 // ==========================================================
 
 void updateDisplayAdf4351State() {
-    currentDisplayState.moduleName = "ADF4351 (" + String(adf_state.rf_enabled ? "ON" : "OFF") + ")";
+    snprintf(currentDisplayState.moduleName, DISPLAY_TEXT_LEN, "ADF4351 (%s)", adf_state.rf_enabled ? "ON" : "OFF");
 
-    String freq_str;
-    if (adf_state.frequency_hz >= 1000000000ULL) {
-        freq_str = String(adf_state.frequency_hz / 1000000000.0, 4) + " GHz";
-    } else {
-        freq_str = String(adf_state.frequency_hz / 1000000.0, 4) + " MHz";
-    }
-    currentDisplayState.primaryDisplay = freq_str;
+    uint8_t unit = (adf_state.frequency_hz >= 1000000000ULL) ? FREQ_UNIT_GHZ : FREQ_UNIT_MHZ;
+    format_frequency(currentDisplayState.primaryDisplay, DISPLAY_TEXT_LEN, adf_state.frequency_hz, unit, 3);
 
     const char* powerLevels[] = {"-4dBm", "-1dBm", "+2dBm", "+5dBm"};
-    currentDisplayState.secondaryDisplay = "Pot: " + String(powerLevels[adf_state.out_power]);
-    currentDisplayState.tertiaryDisplay = "Salida: " + String(adf_state.rf_enabled ? "ON" : "OFF");
+    snprintf(currentDisplayState.secondaryDisplay, DISPLAY_TEXT_LEN, "Pot: %s", powerLevels[adf_state.out_power]);
+    snprintf(currentDisplayState.tertiaryDisplay, DISPLAY_TEXT_LEN, "Salida: %s", adf_state.rf_enabled ? "ON" : "OFF");
 }
 // Archivo: adf4351_handler.cpp
 
 void prepare_registers() {
-    uint8_t rf_div_sel = 0;
-    if(adf_state.frequency_hz >= 2200000000ULL) rf_div_sel = 0;
-    else if(adf_state.frequency_hz >= 1100000000ULL) rf_div_sel = 1;
-    else if(adf_state.frequency_hz >= 550000000ULL) rf_div_sel = 2;
-    else if(adf_state.frequency_hz >= 275000000ULL) rf_div_sel = 3;
-    else if(adf_state.frequency_hz >= 137500000ULL) rf_div_sel = 4;
-    else if(adf_state.frequency_hz >= 68750000ULL) rf_div_sel = 5;
-    else rf_div_sel = 6;
-
-    uint32_t pfd_freq = ADF4351_REF_CLK_HZ;
-    
-    // Calcular frecuencia VCO
-    double vco_freq = (double)adf_state.frequency_hz * (1ULL << rf_div_sel);
-    
-    // ================== INICIO DE LA NUEVA CORRECCIÓN ==================
-    // Seleccionar el prescaler correcto basado en la frecuencia del VCO
-    uint8_t prescaler = 0;
-    if (vco_freq >= 3600000000.0) {
-        prescaler = 1; // Modo 8/9 para VCO >= 3.6 GHz
-    } else {
-        prescaler = 0; // Modo 4/5 para VCO < 3.6 GHz
-    }
-    // =================== FIN DE LA NUEVA CORRECCIÓN ====================
-
-    // Calcular INT, MOD y FRAC
-    uint32_t INT = (uint32_t)(vco_freq / pfd_freq);
-    uint16_t MOD = 4095;
-    double frac_part = (vco_freq / (double)pfd_freq) - INT;
-    uint16_t FRAC = (uint16_t)(frac_part * MOD + 0.5);
-    
-    // Registro 0: Control de frecuencia
-    adf_state.registers[0] = SHL(INT, 15) | SHL(FRAC, 3) | 0b000;
-    
-    // Registro 1: Control de fase y MOD (AHORA CON PRESCALER DINÁMICO)
-    adf_state.registers[1] = SHL(0, 28) | SHL(prescaler, 27) | SHL(1, 15) | SHL(MOD, 3) | 0b001;
-    
-    // Registro 2: Control de charge pump y otros
-    adf_state.registers[2] = SHL(0, 29) | SHL(6, 26) | SHL(0, 25) | SHL(0, 24) | 
-                            SHL(1, 14) | SHL(0, 13) | SHL(7, 9) | SHL(1, 8) | 
-                            SHL(0, 7) | SHL(1, 6) | SHL(0, 5) | SHL(0, 4) | 0b010;
-    
-    // Registro 3: Control de temporización
-    adf_state.registers[3] = SHL(0, 23) | SHL(0, 22) | SHL(0, 21) | SHL(0, 18) | 
-                            SHL(0, 15) | SHL(150, 3) | 0b011;
-    
-    // Registro 4: Control de salida RF (CON EL DIVISOR DE RELOJ YA CORREGIDO)
-    adf_state.registers[4] = SHL(1, 23) | SHL(rf_div_sel, 20) | SHL(250, 12) | 
-                            SHL(0, 11) | SHL(1, 10) | SHL(0, 9) | SHL(0, 8) | 
-                            SHL(0, 6) | SHL(adf_state.rf_enabled, 5) | 
-                            SHL(adf_state.out_power, 3) | 0b100;
-    
-    // Registro 5: Control de pin LD
-    adf_state.registers[5] = SHL(1, 22) | SHL(0b11, 19) | 0b101;
+    uint32_t t0 = metrics_cycles();
+    // Cálculo puro (ver adf4351_plan.h)
+    adf4351_plan_registers(adf_state.frequency_hz, ADF4351_REF_CLK_HZ, adf_state.out_power,
+                           adf_state.rf_enabled, adf_state.registers);
+    metrics_record(METRIC_PLAN, metrics_cycles() - t0);
 }
 
 void update_all_registers() {
-    digitalWrite(ADF4351_SS_PIN, LOW);
-    delayMicroseconds(10);
-    
-    for (int i = 5; i >= 0; i--) {
-        uint32_t reg_val = adf_state.registers[i];
-        
-        // Transferir en orden MSB first
-        SPI.transfer((reg_val >> 24) & 0xFF);
-        SPI.transfer((reg_val >> 16) & 0xFF);
-        SPI.transfer((reg_val >> 8) & 0xFF);
-        SPI.transfer(reg_val & 0xFF);
-        
-        digitalWrite(ADF4351_SS_PIN, HIGH);
-        delayMicroseconds(10);
-        digitalWrite(ADF4351_SS_PIN, LOW);
-        delayMicroseconds(10);
-    }
-    
-    digitalWrite(ADF4351_SS_PIN, HIGH);
-    delayMicroseconds(100);
+    uint32_t t0 = metrics_cycles();
+    adf4351_bus_write(adf_state.registers);   // Trama SPI (ver adf4351_bus.h)
+    metrics_record(METRIC_BUS, metrics_cycles() - t0);
 }
 
 // Función auxiliar para validar si un paso es válido
@@ -152,20 +83,50 @@ bool is_valid_step(uint32_t step) {
 // IMPLEMENTACIÓN DE FUNCIONES PÚBLICAS
 // ==========================================================
 
-void adf4351_setup() {
-    pinMode(ADF4351_SS_PIN, OUTPUT);
-    digitalWrite(ADF4351_SS_PIN, HIGH);
-    
-    SPI.begin();
-    SPI.setDataMode(SPI_MODE0);
-    SPI.setBitOrder(MSBFIRST);
+void adf4351_setup(RestoreSource restore) {
+    adf4351_bus_begin();
     
     prepare_registers();
-    update_all_registers();
+    if (restore == RESTORE_NONE) update_all_registers();
     
     Serial.println("Modulo ADF4351 inicializado.");
 }
 
+void adf4351_get_state(uint64_t* freq_hz, uint32_t* step_hz, uint8_t* power, bool* enabled) {
+    *freq_hz = adf_state.frequency_hz;
+    *step_hz = adf_state.step_hz;
+    *power = adf_state.out_power;
+    *enabled = adf_state.rf_enabled;
+}
+
+bool adf4351_apply_state(uint64_t freq_hz, uint32_t step_hz, uint8_t power, bool enabled) {
+    if (freq_hz < ADF4351_MIN_FREQ || freq_hz > ADF4351_MAX_FREQ || power > 3) return false;
+    adf_state.frequency_hz = freq_hz;
+    if (is_valid_step(step_hz)) adf_state.step_hz = step_hz;
+    adf_state.out_power = power;
+    adf_state.rf_enabled = enabled;
+    prepare_registers();
+    update_all_registers();   // Una sola escritura de los 6 registros
+    updateDisplayAdf4351State();
+    return true;
+}
+
+void adf4351_get_registers(uint32_t regs[6]) {
+    memcpy(regs, adf_state.registers, sizeof(adf_state.registers));
+}
+
+bool adf4351_load_registers(const uint32_t regs[6], uint64_t freq_hz, uint32_t step_hz, uint8_t power, bool enabled) {
+    if (freq_hz < ADF4351_MIN_FREQ || freq_hz > ADF4351_MAX_FREQ || power > 3) return false;
+    adf_state.frequency_hz = freq_hz;
+    if (is_valid_step(step_hz)) adf_state.step_hz = step_hz;
+    adf_state.out_power = power;
+    adf_state.rf_enabled = enabled;
+    memcpy(adf_state.registers, regs, sizeof(adf_state.registers));
+    update_all_registers();   // La imagen ya viene calculada
+    updateDisplayAdf4351State();
+    return true;
+}
+
 void handle_adf4351_command(uint8_t clientNum, JsonDocument& doc) {
     const char* sub_accion = doc["sub_accion"];
     bool needs_update = false;
@@ -257,8 +218,8 @@ void handle_adf4351_command(uint8_t clientNum, JsonDocument& doc) {
 
     String output;
     serializeJson(responseDoc, output);
-    webSocket.sendTXT(clientNum, output);
+    enviarRespuesta(clientNum, output);
     
     // Actualizar pantalla
-    showMainScreen();
+    display_mark_dirty();
 }
\ No newline at end of file
@@ -3,9 +3,18 @@
 
 #include <Arduino.h>
 #include <ArduinoJson.h>
+#include "instrument_state.h"
 
-void adf4351_setup();
+void adf4351_setup(RestoreSource restore);
 
 void handle_adf4351_command(uint8_t clientNum, JsonDocument& doc);
 
+// Estado completo (memorias / persistencia). apply_state escribe los registros una vez.
+void adf4351_get_state(uint64_t* freq_hz, uint32_t* step_hz, uint8_t* power, bool* enabled);
+bool adf4351_apply_state(uint64_t freq_hz, uint32_t step_hz, uint8_t power, bool enabled);
+
+// Reinicio en caliente: imagen de los 6 registros y recarga sin re-planificar.
+void adf4351_get_registers(uint32_t regs[6]);
+bool adf4351_load_registers(const uint32_t regs[6], uint64_t freq_hz, uint32_t step_hz, uint8_t power, bool enabled);
+
 #endif // ADF4351_HANDLER_H
\ No newline at end of file
@@ -0,0 +1,76 @@
+#ifndef ADF4351_PLAN_H
+#define ADF4351_PLAN_H
+
+#include <stdint.h>
+
+// ==========================================================
+// PLANIFICACIÓN DE REGISTROS DEL ADF4351
+// ==========================================================
+// Traduce frecuencia, potencia y habilitación a la imagen de los seis
+// registros (R0..R5) que update_all_registers() envía por SPI. Este
+// módulo no depende de Arduino: igual que ad9850_encoder.h y
+// freq_format.h, se puede compilar en el PC para verificar o medir la
+// planificación sin el sintetizador conectado.
+
+#define ADF4351_SHL(x, y) ((uint32_t)(x) << (y))
+
+/**
+ * @brief Divisor de salida (exponente de 2) para que el VCO quede en 2.2..4.4 GHz.
+ */
+inline uint8_t adf4351_rf_divider(uint64_t freq_hz) {
+  if (freq_hz >= 2200000000ULL) return 0;
+  if (freq_hz >= 1100000000ULL) return 1;
+  if (freq_hz >= 550000000ULL) return 2;
+  if (freq_hz >= 275000000ULL) return 3;
+  if (freq_hz >= 137500000ULL) return 4;
+  if (freq_hz >= 68750000ULL) return 5;
+  return 6;
+}
+
+/**
+ * @brief Calcula R0..R5 para la frecuencia pedida.
+ * @param ref_hz Frecuencia de comparación (PFD); la referencia se usa sin divisor.
+ * @param out_power 0 (-4 dBm), 1 (-1 dBm), 2 (+2 dBm), 3 (+5 dBm).
+ * @param regs Salida: regs[i] es el registro Ri.
+ */
+inline void adf4351_plan_registers(uint64_t freq_hz, uint32_t ref_hz, uint8_t out_power,
+                                   bool rf_enabled, uint32_t regs[6]) {
+  uint8_t rf_div_sel = adf4351_rf_divider(freq_hz);
+  double vco_freq = (double)freq_hz * (1ULL << rf_div_sel);
+
+  // Prescaler 8/9 para VCO >= 3.6 GHz, 4/5 por debajo
+  uint8_t prescaler = (vco_freq >= 3600000000.0) ? 1 : 0;
+
+  // INT, MOD y FRAC
+  uint32_t INT = (uint32_t)(vco_freq / ref_hz);
+  uint16_t MOD = 4095;
+  double frac_part = (vco_freq / (double)ref_hz) - INT;
+  uint16_t FRAC = (uint16_t)(frac_part * MOD + 0.5);
+
+  // Registro 0: Control de frecuencia
+  regs[0] = ADF4351_SHL(INT, 15) | ADF4351_SHL(FRAC, 3) | 0b000;
+
+  // Registro 1: Fase, prescaler y MOD
+  regs[1] = ADF4351_SHL(0, 28) | ADF4351_SHL(prescaler, 27) | ADF4351_SHL(1, 15) |
+            ADF4351_SHL(MOD, 3) | 0b001;
+
+  // Registro 2: Charge pump y otros
+  regs[2] = ADF4351_SHL(0, 29) | ADF4351_SHL(6, 26) | ADF4351_SHL(0, 25) | ADF4351_SHL(0, 24) |
+            ADF4351_SHL(1, 14) | ADF4351_SHL(0, 13) | ADF4351_SHL(7, 9) | ADF4351_SHL(1, 8) |
+            ADF4351_SHL(0, 7) | ADF4351_SHL(1, 6) | ADF4351_SHL(0, 5) | ADF4351_SHL(0, 4) | 0b010;
+
+  // Registro 3: Temporización
+  regs[3] = ADF4351_SHL(0, 23) | ADF4351_SHL(0, 22) | ADF4351_SHL(0, 21) | ADF4351_SHL(0, 18) |
+            ADF4351_SHL(0, 15) | ADF4351_SHL(150, 3) | 0b011;
+
+  // Registro 4: Salida RF (divisor, habilitación y potencia)
+  regs[4] = ADF4351_SHL(1, 23) | ADF4351_SHL(rf_div_sel, 20) | ADF4351_SHL(250, 12) |
+            ADF4351_SHL(0, 11) | ADF4351_SHL(1, 10) | ADF4351_SHL(0, 9) | ADF4351_SHL(0, 8) |
+            ADF4351_SHL(0, 6) | ADF4351_SHL(rf_enabled, 5) |
+            ADF4351_SHL(out_power, 3) | 0b100;
+
+  // Registro 5: Pin LD
+  regs[5] = ADF4351_SHL(1, 22) | ADF4351_SHL(0b11, 19) | 0b101;
+}
+
+#endif // ADF4351_PLAN_H
@@ -0,0 +1,32 @@
+#include "boot_timeline.h"
+
+static uint32_t marks_ms[BOOT_MARK_COUNT];
+
+static const char* const MARK_NAMES[BOOT_MARK_COUNT] = {
+  "wifi_iniciado",
+  "display_listo",
+  "si5351_listo",
+  "ad9850_listo",
+  "adf4351_listo",
+  "switches_listos",
+  "hardware_listo",
+  "wifi_ip",
+  "websocket_listo",
+  "primer_comando",
+  "nube_conectada",
+  "setup_terminado",
+};
+
+void boot_mark(BootMark mark) {
+  if (mark >= BOOT_MARK_COUNT || marks_ms[mark] != 0) return;
+  marks_ms[mark] = millis() | 1;   // 0 queda reservado para "no ocurrió"
+  Serial.printf("[Arranque] %s a los %lu ms\n", MARK_NAMES[mark], (unsigned long)marks_ms[mark]);
+}
+
+uint32_t boot_mark_ms(BootMark mark) {
+  return mark < BOOT_MARK_COUNT ? marks_ms[mark] : 0;
+}
+
+const char* boot_mark_name(BootMark mark) {
+  return mark < BOOT_MARK_COUNT ? MARK_NAMES[mark] : "";
+}
@@ -0,0 +1,41 @@
+#ifndef BOOT_TIMELINE_H
+#define BOOT_TIMELINE_H
+
+#include <Arduino.h>
+
+// ==========================================================
+// LÍNEA DE TIEMPO DEL ARRANQUE
+// ==========================================================
+// Guarda el millis() de la primera vez que ocurre cada hito, para medir
+// cuánto tarda el instrumento en quedar usable. Se consulta con la
+// acción "tiempos_arranque".
+
+enum BootMark : uint8_t {
+  BOOT_WIFI_STARTED,     // Asociación WiFi lanzada (corre en paralelo al hardware)
+  BOOT_DISPLAY_READY,
+  BOOT_SI5351_READY,
+  BOOT_AD9850_READY,
+  BOOT_ADF4351_READY,
+  BOOT_RF_SWITCH_READY,
+  BOOT_HARDWARE_DONE,    // Todos los generadores configurados
+  BOOT_WIFI_IP,          // La estación obtuvo IP
+  BOOT_WS_READY,         // Servidor WebSocket escuchando
+  BOOT_FIRST_COMMAND,    // Primer comando local (WebSocket o REST)
+  BOOT_CLOUD_CONNECTED,  // Arduino IoT Cloud conectada
+  BOOT_SETUP_DONE,       // Fin de setup()
+  BOOT_MARK_COUNT
+};
+
+/**
+ * @brief Registra el hito si todavía no ocurrió.
+ */
+void boot_mark(BootMark mark);
+
+/**
+ * @brief millis() del hito, o 0 si no ocurrió.
+ */
+uint32_t boot_mark_ms(BootMark mark);
+
+const char* boot_mark_name(BootMark mark);
+
+#endif // BOOT_TIMELINE_H
@@ -165,16 +165,7 @@ void onCloudInputChange() {
   // PARSEO DE FRECUENCIA DIRECTA (Números)
   // -------------------------------------------------
   else {
-    // 1. Verificar si es el VFO. Si es VFO, PROHIBIR entrada directa.
-    // Esto evita el fallo crítico porque vfo_handler no tiene 'set_freq'.
-    if (cloud_selector == 0) {
-      updateCloudDisplay("ERROR: VFO no admite Freq directa.");
-      // Opcional: Podríamos enviar muchos '+' o '-', pero sería muy lento.
-      cloud_input = ""; 
-      return; 
-    }
-
-    // 2. Parseo para AD9850 y ADF4351
+    // Parseo para VFO, AD9850 y ADF4351 (todos aceptan 'set_freq')
     double multiplier = 1.0;
     if (input.endsWith("g")) { multiplier = 1e9; input.remove(input.length() - 1); } 
     else if (input.endsWith("m")) { multiplier = 1e6; input.remove(input.length() - 1); } 
@@ -189,6 +180,10 @@ void onCloudInputChange() {
          updateCloudDisplay("Error: Min ADF4351 es 35MHz");
          return;
       }
+      if (cloud_selector == 0 && (freq < 10000 || freq > 225000000)) {
+         updateCloudDisplay("Error: VFO admite 10kHz - 225MHz");
+         return;
+      }
       
       doc["sub_accion"] = "set_freq";
       doc["frecuencia_hz"] = freq; 
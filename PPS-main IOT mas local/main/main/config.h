@@ -5,15 +5,40 @@
 // SECCIÓN DE DEFINICIONES Y CONSTANTES GLOBALES
 // ==========================================================
 
+// --- Configuración del bus I2C ---
+// 100000 = Standard, 400000 = Fast-mode, 1000000 = Fast-mode Plus.
+// El Si5351 y el SH1106 solo garantizan 400 kHz; Fm+ queda a riesgo del usuario.
+#define I2C_BUS_CLOCK_HZ    400000
+#define I2C_BUS_TIMEOUT_MS  250
+#define I2C_SDA_PIN         21
+#define I2C_SCL_PIN         22
+// Cuarentena de direcciones de usuario que cuelgan el bus
+#define I2C_QUARANTINE_AFTER  2       // Cuelgues seguidos
+#define I2C_QUARANTINE_MS     30000
+// Escáner incremental: direcciones probadas por loop() y re-escaneo en
+// segundo plano (0 = solo bajo pedido).
+#define I2C_SCAN_ADDR_PER_LOOP  4
+#define I2C_SCAN_INTERVAL_MS    60000
+
 // --- Configuración del Display OLED ---
 #define ANCHO 128
 #define ALTO 64
 #define OLED_ADDR 0x3C
+// Máximo de redibujados por segundo de la pantalla principal. Las ráfagas
+// de comandos solo marcan la pantalla como sucia; se dibuja el último estado.
+#define DISPLAY_MAX_FPS 10
 
 // --- Configuración del Si5351 ---
 #define SI5351_CRYSTAL_FREQ 25000000UL
 #define SI5351_CORRECTION   0
 #define SI5351_ADDR         0x60
+#define SI5351_READY_TIMEOUT_MS  100   // Espera máxima a que baje SYS_INIT (reg. 0)
+// Calibración del cristal (ver si5351_cal.h). SI5351_CORRECTION es el valor
+// por defecto mientras no haya una corrección guardada en NVS.
+#define SI5351_CAL_PIN        34          // Entrada del contador: cablear CLK2 aquí
+#define SI5351_CAL_FREQ_HZ    10000000UL  // Frecuencia emitida por CLK2 al calibrar
+#define SI5351_CAL_GATE_MS    2000        // Ventana de conteo
+#define SI5351_CAL_MAX_PPB    500000      // Errores mayores (500 ppm) se rechazan
 
 
 //#define AD9850_I2C_ADDR 8   // Dirección I2C del Arduino Nano
@@ -27,6 +52,10 @@
 #define AD9850_PIN_FQ_UD  4   // D4
 #define AD9850_PIN_DATA   2   // D2
 #define AD9850_MAX_FREQ 40000000UL 
+// Reproducción rápida de listas (play_list): escritura directa a registros GPIO
+#define AD9850_STREAM_MAX_WORDS   64  // Máximo de frecuencias por lista
+#define AD9850_STREAM_HOLD_CYCLES 24  // Ciclos de CPU por muestra (~100 ns a 240 MHz, margen para el level shifter)
+#define AD9850_STREAM_MAX_REPEATS 16  // Tope de repeticiones: ~13 ms de loop() bloqueado con 64 palabras
 // NOTA: Los pines físicos W_CLK, FQ_UD, DATA, RESET ahora se conectan al Arduino Nano.
 // Ya no se definen aquí para la ESP32.
 // --- Configuración del ADF4351 ---
@@ -48,6 +77,36 @@ extern const uint8_t ADF4351_NUM_STEPS;
 #define ADF4351_STEP_1MHZ       1000000
 #define ADF4351_STEP_10MHZ      10000000
 
+// --- Canales de memoria (ver memory_channels.h) ---
+#define MEM_CHANNEL_COUNT      16
+#define MEM_SAVE_DEBOUNCE_MS   5000   // Agrupa cambios antes de escribir en flash
+
+// --- Estado persistente del instrumento (ver instrument_state.h) ---
+#define STATE_POLL_MS               250     // Cada cuánto se compara el estado vivo
+#define STATE_SAVE_DEBOUNCE_MS      5000    // Tiempo sin cambios antes de grabar
+#define STATE_SAVE_MIN_INTERVAL_MS  30000   // Separación mínima entre escrituras
+#define WARM_CHECKPOINT_MS          50      // Revisión del checkpoint en RTC (ver warm_restart.h)
+
+// --- Conexión WiFi ---
+#define WIFI_CONNECT_TIMEOUT_MS  15000   // Sin IP en este tiempo se levanta el AP
+#define WIFI_FAST_TIMEOUT_MS     3000    // Camino rápido (canal + BSSID) antes de barrer
+
+// --- Arduino IoT Cloud (servicio opcional) ---
+// El control local (HTTP + WebSocket) arranca apenas hay IP; la nube se
+// conecta en segundo plano. Si un intento no conecta en CLOUD_ATTEMPT_MS se
+// espera un tiempo que se duplica desde CLOUD_BACKOFF_MIN_MS hasta
+// CLOUD_BACKOFF_MAX_MS. CLOUD_ENABLED 0 la desactiva (red de laboratorio aislada).
+#define CLOUD_ENABLED          1
+#define CLOUD_ATTEMPT_MS       30000
+#define CLOUD_BACKOFF_MIN_MS   10000
+#define CLOUD_BACKOFF_MAX_MS   300000
+
+// --- Colas de salida WebSocket (ver ws_tx.h) ---
+#define WS_MAX_CLIENTS         4    // Clientes aceptados (<= WEBSOCKETS_SERVER_CLIENT_MAX)
+#define WS_ACK_QUEUE_DEPTH     8    // Respuestas pendientes antes de desconectar
+#define WS_STATE_QUEUE_DEPTH   2    // Mensajes de estado (se descarta el más viejo)
+#define WS_TX_PER_LOOP         2    // Mensajes por cliente en cada loop()
+
 // --- Configuración de Switches RF ---
 // PRIMER SWITCH RF
 #define RF_SWITCH_1_PIN_1  25    // Control 1
@@ -55,8 +114,13 @@ extern const uint8_t ADF4351_NUM_STEPS;
 #define RF_SWITCH_1_PIN_3  27    // Control 3
 
 // SEGUNDO SWITCH RF (sin conflictos con I2C, SPI ni AD9850)
+// Las seis líneas deben ser GPIO < 32: se escriben en un único registro.
 #define RF_SWITCH_2_PIN_1  12    // Control 1
 #define RF_SWITCH_2_PIN_2  13    // Control 2
-#define RF_SWITCH_2_PIN_3  33    // Control 3
+#define RF_SWITCH_2_PIN_3  17    // Control 3 (TX2)
+
+// Tiempo de asentamiento tras un cambio de ruta, igual para todos los
+// caminos (el del switch; medir si se agrega un filtro o relé)
+#define RF_SWITCH_SETTLE_US  20
 
 #endif // CONFIG_H
\ No newline at end of file
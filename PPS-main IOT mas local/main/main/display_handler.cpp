@@ -1,7 +1,9 @@
 #include <Adafruit_GFX.h>
 #include <Adafruit_SH110X.h>
 #include "display_handler.h"
+#include "i2c_bus.h"
 #include "config.h" 
+#include "latency_metrics.h"
 
 // ==========================================================
 // DECLARACIÓN DE OBJETOS Y VARIABLES EXTERNAS
@@ -14,16 +16,109 @@ extern String ipAddressLine;
 extern String cloud_display; 
 
 // ==========================================================
-// FUNCIÓN AUXILIAR DE FORMATEO
+// ENVÍO DEL FRAMEBUFFER POR TROZOS (SH1106)
 // ==========================================================
-String formatNumericString(const String &inputStr) {
-  int spaceIndex = inputStr.indexOf(' ');
-  if (spaceIndex <= 0) return inputStr;
-
-  String numberPart = inputStr.substring(0, spaceIndex);
-  String unitPart = inputStr.substring(spaceIndex); 
-  float value = numberPart.toFloat();
-  return String(value, 3) + unitPart;
+// El SH1106 tiene 132 columnas de RAM; las 128 visibles empiezan en la 2.
+// Se guarda una copia de lo que ya está en el panel ('sent_frame'). Cada
+// pedido de refresco compara el framebuffer contra esa copia y, por página
+// (8 filas x 128 columnas), marca solo el rango de columnas que cambió.
+// Los datos se envían en trozos de OLED_CHUNK_BYTES para no monopolizar el bus.
+#define SH1106_PAGES       (ALTO / 8)
+#define SH1106_COL_OFFSET  2
+#define OLED_CHUNK_BYTES   32
+
+static uint8_t sent_frame[ANCHO * SH1106_PAGES];
+static bool sent_valid = false;               // false hasta el primer envío completo
+static uint8_t dirty_lo[SH1106_PAGES];        // Primera columna sucia por página
+static uint8_t dirty_hi[SH1106_PAGES];        // Última columna sucia (inclusive)
+static uint8_t push_pending_pages = 0;        // bit n = página n pendiente
+static uint8_t push_page = 0;
+static uint8_t push_col = 0;                  // Próxima columna a enviar
+static bool push_addressed = false;           // Comandos de dirección ya enviados
+static DisplayFrameStats frame_acc = {0, 0};
+static DisplayFrameStats frame_last = {0, 0};
+
+static uint8_t pushWrite(const uint8_t* data, size_t len) {
+  uint32_t t0 = micros();
+  uint8_t err = i2c_bus_write(OLED_ADDR, data, len, I2C_CLIENT_DISPLAY);
+  frame_acc.bytes += len + 1;
+  frame_acc.us += micros() - t0;
+  return err;
+}
+
+static void finishRefresh() {
+  frame_last = frame_acc;
+  frame_acc.bytes = 0;
+  frame_acc.us = 0;
+}
+
+void display_request_push() {
+  const uint8_t* fb = display.getBuffer();
+  push_pending_pages = 0;
+  for (uint8_t page = 0; page < SH1106_PAGES; page++) {
+    const uint8_t* now = fb + page * ANCHO;
+    const uint8_t* old = sent_frame + page * ANCHO;
+    int lo = 0, hi = ANCHO - 1;
+    if (sent_valid) {
+      while (lo < ANCHO && now[lo] == old[lo]) lo++;
+      if (lo == ANCHO) continue;   // Página sin cambios
+      while (now[hi] == old[hi]) hi--;
+    }
+    dirty_lo[page] = lo;
+    dirty_hi[page] = hi;
+    push_pending_pages |= (1 << page);
+  }
+  // La página en curso se reanuda con su nuevo rango
+  push_addressed = false;
+  if (push_pending_pages & (1 << push_page)) push_col = dirty_lo[push_page];
+  if (!push_pending_pages) finishRefresh();   // Refresco sin cambios: 0 bytes
+}
+
+bool display_push_step() {
+  if (!push_pending_pages) return false;
+  if (!(push_pending_pages & (1 << push_page))) {
+    while (!(push_pending_pages & (1 << push_page))) push_page = (push_page + 1) % SH1106_PAGES;
+    push_col = dirty_lo[push_page];
+    push_addressed = false;
+  }
+
+  if (!push_addressed) {
+    const uint8_t col = SH1106_COL_OFFSET + push_col;
+    const uint8_t cmd[] = {0x00, (uint8_t)(0xB0 | push_page), (uint8_t)(col & 0x0F), (uint8_t)(0x10 | (col >> 4))};
+    pushWrite(cmd, sizeof(cmd));
+    push_addressed = true;
+  }
+
+  uint8_t len = dirty_hi[push_page] + 1 - push_col;
+  if (len > OLED_CHUNK_BYTES) len = OLED_CHUNK_BYTES;
+  uint16_t offset = push_page * ANCHO + push_col;
+  uint8_t chunk[OLED_CHUNK_BYTES + 1];
+  chunk[0] = 0x40;
+  memcpy(&chunk[1], display.getBuffer() + offset, len);
+  if (pushWrite(chunk, len + 1) == 0) {
+    memcpy(&sent_frame[offset], &chunk[1], len);
+  }
+
+  push_col += len;
+  if (push_col > dirty_hi[push_page]) {
+    push_pending_pages &= ~(1 << push_page);
+    push_addressed = false;
+    push_page = (push_page + 1) % SH1106_PAGES;
+    push_col = dirty_lo[push_page];
+    if (!push_pending_pages) {
+      sent_valid = true;
+      finishRefresh();
+    }
+  }
+  return push_pending_pages != 0;
+}
+
+void display_push_now() {
+  while (display_push_step()) { }
+}
+
+const DisplayFrameStats& display_last_frame_stats() {
+  return frame_last;
 }
 
 // ==========================================================
@@ -40,6 +135,27 @@ bool display_setup() {
   return true;
 }
 
+// ==========================================================
+// REFRESCO DESACOPLADO
+// ==========================================================
+static volatile bool display_dirty = false;
+static uint32_t last_render_ms = 0;
+
+void display_mark_dirty() {
+  display_dirty = true;
+}
+
+void display_service() {
+  if (!display_dirty) return;
+  uint32_t now = millis();
+  if (now - last_render_ms < 1000UL / DISPLAY_MAX_FPS) return;
+  display_dirty = false;
+  last_render_ms = now;
+  uint32_t t0 = metrics_cycles();
+  showMainScreen();
+  metrics_record(METRIC_DISPLAY, metrics_cycles() - t0);
+}
+
 void showMainScreen() {
   // 1. ACTUALIZAR HARDWARE (OLED)
   display.clearDisplay();
@@ -47,7 +163,7 @@ void showMainScreen() {
 
   // Título
   display.setTextSize(1);
-  String title = currentDisplayState.moduleName; 
+  const char* title = currentDisplayState.moduleName;
   int16_t x1, y1;
   uint16_t w, h;
   display.getTextBounds(title, 0, 0, &x1, &y1, &w, &h);
@@ -64,12 +180,10 @@ void showMainScreen() {
     display.drawLine(120, 7, 128, 0, SH110X_WHITE);
   }
   
-  // Datos principales formateados
-  String formattedPrimary = formatNumericString(currentDisplayState.primaryDisplay);
-
+  // Datos principales (los handlers ya los entregan formateados)
   display.setTextSize(2);
   display.setCursor(0, 18);
-  display.print(formattedPrimary);
+  display.print(currentDisplayState.primaryDisplay);
 
   display.setTextSize(1);
   display.setCursor(0, 40);
@@ -84,18 +198,20 @@ void showMainScreen() {
     display.print(ipAddressLine);
   }
 
-  display.display();
+  // El envío lo hace i2c_bus_service() por trozos, con menor prioridad que el Si5351
+  display_request_push();
 
   // 2. ACTUALIZAR NUBE (Sincronización)
   // Creamos un string resumen: "VFO: 7.100 MHz | RX Step:1k"
-  String cloudMsg = title + ": " + formattedPrimary;
-  
+  char cloudMsg[4 * DISPLAY_TEXT_LEN + 8];
+  int n = snprintf(cloudMsg, sizeof(cloudMsg), "%s: %s", title, currentDisplayState.primaryDisplay);
+
   // Añadimos información secundaria si existe
-  if (currentDisplayState.secondaryDisplay.length() > 0) {
-    cloudMsg += " | " + currentDisplayState.secondaryDisplay;
+  if (currentDisplayState.secondaryDisplay[0] != '\0') {
+    n += snprintf(cloudMsg + n, sizeof(cloudMsg) - n, " | %s", currentDisplayState.secondaryDisplay);
   }
-  if (currentDisplayState.tertiaryDisplay.length() > 0) {
-    cloudMsg += " " + currentDisplayState.tertiaryDisplay;
+  if (currentDisplayState.tertiaryDisplay[0] != '\0') {
+    snprintf(cloudMsg + n, sizeof(cloudMsg) - n, " %s", currentDisplayState.tertiaryDisplay);
   }
 
   // Solo actualizamos la variable si ha cambiado para no saturar el tráfico
@@ -118,7 +234,8 @@ void printToAll(const String &message) {
     display.setCursor(0, ALTO - 8);
     display.print(ipAddressLine);
   }
-  display.display();
+  display_request_push();
+  display_push_now();
 
   // Nube
   cloud_display = "[INFO] " + message;
@@ -144,7 +261,8 @@ void updateOledStatus(const String &message) {
     display.setCursor(0, ALTO - 8);
     display.print(ipAddressLine);
   }
-  display.display();
+  display_request_push();
+  display_push_now();
 
   // Nube
   // Enviamos el mensaje directo a la nube
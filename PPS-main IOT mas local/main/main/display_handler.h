@@ -5,11 +5,14 @@
 
 // Definición de la estructura de estado para la pantalla
 // ESTE ES EL ÚNICO LUGAR DONDE DEBE ESTAR ESTA DEFINICIÓN
+// Buffers de tamaño fijo: una línea de texto tamaño 1 ocupa 21 caracteres.
+#define DISPLAY_TEXT_LEN 22
+
 struct DisplayState {
-  String moduleName;
-  String primaryDisplay;
-  String secondaryDisplay;
-  String tertiaryDisplay;
+  char moduleName[DISPLAY_TEXT_LEN];
+  char primaryDisplay[DISPLAY_TEXT_LEN];     // Ya formateado (ver freq_format.h)
+  char secondaryDisplay[DISPLAY_TEXT_LEN];
+  char tertiaryDisplay[DISPLAY_TEXT_LEN];
 };
 
 // Declaración "extern" para que otros archivos sepan que esta variable global existe
@@ -23,9 +26,22 @@ bool display_setup();
 
 /**
  * @brief Dibuja la pantalla principal de estado general del instrumento.
+ * Los manejadores de comandos no deben llamarla: usan display_mark_dirty().
  */
 void showMainScreen();
 
+/**
+ * @brief Indica que currentDisplayState cambió. Solo levanta una bandera;
+ * el dibujo lo hace display_service().
+ */
+void display_mark_dirty();
+
+/**
+ * @brief Consumidor del estado de pantalla. Llamar en cada loop(): redibuja
+ * si hubo cambios, como máximo DISPLAY_MAX_FPS veces por segundo.
+ */
+void display_service();
+
 /**
  * @brief Muestra un mensaje temporal simple en toda la pantalla y en el monitor serie.
  * @param message El mensaje a mostrar.
@@ -38,4 +54,31 @@ void printToAll(const String &message);
  */
 void updateOledStatus(const String &message);
 
+/**
+ * @brief Costo en el bus del último refresco (solo páginas/columnas que cambiaron).
+ */
+struct DisplayFrameStats {
+  uint32_t bytes;
+  uint32_t us;
+};
+
+/**
+ * @brief Compara el framebuffer con lo ya enviado y encola solo las zonas cambiadas.
+ * El envío lo hace i2c_bus_service() en segundo plano.
+ */
+void display_request_push();
+
+/**
+ * @brief Envía el siguiente trozo pendiente del framebuffer.
+ * @return true si quedan trozos por enviar.
+ */
+bool display_push_step();
+
+/**
+ * @brief Envía de inmediato todo lo pendiente (mensajes de arranque, avisos).
+ */
+void display_push_now();
+
+const DisplayFrameStats& display_last_frame_stats();
+
 #endif // DISPLAY_HANDLER_H
\ No newline at end of file
@@ -0,0 +1,67 @@
+#ifndef FREQ_FORMAT_H
+#define FREQ_FORMAT_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+// ==========================================================
+// FORMATEO DE FRECUENCIAS SIN STRING NI COMA FLOTANTE
+// ==========================================================
+// Convierte una frecuencia entera en Hz a texto en la unidad pedida,
+// redondeando al número de decimales indicado. Los decimales se agrupan
+// de a tres con un espacio: 1234567890 Hz en MHz con 6 decimales da
+// "1234.567 890 MHz". Todo es aritmética entera de 64 bits, así que los
+// valores en GHz no pierden precisión. No depende de Arduino.
+
+#define FREQ_UNIT_HZ   0
+#define FREQ_UNIT_KHZ  3
+#define FREQ_UNIT_MHZ  6
+#define FREQ_UNIT_GHZ  9
+
+/**
+ * @brief Escribe la frecuencia formateada en 'out' (siempre terminada en '\0').
+ * @param unit_pow10 FREQ_UNIT_HZ, FREQ_UNIT_KHZ, FREQ_UNIT_MHZ o FREQ_UNIT_GHZ.
+ * @param decimals Decimales a mostrar (se limita a unit_pow10: no hay fracciones de Hz).
+ * @return Longitud del texto escrito (truncado a cap - 1).
+ */
+inline size_t format_frequency(char* out, size_t cap, uint64_t hz,
+                               uint8_t unit_pow10, uint8_t decimals) {
+  static const char* const UNIT_NAMES[] = {"Hz", "kHz", "MHz", "GHz"};
+  if (cap == 0) return 0;
+  if (decimals > unit_pow10) decimals = unit_pow10;
+
+  uint64_t drop = 1;     // 10^(unit_pow10 - decimals): dígitos que se redondean
+  for (uint8_t i = decimals; i < unit_pow10; i++) drop *= 10;
+  uint64_t frac_div = 1; // 10^decimals
+  for (uint8_t i = 0; i < decimals; i++) frac_div *= 10;
+
+  uint64_t q = (hz + drop / 2) / drop;
+  uint64_t int_part = q / frac_div;
+  uint64_t frac_part = q % frac_div;
+
+  char tmp[40];
+  size_t n = 0;
+  char rev[20];
+  int nd = 0;
+  do { rev[nd++] = '0' + (int)(int_part % 10); int_part /= 10; } while (int_part);
+  while (nd) tmp[n++] = rev[--nd];
+
+  if (decimals) {
+    char frac[9];
+    for (int i = decimals - 1; i >= 0; i--) { frac[i] = '0' + (int)(frac_part % 10); frac_part /= 10; }
+    tmp[n++] = '.';
+    for (uint8_t i = 0; i < decimals; i++) {
+      if (i && i % 3 == 0) tmp[n++] = ' ';
+      tmp[n++] = frac[i];
+    }
+  }
+  tmp[n++] = ' ';
+  for (const char* u = UNIT_NAMES[unit_pow10 / 3]; *u; u++) tmp[n++] = *u;
+
+  if (n > cap - 1) n = cap - 1;
+  for (size_t i = 0; i < n; i++) out[i] = tmp[i];
+  out[n] = '\0';
+  return n;
+}
+
+#endif // FREQ_FORMAT_H
@@ -0,0 +1,59 @@
+#include <benchmark/benchmark.h>
+#include <ArduinoJson.h>
+#include "latency_metrics.h"
+#include "main_interface.h"
+
+// enviarRespuesta() está en mocks/firmware_globals.cpp: solo guarda la última
+// respuesta, así que se mide lo que cuesta armarla
+static const char* const COMMANDS[] = {
+  "{\"accion\":\"vfo_command\",\"sub_accion\":\"set_freq\",\"frecuencia_hz\":7100000}",
+  "{\"accion\":\"adf4351_command\",\"sub_accion\":\"set_freq\",\"frecuencia_hz\":2400000000}",
+  "{\"accion\":\"ad9850_command\",\"sub_accion\":\"play_list\","
+  "\"frecuencias_hz\":[1000000,2000000,3000000,4000000,5000000,6000000],\"repeticiones\":4}",
+  "{\"accion\":\"estadisticas_ws\"}",
+};
+static const size_t NUM_COMMANDS = sizeof(COMMANDS) / sizeof(COMMANDS[0]);
+
+// ==========================================================
+// DESPACHO DE COMANDOS JSON
+// ==========================================================
+
+// Lo que hace webSocketEvent() antes del handler: parseo en el documento
+// global y búsqueda del comando en la tabla de latency_metrics
+static void BM_ParseAndRoute(benchmark::State& state) {
+  StaticJsonDocument<512> doc;   // Mismo tamaño que el documento de main.ino
+  size_t i = 0;
+  for (auto _ : state) {
+    DeserializationError err = deserializeJson(doc, COMMANDS[i]);
+    benchmark::DoNotOptimize(err);
+    benchmark::DoNotOptimize(metrics_command_index(doc["accion"] | ""));
+    if (++i == NUM_COMMANDS) i = 0;
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_ParseAndRoute);
+
+// Respuesta de "metrics" con todos los histogramas poblados: el documento
+// más grande que arma el firmware (ver METRICS_DOC_SIZE)
+static void BM_MetricsReport(benchmark::State& state) {
+  static const char* const names[] = {
+    "vfo_command", "ad9850_command", "adf4351_command", "memory_command", "select_oscillator",
+    "oled_command", "escanear_i2c", "transaccion_i2c", "script_i2c", "desconocido",
+  };
+  for (const char* n : names) {
+    metrics_begin_command(n);
+    for (uint8_t s = 0; s < METRIC_STAGE_COUNT; s++) {
+      for (uint32_t k = 1; k < 20000; k *= 3) metrics_record((MetricStage)s, k * getCpuFrequencyMhz());
+    }
+    metrics_end_command();
+  }
+  for (uint8_t s = 0; s < METRIC_STAGE_COUNT; s++) metrics_record((MetricStage)s, 100 * getCpuFrequencyMhz());
+
+  StaticJsonDocument<64> request;
+  request["accion"] = "metrics";
+  for (auto _ : state) {
+    handle_metrics_command(0, request);
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_MetricsReport);
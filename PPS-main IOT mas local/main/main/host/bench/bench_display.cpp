@@ -0,0 +1,77 @@
+#include <benchmark/benchmark.h>
+#include <stdio.h>
+#include "freq_format.h"
+#include "display_handler.h"
+#include "../legacy/format_legacy.h"
+
+// ==========================================================
+// FORMATEO DE LA PANTALLA
+// ==========================================================
+// Los mismos llamados que hacen updateDisplay*State() en cada cambio.
+
+static void BM_FormatFrequency(benchmark::State& state) {
+  uint8_t unit = (uint8_t)state.range(0);
+  uint8_t decimals = (uint8_t)state.range(1);
+  char buf[DISPLAY_TEXT_LEN];
+  uint64_t hz = 1234567890ULL;
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(format_frequency(buf, sizeof(buf), hz, unit, decimals));
+    hz += 1000;
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_FormatFrequency)
+    ->Args({FREQ_UNIT_KHZ, 3})
+    ->Args({FREQ_UNIT_MHZ, 3})
+    ->Args({FREQ_UNIT_MHZ, 6})
+    ->Args({FREQ_UNIT_GHZ, 3});
+
+// Camino anterior: String(double, 4) + unidad y reformateo vía float
+static void BM_FormatFrequencyLegacyString(benchmark::State& state) {
+  uint64_t hz = 1234567890ULL;
+  for (auto _ : state) {
+    String s = formatAdf4351Legacy(hz);
+    benchmark::DoNotOptimize(s.c_str());
+    hz += 1000;
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_FormatFrequencyLegacyString);
+
+// Las cuatro líneas del ADF4351 (updateDisplayAdf4351State)
+static void BM_DisplayLinesAdf4351(benchmark::State& state) {
+  DisplayState ds;
+  static const char* const powerLevels[] = {"-4dBm", "-1dBm", "+2dBm", "+5dBm"};
+  uint64_t hz = 2400000000ULL;
+  for (auto _ : state) {
+    snprintf(ds.moduleName, DISPLAY_TEXT_LEN, "ADF4351 (%s)", "ON");
+    uint8_t unit = (hz >= 1000000000ULL) ? FREQ_UNIT_GHZ : FREQ_UNIT_MHZ;
+    format_frequency(ds.primaryDisplay, DISPLAY_TEXT_LEN, hz, unit, 3);
+    snprintf(ds.secondaryDisplay, DISPLAY_TEXT_LEN, "Pot: %s", powerLevels[3]);
+    snprintf(ds.tertiaryDisplay, DISPLAY_TEXT_LEN, "Salida: %s", "ON");
+    benchmark::DoNotOptimize(&ds);
+    benchmark::ClobberMemory();
+    hz += 1000;
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_DisplayLinesAdf4351);
+
+// Las mismas líneas con las concatenaciones de String de antes
+static void BM_DisplayLinesAdf4351LegacyString(benchmark::State& state) {
+  static const char* const powerLevels[] = {"-4dBm", "-1dBm", "+2dBm", "+5dBm"};
+  uint64_t hz = 2400000000ULL;
+  for (auto _ : state) {
+    String moduleName = "ADF4351 (" + String("ON") + ")";
+    String primary = formatAdf4351Legacy(hz);
+    String secondary = "Pot: " + String(powerLevels[3]);
+    String tertiary = "Salida: " + String("ON");
+    benchmark::DoNotOptimize(moduleName.c_str());
+    benchmark::DoNotOptimize(primary.c_str());
+    benchmark::DoNotOptimize(secondary.c_str());
+    benchmark::DoNotOptimize(tertiary.c_str());
+    hz += 1000;
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_DisplayLinesAdf4351LegacyString);
@@ -0,0 +1,184 @@
+#include <benchmark/benchmark.h>
+#include <vector>
+#include "hal_mock.h"
+#include "adf4351_plan.h"
+#include "adf4351_bus.h"
+#include "ad9850_encoder.h"
+#include "si5351_plan.h"
+#include "si5351_tuner.h"
+#include "i2c_bus.h"
+#include "config.h"
+#include "../legacy/adf4351_legacy.h"
+#include "../legacy/ad9850_legacy.h"
+
+// Frecuencias repartidas por todo el rango: cada iteración cambia de divisor
+static std::vector<uint64_t> adf4351Sweep() {
+  std::vector<uint64_t> f;
+  for (uint64_t hz = ADF4351_MIN_FREQ; hz <= ADF4351_MAX_FREQ; hz += 17000017ULL) f.push_back(hz);
+  return f;
+}
+
+static std::vector<uint64_t> si5351Sweep(uint64_t from_hz, uint64_t to_hz, uint64_t step_hz) {
+  std::vector<uint64_t> f;
+  for (uint64_t hz = from_hz; hz <= to_hz; hz += step_hz) f.push_back(hz);
+  return f;
+}
+
+static std::vector<uint32_t> ad9850Sweep() {
+  std::vector<uint32_t> f;
+  for (uint32_t hz = 0; hz <= AD9850_MAX_FREQ; hz += 156257) f.push_back(hz);
+  return f;
+}
+
+// ==========================================================
+// PLANIFICACIÓN DE REGISTROS (ADF4351)
+// ==========================================================
+
+static void BM_Adf4351Plan(benchmark::State& state) {
+  std::vector<uint64_t> freqs = adf4351Sweep();
+  uint32_t regs[6];
+  size_t i = 0;
+  for (auto _ : state) {
+    adf4351_plan_registers(freqs[i], ADF4351_REF_CLK_HZ, 3, true, regs);
+    benchmark::DoNotOptimize(regs);
+    if (++i == freqs.size()) i = 0;
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_Adf4351Plan);
+
+static void BM_Adf4351PlanLegacy(benchmark::State& state) {
+  std::vector<uint64_t> freqs = adf4351Sweep();
+  uint32_t regs[6];
+  size_t i = 0;
+  for (auto _ : state) {
+    adf4351_plan_registers_legacy(freqs[i], ADF4351_REF_CLK_HZ, 3, true, regs);
+    benchmark::DoNotOptimize(regs);
+    if (++i == freqs.size()) i = 0;
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_Adf4351PlanLegacy);
+
+// Planificación + trama SPI contra el HAL simulado. "bus_us" es el tiempo
+// que la trama ocupa en el hardware según el modelo (delays y bytes de SPI):
+// si alguien agrega esperas al camino de escritura, sube aquí.
+static void BM_Adf4351Retune(benchmark::State& state) {
+  hal_mock_reset();
+  hal_mock_record(false);
+  adf4351_bus_begin();
+  std::vector<uint64_t> freqs = adf4351Sweep();
+  uint32_t regs[6];
+  size_t i = 0;
+  uint64_t t0 = hal_mock_now_ns();
+  for (auto _ : state) {
+    adf4351_plan_registers(freqs[i], ADF4351_REF_CLK_HZ, 3, true, regs);
+    adf4351_bus_write(regs);
+    if (++i == freqs.size()) i = 0;
+  }
+  state.counters["bus_us"] = (double)(hal_mock_now_ns() - t0) / 1000.0 / state.iterations();
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_Adf4351Retune);
+
+// ==========================================================
+// PLANIFICACIÓN DE REGISTROS (Si5351)
+// ==========================================================
+
+static const uint64_t SI5351_XTAL_MHZ = SI5351_CRYSTAL_FREQ * 1000ULL;
+
+// Todo el rango: pasa por PLL fijo, MS entero y DIVBY4
+static void BM_Si5351PlanClock(benchmark::State& state) {
+  std::vector<uint64_t> freqs = si5351Sweep(SI5351_TUNER_MIN_HZ, SI5351_TUNER_MAX_HZ, 1000003);
+  Si5351PlanShape shape;
+  uint8_t pll[8], ms[8];
+  size_t i = 0;
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(si5351_plan_clock(freqs[i], SI5351_XTAL_MHZ, shape, pll, ms));
+    benchmark::ClobberMemory();
+    if (++i == freqs.size()) i = 0;
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_Si5351PlanClock);
+
+// Pasos de 1 kHz en 40 m: el divisor vigente se reutiliza
+static void BM_Si5351PlanIq(benchmark::State& state) {
+  std::vector<uint64_t> freqs = si5351Sweep(7000000, 7300000, 1000);
+  Si5351PlanShape shape = {SI5351_PLAN_NONE, 0, 0};
+  uint8_t pll[8], ms[8];
+  size_t i = 0;
+  for (auto _ : state) {
+    Si5351PlanShape current = shape;
+    benchmark::DoNotOptimize(si5351_plan_iq(freqs[i], SI5351_XTAL_MHZ, current, shape, pll, ms));
+    benchmark::ClobberMemory();
+    if (++i == freqs.size()) i = 0;
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_Si5351PlanIq);
+
+// Retune completo del tuner contra el chip simulado. "bus_us" y "i2c_bytes"
+// son el costo en el bus por paso según el modelo: con pasos chicos solo
+// cambian unos pocos registros del MS.
+static void BM_Si5351Retune(benchmark::State& state) {
+  hal_mock_reset();
+  hal_mock_record(false);
+  hal_mock_i2c_attach(SI5351_ADDR);
+  i2c_bus_begin();
+  si5351_tuner_begin(0);
+  std::vector<uint64_t> freqs = si5351Sweep(7000000, 7300000, (uint64_t)state.range(0));
+  size_t i = 0;
+  uint64_t t0 = hal_mock_now_ns();
+  uint64_t bytes = 0;
+  for (auto _ : state) {
+    si5351_tuner_set_freq(freqs[i]);
+    bytes += si5351_tuner_last_stats().bytes;
+    if (++i == freqs.size()) i = 0;
+  }
+  state.counters["bus_us"] = (double)(hal_mock_now_ns() - t0) / 1000.0 / state.iterations();
+  state.counters["i2c_bytes"] = (double)bytes / state.iterations();
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_Si5351Retune)->Arg(10)->Arg(1000)->Arg(100000);
+
+// ==========================================================
+// PALABRA DE SINTONÍA (AD9850)
+// ==========================================================
+
+static void BM_Ad9850TuningWord(benchmark::State& state) {
+  std::vector<uint32_t> freqs = ad9850Sweep();
+  size_t i = 0;
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(ad9850_tuning_word(freqs[i], (uint32_t)AD9850_CLK_FREQ));
+    if (++i == freqs.size()) i = 0;
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_Ad9850TuningWord);
+
+static void BM_Ad9850TuningWordLegacy(benchmark::State& state) {
+  std::vector<uint32_t> freqs = ad9850Sweep();
+  size_t i = 0;
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(ad9850_tuning_word_legacy(freqs[i], AD9850_CLK_FREQ));
+    if (++i == freqs.size()) i = 0;
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_Ad9850TuningWordLegacy);
+
+// Palabra + tren de muestras que play_list escribe en los registros GPIO
+static void BM_Ad9850EncodeWord(benchmark::State& state) {
+  std::vector<uint32_t> freqs = ad9850Sweep();
+  uint8_t samples[AD9850_SAMPLES_PER_WORD];
+  size_t i = 0;
+  for (auto _ : state) {
+    uint32_t w = ad9850_tuning_word(freqs[i], (uint32_t)AD9850_CLK_FREQ);
+    benchmark::DoNotOptimize(ad9850_encode_word(w, 0x00, samples));
+    benchmark::ClobberMemory();
+    if (++i == freqs.size()) i = 0;
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_Ad9850EncodeWord);
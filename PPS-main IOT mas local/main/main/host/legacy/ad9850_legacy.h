@@ -0,0 +1,11 @@
+#ifndef AD9850_LEGACY_H
+#define AD9850_LEGACY_H
+
+#include <stdint.h>
+
+// Fórmula anterior de send_frequency() (double), antes de ad9850_encoder.h
+inline uint32_t ad9850_tuning_word_legacy(uint32_t frequency, double clk_freq) {
+  return (uint32_t)((double)frequency * 4294967296.0 / clk_freq);
+}
+
+#endif // AD9850_LEGACY_H
@@ -0,0 +1,57 @@
+#ifndef ADF4351_LEGACY_H
+#define ADF4351_LEGACY_H
+
+#include <stdint.h>
+
+// ==========================================================
+// PLANIFICADOR ANTERIOR DEL ADF4351 (REFERENCIA)
+// ==========================================================
+// Cuerpo de prepare_registers() tal como estaba en adf4351_handler.cpp
+// antes de pasar a adf4351_plan.h, con adf_state convertido en
+// parámetros. Solo se usa para comprobar que el planificador nuevo da los
+// mismos registros y para compararlos en los benchmarks.
+
+#define LEGACY_SHL(x, y) ((uint32_t)(x) << (y))
+
+inline void adf4351_plan_registers_legacy(unsigned long long frequency_hz, uint32_t pfd_freq,
+                                          uint8_t out_power, bool rf_enabled, uint32_t registers[6]) {
+    uint8_t rf_div_sel = 0;
+    if(frequency_hz >= 2200000000ULL) rf_div_sel = 0;
+    else if(frequency_hz >= 1100000000ULL) rf_div_sel = 1;
+    else if(frequency_hz >= 550000000ULL) rf_div_sel = 2;
+    else if(frequency_hz >= 275000000ULL) rf_div_sel = 3;
+    else if(frequency_hz >= 137500000ULL) rf_div_sel = 4;
+    else if(frequency_hz >= 68750000ULL) rf_div_sel = 5;
+    else rf_div_sel = 6;
+
+    // Calcular frecuencia VCO
+    double vco_freq = (double)frequency_hz * (1ULL << rf_div_sel);
+
+    uint8_t prescaler = 0;
+    if (vco_freq >= 3600000000.0) {
+        prescaler = 1; // Modo 8/9 para VCO >= 3.6 GHz
+    } else {
+        prescaler = 0; // Modo 4/5 para VCO < 3.6 GHz
+    }
+
+    // Calcular INT, MOD y FRAC
+    uint32_t INT = (uint32_t)(vco_freq / pfd_freq);
+    uint16_t MOD = 4095;
+    double frac_part = (vco_freq / (double)pfd_freq) - INT;
+    uint16_t FRAC = (uint16_t)(frac_part * MOD + 0.5);
+
+    registers[0] = LEGACY_SHL(INT, 15) | LEGACY_SHL(FRAC, 3) | 0b000;
+    registers[1] = LEGACY_SHL(0, 28) | LEGACY_SHL(prescaler, 27) | LEGACY_SHL(1, 15) | LEGACY_SHL(MOD, 3) | 0b001;
+    registers[2] = LEGACY_SHL(0, 29) | LEGACY_SHL(6, 26) | LEGACY_SHL(0, 25) | LEGACY_SHL(0, 24) |
+                   LEGACY_SHL(1, 14) | LEGACY_SHL(0, 13) | LEGACY_SHL(7, 9) | LEGACY_SHL(1, 8) |
+                   LEGACY_SHL(0, 7) | LEGACY_SHL(1, 6) | LEGACY_SHL(0, 5) | LEGACY_SHL(0, 4) | 0b010;
+    registers[3] = LEGACY_SHL(0, 23) | LEGACY_SHL(0, 22) | LEGACY_SHL(0, 21) | LEGACY_SHL(0, 18) |
+                   LEGACY_SHL(0, 15) | LEGACY_SHL(150, 3) | 0b011;
+    registers[4] = LEGACY_SHL(1, 23) | LEGACY_SHL(rf_div_sel, 20) | LEGACY_SHL(250, 12) |
+                   LEGACY_SHL(0, 11) | LEGACY_SHL(1, 10) | LEGACY_SHL(0, 9) | LEGACY_SHL(0, 8) |
+                   LEGACY_SHL(0, 6) | LEGACY_SHL(rf_enabled, 5) |
+                   LEGACY_SHL(out_power, 3) | 0b100;
+    registers[5] = LEGACY_SHL(1, 22) | LEGACY_SHL(0b11, 19) | 0b101;
+}
+
+#endif // ADF4351_LEGACY_H
@@ -0,0 +1,35 @@
+#ifndef FORMAT_LEGACY_H
+#define FORMAT_LEGACY_H
+
+#include <Arduino.h>
+
+// ==========================================================
+// FORMATEO ANTERIOR CON String (REFERENCIA)
+// ==========================================================
+// Camino previo a freq_format.h: updateDisplayAdf4351State() armaba el
+// texto con String(double, 4) y display_handler.cpp lo volvía a parsear a
+// float en formatNumericString() para dejarlo con 3 decimales.
+
+// display_handler.cpp, tal como estaba
+inline String formatNumericString(const String &inputStr) {
+  int spaceIndex = inputStr.indexOf(' ');
+  if (spaceIndex <= 0) return inputStr;
+
+  String numberPart = inputStr.substring(0, spaceIndex);
+  String unitPart = inputStr.substring(spaceIndex);
+  float value = numberPart.toFloat();
+  return String(value, 3) + unitPart;
+}
+
+// Línea principal del ADF4351 (adf4351_handler.cpp + display_handler.cpp)
+inline String formatAdf4351Legacy(unsigned long long frequency_hz) {
+  String freq_str;
+  if (frequency_hz >= 1000000000ULL) {
+    freq_str = String(frequency_hz / 1000000000.0, 4) + " GHz";
+  } else {
+    freq_str = String(frequency_hz / 1000000.0, 4) + " MHz";
+  }
+  return formatNumericString(freq_str);
+}
+
+#endif // FORMAT_LEGACY_H
@@ -0,0 +1,61 @@
+#ifndef HOST_MOCK_ADAFRUIT_GFX_H
+#define HOST_MOCK_ADAFRUIT_GFX_H
+
+#include <Arduino.h>
+
+// Primitivas de Adafruit_GFX con las mismas reglas de la fuente clásica:
+// cada carácter ocupa 6x8 píxeles por tamaño, con salto de línea en '\n' y
+// al llegar al borde. No es la fuente real: cada carácter dibuja 5 columnas
+// derivadas de su código. Alcanza para que un texto distinto cambie otros
+// bytes del framebuffer y para que getTextBounds() mida lo mismo.
+
+class Adafruit_GFX {
+public:
+  Adafruit_GFX(int16_t w, int16_t h) : width_(w), height_(h) {}
+  virtual ~Adafruit_GFX() {}
+
+  virtual void drawPixel(int16_t x, int16_t y, uint16_t color) = 0;
+
+  void drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color);
+  void drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color);
+  void drawLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t color);
+  void drawCircle(int16_t x0, int16_t y0, int16_t r, uint16_t color);
+  void fillCircle(int16_t x0, int16_t y0, int16_t r, uint16_t color);
+  void fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color);
+
+  void setCursor(int16_t x, int16_t y) { cursor_x_ = x; cursor_y_ = y; }
+  void setTextSize(uint8_t s) { text_size_ = s ? s : 1; }
+  void setTextColor(uint16_t c) { text_color_ = c; }
+  void setTextWrap(bool w) { wrap_ = w; }
+  int16_t getCursorX() const { return cursor_x_; }
+  int16_t getCursorY() const { return cursor_y_; }
+  int16_t width() const { return width_; }
+  int16_t height() const { return height_; }
+
+  void getTextBounds(const char* str, int16_t x, int16_t y, int16_t* x1, int16_t* y1, uint16_t* w, uint16_t* h);
+  void getTextBounds(const String& str, int16_t x, int16_t y, int16_t* x1, int16_t* y1, uint16_t* w, uint16_t* h) {
+    getTextBounds(str.c_str(), x, y, x1, y1, w, h);
+  }
+
+  size_t write(uint8_t c);
+  size_t print(const char* s);
+  size_t print(const String& s) { return print(s.c_str()); }
+  size_t print(int v) { return print(String(v)); }
+  size_t print(long v) { return print(String(v)); }
+  size_t print(unsigned long v) { return print(String(v)); }
+  size_t println() { return write('\n'); }
+  template <typename T>
+  size_t println(const T& v) { size_t n = print(v); return n + write('\n'); }
+
+protected:
+  int16_t width_, height_;
+  int16_t cursor_x_ = 0, cursor_y_ = 0;
+  uint8_t text_size_ = 1;
+  uint16_t text_color_ = 1;
+  bool wrap_ = true;
+
+private:
+  void drawChar(int16_t x, int16_t y, unsigned char c, uint16_t color, uint8_t size);
+};
+
+#endif // HOST_MOCK_ADAFRUIT_GFX_H
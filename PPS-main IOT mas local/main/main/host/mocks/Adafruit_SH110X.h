@@ -0,0 +1,31 @@
+#ifndef HOST_MOCK_ADAFRUIT_SH110X_H
+#define HOST_MOCK_ADAFRUIT_SH110X_H
+
+#include <vector>
+#include <Wire.h>
+#include "Adafruit_GFX.h"
+
+// SH1106G con el framebuffer de la librería (una página = 8 filas, un byte
+// por columna, bit 0 arriba). begin() manda la secuencia de inicio por Wire
+// al dispositivo conectado en el HAL simulado y falla si no responde.
+
+#define SH110X_BLACK   0
+#define SH110X_WHITE   1
+#define SH110X_INVERSE 2
+
+class Adafruit_SH1106G : public Adafruit_GFX {
+public:
+  Adafruit_SH1106G(uint16_t w, uint16_t h, TwoWire* twi = &Wire, int8_t rst_pin = -1,
+                   uint32_t preclk = 400000, uint32_t postclk = 100000);
+
+  bool begin(uint8_t i2caddr = 0x3C, bool reset = true);
+  void clearDisplay();
+  uint8_t* getBuffer() { return buffer_.data(); }
+  void drawPixel(int16_t x, int16_t y, uint16_t color) override;
+
+private:
+  TwoWire* wire_;
+  std::vector<uint8_t> buffer_;
+};
+
+#endif // HOST_MOCK_ADAFRUIT_SH110X_H
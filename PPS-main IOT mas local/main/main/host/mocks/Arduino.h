@@ -0,0 +1,152 @@
+#ifndef HOST_MOCK_ARDUINO_H
+#define HOST_MOCK_ARDUINO_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <ctype.h>
+#include <string>
+
+// ==========================================================
+// Arduino.h SIMULADO (SOLO PARA host/)
+// ==========================================================
+// Lo mínimo que usan los módulos que se compilan en el PC. Los pines y el
+// tiempo van al HAL simulado (hal_mock.h); String guarda el texto en el
+// heap como el de Arduino, así los benchmarks miden el mismo tipo de costo.
+
+typedef uint8_t byte;
+typedef bool boolean;
+
+#define LOW               0x0
+#define HIGH              0x1
+#define INPUT             0x01
+#define OUTPUT            0x03
+#define INPUT_PULLUP      0x05
+#define OUTPUT_OPEN_DRAIN 0x13
+
+#define IRAM_ATTR
+#define F(s) (s)
+
+void pinMode(uint8_t pin, uint8_t mode);
+void digitalWrite(uint8_t pin, uint8_t val);
+int digitalRead(uint8_t pin);
+
+uint32_t millis();
+uint32_t micros();
+void delay(uint32_t ms);
+void delayMicroseconds(uint32_t us);
+
+uint32_t getCpuFrequencyMhz();
+
+class EspClass {
+public:
+  uint32_t getCycleCount();   // Ciclos de una CPU a getCpuFrequencyMhz() según el reloj real
+  uint32_t getFreeHeap() { return 200000; }
+};
+extern EspClass ESP;
+
+class String {
+public:
+  String(const char* s = "") : s_(s ? s : "") {}
+  String(const String&) = default;
+  String(String&&) = default;
+  explicit String(char c) : s_(1, c) {}
+  String(int v) : s_(std::to_string(v)) {}
+  String(unsigned int v) : s_(std::to_string(v)) {}
+  String(long v) : s_(std::to_string(v)) {}
+  String(unsigned long v) : s_(std::to_string(v)) {}
+  String(long long v) : s_(std::to_string(v)) {}
+  String(unsigned long long v) : s_(std::to_string(v)) {}
+  String(float v, unsigned char decimals = 2) : s_(fixed(v, decimals)) {}
+  String(double v, unsigned char decimals = 2) : s_(fixed(v, decimals)) {}
+
+  String& operator=(const String&) = default;
+  String& operator=(String&&) = default;
+  String& operator=(const char* s) { s_ = s ? s : ""; return *this; }
+
+  unsigned int length() const { return (unsigned int)s_.size(); }
+  const char* c_str() const { return s_.c_str(); }
+  bool reserve(unsigned int n) { s_.reserve(n); return true; }
+  char operator[](unsigned int i) const { return i < s_.size() ? s_[i] : '\0'; }
+  char charAt(unsigned int i) const { return (*this)[i]; }
+
+  int indexOf(char c, unsigned int from = 0) const {
+    size_t p = s_.find(c, from);
+    return p == std::string::npos ? -1 : (int)p;
+  }
+  String substring(unsigned int from) const { return substring(from, length()); }
+  String substring(unsigned int from, unsigned int to) const {
+    if (from > to) { unsigned int t = from; from = to; to = t; }
+    if (from >= s_.size()) return String();
+    return String(s_.substr(from, to - from).c_str());
+  }
+  bool startsWith(const String& p) const { return s_.compare(0, p.s_.size(), p.s_) == 0; }
+  bool endsWith(const String& p) const {
+    return s_.size() >= p.s_.size() && s_.compare(s_.size() - p.s_.size(), p.s_.size(), p.s_) == 0;
+  }
+  float toFloat() const { return (float)atof(s_.c_str()); }
+  double toDouble() const { return atof(s_.c_str()); }
+  long toInt() const { return atol(s_.c_str()); }
+
+  void trim() {
+    size_t a = s_.find_first_not_of(" \t\r\n");
+    size_t b = s_.find_last_not_of(" \t\r\n");
+    s_ = (a == std::string::npos) ? std::string() : s_.substr(a, b - a + 1);
+  }
+  void toLowerCase() { for (char& ch : s_) ch = (char)tolower((unsigned char)ch); }
+  void toUpperCase() { for (char& ch : s_) ch = (char)toupper((unsigned char)ch); }
+  void remove(unsigned int index) { if (index < s_.size()) s_.erase(index); }
+  void remove(unsigned int index, unsigned int count) { if (index < s_.size()) s_.erase(index, count); }
+
+  bool concat(const char* s) { s_ += s; return true; }
+  bool concat(const char* s, unsigned int n) { s_.append(s, n); return true; }
+  bool concat(const String& s) { s_ += s.s_; return true; }
+  bool concat(char c) { s_ += c; return true; }
+  String& operator+=(const String& s) { concat(s); return *this; }
+  String& operator+=(const char* s) { concat(s); return *this; }
+  String& operator+=(char c) { concat(c); return *this; }
+
+  bool operator==(const String& o) const { return s_ == o.s_; }
+  bool operator==(const char* o) const { return s_ == (o ? o : ""); }
+  bool operator!=(const String& o) const { return !(*this == o); }
+  bool operator!=(const char* o) const { return !(*this == o); }
+
+private:
+  static std::string fixed(double v, unsigned char decimals) {
+    char buf[48];
+    snprintf(buf, sizeof(buf), "%.*f", decimals, v);
+    return buf;
+  }
+  std::string s_;
+};
+
+// Arduino devuelve este tipo en las concatenaciones; ArduinoJson lo nombra
+class StringSumHelper : public String {
+public:
+  StringSumHelper(const String& s) : String(s) {}
+};
+
+inline StringSumHelper operator+(const String& a, const String& b) { String r(a); r += b; return r; }
+inline StringSumHelper operator+(const String& a, const char* b) { String r(a); r += b; return r; }
+inline StringSumHelper operator+(const char* a, const String& b) { String r(a); r += b; return r; }
+
+class HardwareSerial {
+public:
+  void begin(unsigned long) {}
+  int printf(const char* fmt, ...) __attribute__((format(printf, 2, 3)));
+  size_t print(const char* s);
+  size_t print(const String& s) { return print(s.c_str()); }
+  size_t print(long v) { return print(String(v)); }
+  size_t print(unsigned long v) { return print(String(v)); }
+  size_t print(int v) { return print(String(v)); }
+  size_t print(unsigned int v) { return print(String(v)); }
+  size_t println() { return print("\n"); }
+  template <typename T>
+  size_t println(const T& v) { size_t n = print(v); return n + print("\n"); }
+};
+extern HardwareSerial Serial;
+
+#endif // HOST_MOCK_ARDUINO_H
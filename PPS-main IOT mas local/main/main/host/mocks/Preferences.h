@@ -0,0 +1,28 @@
+#ifndef HOST_MOCK_PREFERENCES_H
+#define HOST_MOCK_PREFERENCES_H
+
+#include <Arduino.h>
+
+// NVS en memoria: sobrevive entre objetos Preferences (como en el chip)
+// y se vacía con hal_mock_reset().
+
+class Preferences {
+public:
+  bool begin(const char* name, bool readOnly = false);
+  void end() { open_ = false; }
+  bool clear();
+  bool remove(const char* key);
+  bool isKey(const char* key);
+  size_t putInt(const char* key, int32_t value);
+  int32_t getInt(const char* key, int32_t defaultValue = 0);
+  size_t putBytes(const char* key, const void* value, size_t len);
+  size_t getBytes(const char* key, void* buf, size_t maxLen);
+  size_t getBytesLength(const char* key);
+
+private:
+  std::string ns_;
+  bool open_ = false;
+  bool read_only_ = false;
+};
+
+#endif // HOST_MOCK_PREFERENCES_H
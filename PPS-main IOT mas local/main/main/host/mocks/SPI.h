@@ -0,0 +1,34 @@
+#ifndef HOST_MOCK_SPI_H
+#define HOST_MOCK_SPI_H
+
+#include <Arduino.h>
+
+// SPI simulado: cada byte transferido queda en el registro de eventos
+// (HAL_SPI_BYTE) y avanza el reloj 8 bits al reloj configurado.
+
+#define SPI_MODE0  0
+#define SPI_MODE1  1
+#define SPI_MODE2  2
+#define SPI_MODE3  3
+#define LSBFIRST   0
+#define MSBFIRST   1
+
+class SPIClass {
+public:
+  void begin(int8_t sck = -1, int8_t miso = -1, int8_t mosi = -1, int8_t ss = -1);
+  void end() {}
+  void setDataMode(uint8_t mode) { mode_ = mode; }
+  void setBitOrder(uint8_t order) { bit_order_ = order; }
+  void setFrequency(uint32_t hz);
+  uint8_t transfer(uint8_t data);
+
+  uint8_t dataMode() const { return mode_; }
+  uint8_t bitOrder() const { return bit_order_; }
+
+private:
+  uint8_t mode_ = SPI_MODE0;
+  uint8_t bit_order_ = MSBFIRST;
+};
+extern SPIClass SPI;
+
+#endif // HOST_MOCK_SPI_H
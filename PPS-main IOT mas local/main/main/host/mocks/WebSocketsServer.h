@@ -0,0 +1,24 @@
+#ifndef HOST_MOCK_WEBSOCKETSSERVER_H
+#define HOST_MOCK_WEBSOCKETSSERVER_H
+
+#include <Arduino.h>
+
+// Servidor WebSocket (Links2004) sin red: los módulos compilados en host/
+// solo lo declaran; las respuestas pasan por enviarRespuesta()/enviarEstado()
+// (ver firmware_globals.h).
+
+class WebSocketsServer {
+public:
+  explicit WebSocketsServer(uint16_t port) : port_(port) {}
+  void begin() {}
+  void loop() {}
+  uint8_t connectedClients() { return 0; }
+  bool sendTXT(uint8_t, const String&) { return true; }
+  bool broadcastTXT(const String&) { return true; }
+  uint16_t port() const { return port_; }
+
+private:
+  uint16_t port_;
+};
+
+#endif // HOST_MOCK_WEBSOCKETSSERVER_H
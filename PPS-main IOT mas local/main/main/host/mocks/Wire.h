@@ -0,0 +1,45 @@
+#ifndef HOST_MOCK_WIRE_H
+#define HOST_MOCK_WIRE_H
+
+#include <Arduino.h>
+
+// Wire simulado con la interfaz de arduino-esp32: las transacciones van a
+// los dispositivos conectados con hal_mock_i2c_attach() y se graban como
+// HAL_I2C_WRITE / HAL_I2C_READ. Una dirección sin dispositivo responde NACK.
+// endTransmission(false) difiere la escritura hasta el requestFrom(), como
+// el core 2.x: un NACK del prefijo aparece como una lectura de 0 bytes.
+
+#define HOST_WIRE_BUFFER  128
+
+class TwoWire {
+public:
+  bool begin(int sda = -1, int scl = -1, uint32_t frequency = 0);
+  bool end() { return true; }
+  bool setClock(uint32_t hz) { clock_ = hz; return true; }
+  uint32_t getClock() { return clock_; }
+  void setTimeOut(uint16_t ms) { timeout_ms_ = ms; }
+  uint16_t getTimeOut() { return timeout_ms_; }
+
+  void beginTransmission(uint16_t address);
+  size_t write(uint8_t data);
+  size_t write(const uint8_t* data, size_t len);
+  uint8_t endTransmission(bool sendStop = true);
+
+  size_t requestFrom(uint16_t address, size_t size, bool sendStop = true);
+  int available() { return (int)(rx_len_ - rx_pos_); }
+  int read() { return rx_pos_ < rx_len_ ? rx_buf_[rx_pos_++] : -1; }
+
+private:
+  uint32_t clock_ = 100000;
+  uint16_t timeout_ms_ = 50;
+  uint8_t tx_addr_ = 0;
+  uint8_t tx_buf_[HOST_WIRE_BUFFER];
+  size_t tx_len_ = 0;
+  bool pending_prefix_ = false;
+  uint8_t rx_buf_[HOST_WIRE_BUFFER];
+  size_t rx_len_ = 0;
+  size_t rx_pos_ = 0;
+};
+extern TwoWire Wire;
+
+#endif // HOST_MOCK_WIRE_H
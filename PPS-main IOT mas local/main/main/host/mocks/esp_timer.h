@@ -0,0 +1,9 @@
+#ifndef HOST_MOCK_ESP_TIMER_H
+#define HOST_MOCK_ESP_TIMER_H
+
+#include <stdint.h>
+
+// Microsegundos desde el arranque, con el reloj virtual del HAL simulado
+int64_t esp_timer_get_time();
+
+#endif // HOST_MOCK_ESP_TIMER_H
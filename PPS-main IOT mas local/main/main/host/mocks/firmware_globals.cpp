@@ -0,0 +1,57 @@
+#include <Wire.h>
+#include <si5351.h>
+#include <WebSocketsServer.h>
+#include <Adafruit_SH110X.h>
+#include <ArduinoJson.h>
+#include "firmware_globals.h"
+#include "display_handler.h"
+#include "main_interface.h"
+#include "config.h"
+
+// Mismas definiciones que main.ino y thingProperties.h
+Adafruit_SH1106G display(ANCHO, ALTO, &Wire, -1);
+Si5351 si5351;
+WebSocketsServer webSocket = WebSocketsServer(81);
+DisplayState currentDisplayState;
+String ipAddressLine = "";
+bool si5351_present = false;
+int webSocketClients = 0;
+
+int cloud_selector;
+bool cloud_enable;
+String cloud_input;
+String cloud_display;
+int cloud_osc_id;
+
+static HostCapture last_reply;
+static HostCapture last_command;
+
+static void capture(HostCapture& c, uint8_t clientNum, const char* json) {
+  c.count++;
+  c.client = clientNum;
+  c.json = json;
+}
+
+void enviarRespuesta(uint8_t clientNum, const String& json) { capture(last_reply, clientNum, json.c_str()); }
+void enviarEstado(uint8_t clientNum, const String& json) { capture(last_reply, clientNum, json.c_str()); }
+
+void ejecutarComandoCentral(uint8_t clientNum, JsonDocument& doc) {
+  String json;
+  serializeJson(doc, json);
+  capture(last_command, clientNum, json.c_str());
+}
+
+const HostCapture& host_last_reply() { return last_reply; }
+const HostCapture& host_last_command() { return last_command; }
+
+void host_firmware_reset() {
+  last_reply = HostCapture();
+  last_command = HostCapture();
+  cloud_selector = 0;
+  cloud_enable = false;
+  cloud_input = "";
+  cloud_display = "";
+  cloud_osc_id = 0;
+  ipAddressLine = "";
+  webSocketClients = 0;
+}
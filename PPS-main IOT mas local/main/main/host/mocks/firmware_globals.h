@@ -0,0 +1,37 @@
+#ifndef HOST_FIRMWARE_GLOBALS_H
+#define HOST_FIRMWARE_GLOBALS_H
+
+#include <stdint.h>
+#include <string>
+
+// ==========================================================
+// GLOBALES DE main.ino PARA LOS MÓDULOS COMPILADOS EN EL PC
+// ==========================================================
+// main.ino no se compila en host/: aquí están los objetos que los módulos
+// declaran extern (display, si5351, webSocket, currentDisplayState, las
+// variables de la Nube...) y las funciones de main_interface.h. Las
+// respuestas y los comandos que arma cloud_bridge no van a ningún lado:
+// se guarda solo el último (los benchmarks llaman millones de veces).
+
+struct HostCapture {
+  uint32_t count;        // Llamadas desde el último host_firmware_reset()
+  uint8_t client;        // clientNum de la última
+  std::string json;      // Último JSON
+};
+
+/**
+ * @brief Última respuesta de enviarRespuesta() o enviarEstado().
+ */
+const HostCapture& host_last_reply();
+
+/**
+ * @brief Último documento entregado a ejecutarComandoCentral(), serializado.
+ */
+const HostCapture& host_last_command();
+
+/**
+ * @brief Olvida lo capturado y limpia las variables de la Nube y la línea de IP.
+ */
+void host_firmware_reset();
+
+#endif // HOST_FIRMWARE_GLOBALS_H
@@ -0,0 +1,412 @@
+#include <stdarg.h>
+#include <chrono>
+#include <map>
+#include <Arduino.h>
+#include <SPI.h>
+#include <Wire.h>
+#include <Preferences.h>
+#include <soc/gpio_struct.h>
+#include <driver/pcnt.h>
+#include <esp_timer.h>
+#include "hal_mock.h"
+
+EspClass ESP;
+HardwareSerial Serial;
+SPIClass SPI;
+TwoWire Wire;
+gpio_dev_t GPIO;
+
+struct I2cDevice {
+  uint8_t regs[256];
+  uint8_t pointer;
+  uint8_t fail_err;
+  int fail_count;
+};
+
+static std::vector<HalEvent> events;
+static bool recording = true;
+static uint64_t now_ns = 0;
+static uint8_t pin_levels[64];
+static int8_t pin_forced[64];
+static std::map<uint8_t, I2cDevice> i2c_devices;
+static uint32_t spi_hz = 1000000;
+static std::string serial_out;
+static double pin_signal_hz[64];
+static std::map<std::string, std::map<std::string, std::string>> nvs;
+
+// t_ns es el inicio del evento (las transacciones I2C se graban al terminar)
+static void record(HalEventType type, uint8_t id, uint8_t value,
+                   const uint8_t* data = nullptr, size_t len = 0, uint64_t t_ns = UINT64_MAX) {
+  if (!recording) return;
+  HalEvent e;
+  e.type = type;
+  e.t_ns = (t_ns == UINT64_MAX) ? now_ns : t_ns;
+  e.id = id;
+  e.value = value;
+  if (len) e.data.assign(data, data + len);
+  events.push_back(e);
+}
+
+// ==========================================================
+// CONTROL DEL SIMULADOR
+// ==========================================================
+
+void hal_mock_reset() {
+  events.clear();
+  recording = true;
+  now_ns = 0;
+  memset(pin_levels, HIGH, sizeof(pin_levels));
+  memset(pin_forced, -1, sizeof(pin_forced));
+  i2c_devices.clear();
+  spi_hz = 1000000;
+  serial_out.clear();
+  memset(pin_signal_hz, 0, sizeof(pin_signal_hz));
+  nvs.clear();
+}
+
+void hal_mock_record(bool enabled) { recording = enabled; }
+const std::vector<HalEvent>& hal_mock_events() { return events; }
+void hal_mock_clear_events() { events.clear(); }
+
+uint64_t hal_mock_now_ns() { return now_ns; }
+void hal_mock_advance_ns(uint64_t ns) { now_ns += ns; }
+
+int hal_mock_pin_level(uint8_t pin) {
+  pin &= 63;
+  return pin_forced[pin] >= 0 ? pin_forced[pin] : pin_levels[pin];
+}
+
+void hal_mock_pin_force(uint8_t pin, int level) {
+  pin_forced[pin & 63] = level < 0 ? -1 : (level ? HIGH : LOW);
+}
+
+void hal_mock_i2c_attach(uint8_t address) {
+  I2cDevice dev = {};
+  i2c_devices[address & 0x7F] = dev;
+}
+
+uint8_t* hal_mock_i2c_regs(uint8_t address) {
+  auto it = i2c_devices.find(address & 0x7F);
+  return it == i2c_devices.end() ? nullptr : it->second.regs;
+}
+
+void hal_mock_i2c_fail(uint8_t address, uint8_t err, int count) {
+  auto it = i2c_devices.find(address & 0x7F);
+  if (it == i2c_devices.end()) return;
+  it->second.fail_err = err;
+  it->second.fail_count = count;
+}
+
+uint32_t hal_mock_spi_clock() { return spi_hz; }
+const std::string& hal_mock_serial_output() { return serial_out; }
+
+uint32_t hal_mock_gpio_out() {
+  uint32_t v = 0;
+  for (uint8_t pin = 0; pin < 32; pin++) {
+    if (hal_mock_pin_level(pin)) v |= 1UL << pin;
+  }
+  return v;
+}
+
+void hal_mock_pin_signal(uint8_t pin, double hz) { pin_signal_hz[pin & 63] = hz > 0 ? hz : 0; }
+
+// ==========================================================
+// ARDUINO
+// ==========================================================
+
+void pinMode(uint8_t pin, uint8_t mode) {
+  record(HAL_PIN_MODE, pin, mode);
+}
+
+void digitalWrite(uint8_t pin, uint8_t val) {
+  pin_levels[pin & 63] = val ? HIGH : LOW;
+  record(HAL_PIN_WRITE, pin, val ? HIGH : LOW);
+}
+
+int digitalRead(uint8_t pin) { return hal_mock_pin_level(pin); }
+
+uint32_t millis() { return (uint32_t)(now_ns / 1000000ULL); }
+uint32_t micros() { return (uint32_t)(now_ns / 1000ULL); }
+void delay(uint32_t ms) { now_ns += (uint64_t)ms * 1000000ULL; }
+void delayMicroseconds(uint32_t us) { now_ns += (uint64_t)us * 1000ULL; }
+
+uint32_t getCpuFrequencyMhz() { return 240; }
+
+uint32_t EspClass::getCycleCount() {
+  // El benchmark mide código real, así que aquí sí se usa el reloj del PC
+  uint64_t ns = std::chrono::duration_cast<std::chrono::nanoseconds>(
+      std::chrono::steady_clock::now().time_since_epoch()).count();
+  return (uint32_t)(ns * getCpuFrequencyMhz() / 1000ULL);
+}
+
+int64_t esp_timer_get_time() { return (int64_t)(now_ns / 1000ULL); }
+
+int HardwareSerial::printf(const char* fmt, ...) {
+  char buf[256];
+  va_list ap;
+  va_start(ap, fmt);
+  int n = vsnprintf(buf, sizeof(buf), fmt, ap);
+  va_end(ap);
+  serial_out += buf;
+  return n;
+}
+
+size_t HardwareSerial::print(const char* s) {
+  serial_out += s;
+  return strlen(s);
+}
+
+// ==========================================================
+// SPI
+// ==========================================================
+
+void SPIClass::begin(int8_t, int8_t, int8_t, int8_t) {}
+
+void SPIClass::setFrequency(uint32_t hz) { spi_hz = hz ? hz : 1; }
+
+uint8_t SPIClass::transfer(uint8_t data) {
+  record(HAL_SPI_BYTE, 0, data);
+  now_ns += 8ULL * 1000000000ULL / spi_hz;
+  return 0;   // MISO sin conectar
+}
+
+// ==========================================================
+// I2C
+// ==========================================================
+
+// START + bytes de 9 bits (8 + ACK) + STOP
+static void i2cWireTime(uint32_t clock_hz, size_t bytes) {
+  now_ns += (bytes * 9 + 2) * 1000000000ULL / (clock_hz ? clock_hz : 100000);
+}
+
+// Devuelve el error de Wire si la transacción debe fallar
+static uint8_t i2cFault(I2cDevice* dev, uint16_t timeout_ms) {
+  if (!dev) return 2;                       // NACK de dirección
+  if (dev->fail_count <= 0) return 0;
+  dev->fail_count--;
+  if (dev->fail_err == 5) now_ns += (uint64_t)timeout_ms * 1000000ULL;
+  return dev->fail_err;
+}
+
+bool TwoWire::begin(int, int, uint32_t frequency) {
+  if (frequency) clock_ = frequency;
+  return true;
+}
+
+void TwoWire::beginTransmission(uint16_t address) {
+  tx_addr_ = (uint8_t)(address & 0x7F);
+  tx_len_ = 0;
+}
+
+size_t TwoWire::write(uint8_t data) {
+  if (tx_len_ >= HOST_WIRE_BUFFER) return 0;
+  tx_buf_[tx_len_++] = data;
+  return 1;
+}
+
+size_t TwoWire::write(const uint8_t* data, size_t len) {
+  size_t n = 0;
+  while (n < len && write(data[n])) n++;
+  return n;
+}
+
+// Escritura en el bus (o la parte de escritura de un write-read)
+static uint8_t i2cWrite(uint8_t addr, const uint8_t* data, size_t len, uint32_t clock_hz,
+                        uint16_t timeout_ms) {
+  auto it = i2c_devices.find(addr);
+  I2cDevice* dev = (it == i2c_devices.end()) ? nullptr : &it->second;
+  uint64_t t0 = now_ns;
+  uint8_t err = i2cFault(dev, timeout_ms);
+  i2cWireTime(clock_hz, err == 2 ? 1 : len + 1);
+  if (err == 0 && len) {
+    dev->pointer = data[0];
+    for (size_t i = 1; i < len; i++) dev->regs[dev->pointer++] = data[i];
+  }
+  record(HAL_I2C_WRITE, addr, err, data, len, t0);
+  return err;
+}
+
+uint8_t TwoWire::endTransmission(bool sendStop) {
+  // Como arduino-esp32 2.x: sin STOP no se toca el bus, el prefijo sale
+  // junto con el requestFrom() siguiente y su error solo se ve ahí
+  if (!sendStop) {
+    pending_prefix_ = true;
+    return 0;
+  }
+  pending_prefix_ = false;
+  return i2cWrite(tx_addr_, tx_buf_, tx_len_, clock_, timeout_ms_);
+}
+
+size_t TwoWire::requestFrom(uint16_t address, size_t size, bool) {
+  uint8_t addr = (uint8_t)(address & 0x7F);
+  rx_len_ = rx_pos_ = 0;
+  if (size > HOST_WIRE_BUFFER) size = HOST_WIRE_BUFFER;
+  if (pending_prefix_) {
+    pending_prefix_ = false;
+    if (i2cWrite(tx_addr_, tx_buf_, tx_len_, clock_, timeout_ms_) != 0) return 0;
+  }
+
+  auto it = i2c_devices.find(addr);
+  I2cDevice* dev = (it == i2c_devices.end()) ? nullptr : &it->second;
+  uint64_t t0 = now_ns;
+  uint8_t err = i2cFault(dev, timeout_ms_);
+  if (err == 0) {
+    for (size_t i = 0; i < size; i++) rx_buf_[rx_len_++] = dev->regs[dev->pointer++];
+  }
+  i2cWireTime(clock_, err == 2 ? 1 : size + 1);
+  record(HAL_I2C_READ, addr, err, rx_buf_, rx_len_, t0);
+  return rx_len_;
+}
+
+// ==========================================================
+// REGISTROS GPIO
+// ==========================================================
+
+static void gpioWrite(uint32_t value) {
+  for (uint8_t pin = 0; pin < 32; pin++) pin_levels[pin] = (value >> pin) & 1;
+  uint8_t bytes[4] = {(uint8_t)value, (uint8_t)(value >> 8), (uint8_t)(value >> 16), (uint8_t)(value >> 24)};
+  record(HAL_GPIO_OUT, 0, 0, bytes, sizeof(bytes));
+}
+
+HostGpioOut::operator uint32_t() const { return hal_mock_gpio_out(); }
+
+HostGpioOut& HostGpioOut::operator=(uint32_t value) {
+  gpioWrite(value);
+  return *this;
+}
+
+HostGpioW1ts& HostGpioW1ts::operator=(uint32_t mask) {
+  gpioWrite(hal_mock_gpio_out() | mask);
+  return *this;
+}
+
+HostGpioW1tc& HostGpioW1tc::operator=(uint32_t mask) {
+  gpioWrite(hal_mock_gpio_out() & ~mask);
+  return *this;
+}
+
+// ==========================================================
+// CONTADOR DE PULSOS (PCNT)
+// ==========================================================
+
+struct PcntUnit {
+  int pin = -1;
+  int16_t h_lim = 0;
+  bool running = false;
+  uint64_t started_ns = 0;
+  double count = 0;            // Flancos acumulados (fraccionarios entre lecturas)
+  void (*isr)(void*) = nullptr;
+  void* isr_arg = nullptr;
+};
+
+static PcntUnit pcnt_units[PCNT_UNIT_MAX];
+
+// Suma los flancos del tramo en curso y dispara H_LIM en cada vuelta
+static void pcntAccumulate(PcntUnit& u) {
+  if (!u.running || u.pin < 0) return;
+  u.count += pin_signal_hz[u.pin & 63] * (double)(now_ns - u.started_ns) / 1e9;
+  u.started_ns = now_ns;
+  while (u.h_lim > 0 && u.count >= u.h_lim) {
+    u.count -= u.h_lim;
+    if (u.isr) u.isr(u.isr_arg);
+  }
+}
+
+esp_err_t pcnt_unit_config(const pcnt_config_t* config) {
+  PcntUnit& u = pcnt_units[config->unit];
+  u.pin = config->pulse_gpio_num;
+  u.h_lim = config->counter_h_lim;
+  u.running = false;
+  u.count = 0;
+  return ESP_OK;
+}
+
+esp_err_t pcnt_filter_disable(pcnt_unit_t) { return ESP_OK; }
+esp_err_t pcnt_event_enable(pcnt_unit_t, pcnt_evt_type_t) { return ESP_OK; }
+esp_err_t pcnt_isr_service_install(int) { return ESP_OK; }
+esp_err_t pcnt_intr_enable(pcnt_unit_t) { return ESP_OK; }
+esp_err_t pcnt_intr_disable(pcnt_unit_t) { return ESP_OK; }
+
+esp_err_t pcnt_isr_handler_add(pcnt_unit_t unit, void (*isr_handler)(void*), void* args) {
+  pcnt_units[unit].isr = isr_handler;
+  pcnt_units[unit].isr_arg = args;
+  return ESP_OK;
+}
+
+esp_err_t pcnt_counter_pause(pcnt_unit_t unit) {
+  pcntAccumulate(pcnt_units[unit]);
+  pcnt_units[unit].running = false;
+  return ESP_OK;
+}
+
+esp_err_t pcnt_counter_resume(pcnt_unit_t unit) {
+  pcnt_units[unit].running = true;
+  pcnt_units[unit].started_ns = now_ns;
+  return ESP_OK;
+}
+
+esp_err_t pcnt_counter_clear(pcnt_unit_t unit) {
+  pcntAccumulate(pcnt_units[unit]);
+  pcnt_units[unit].count = 0;
+  return ESP_OK;
+}
+
+esp_err_t pcnt_get_counter_value(pcnt_unit_t unit, int16_t* count) {
+  pcntAccumulate(pcnt_units[unit]);
+  *count = (int16_t)pcnt_units[unit].count;
+  return ESP_OK;
+}
+
+// ==========================================================
+// NVS (Preferences)
+// ==========================================================
+
+bool Preferences::begin(const char* name, bool readOnly) {
+  ns_ = name;
+  read_only_ = readOnly;
+  open_ = true;
+  return true;
+}
+
+bool Preferences::clear() {
+  if (!open_ || read_only_) return false;
+  nvs[ns_].clear();
+  return true;
+}
+
+bool Preferences::remove(const char* key) {
+  if (!open_ || read_only_) return false;
+  return nvs[ns_].erase(key) > 0;
+}
+
+bool Preferences::isKey(const char* key) {
+  return open_ && nvs[ns_].count(key) > 0;
+}
+
+size_t Preferences::putBytes(const char* key, const void* value, size_t len) {
+  if (!open_ || read_only_) return 0;
+  nvs[ns_][key].assign((const char*)value, len);
+  return len;
+}
+
+size_t Preferences::getBytesLength(const char* key) {
+  if (!open_) return 0;
+  auto it = nvs[ns_].find(key);
+  return it == nvs[ns_].end() ? 0 : it->second.size();
+}
+
+size_t Preferences::getBytes(const char* key, void* buf, size_t maxLen) {
+  size_t len = getBytesLength(key);
+  if (!len || len > maxLen) return 0;
+  memcpy(buf, nvs[ns_][key].data(), len);
+  return len;
+}
+
+size_t Preferences::putInt(const char* key, int32_t value) {
+  return putBytes(key, &value, sizeof(value));
+}
+
+int32_t Preferences::getInt(const char* key, int32_t defaultValue) {
+  int32_t v;
+  return getBytes(key, &v, sizeof(v)) == sizeof(v) ? v : defaultValue;
+}
@@ -0,0 +1,108 @@
+#ifndef HAL_MOCK_H
+#define HAL_MOCK_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string>
+#include <vector>
+
+// ==========================================================
+// HAL SIMULADO PARA COMPILAR EL FIRMWARE EN EL PC
+// ==========================================================
+// Los mocks de Arduino.h, SPI.h y Wire.h no tocan hardware: cada acceso a
+// un pin o a un bus queda grabado en un registro de eventos con su marca
+// de tiempo. El reloj es virtual (ns): avanza con delay(),
+// delayMicroseconds() y con la duración que tendría cada byte en el bus
+// (8 bits por byte en SPI, 9 en I2C con el ACK), así un test puede medir
+// cuánto ocupa una trama sin depender de la velocidad del PC.
+//
+// En I2C cada dirección conectada es un banco de 256 registros con puntero
+// autoincremental, como el Si5351 o una EEPROM: el primer byte escrito
+// fija el puntero y el resto se guarda a partir de él.
+//
+// Los registros GPIO (GPIO.out, out_w1ts, out_w1tc) comparten los niveles
+// de los pines con digitalWrite(); cada escritura se graba con el valor
+// completo del registro, así un test puede reconstruir qué vio el chip en
+// cada instante. El PCNT cuenta la frecuencia que se le asigne a un pin
+// durante el tiempo virtual, y Preferences guarda en memoria.
+
+enum HalEventType : uint8_t {
+  HAL_PIN_MODE,    // id = pin, value = modo
+  HAL_PIN_WRITE,   // id = pin, value = nivel
+  HAL_SPI_BYTE,    // value = byte enviado (MOSI)
+  HAL_I2C_WRITE,   // id = dirección, data = bytes, value = error de Wire
+  HAL_I2C_READ,    // id = dirección, data = bytes leídos, value = error de Wire
+  HAL_GPIO_OUT     // data = GPIO.out (pines 0..31) tras la escritura, 4 bytes LSB primero
+};
+
+struct HalEvent {
+  HalEventType type;
+  uint64_t t_ns;
+  uint8_t id;
+  uint8_t value;
+  std::vector<uint8_t> data;
+};
+
+/**
+ * @brief Vuelve al estado inicial: reloj en 0, sin eventos, sin dispositivos
+ * I2C, pines en alto (pull-up), sin señales en los pines, NVS vacía y
+ * grabación activa.
+ */
+void hal_mock_reset();
+
+/**
+ * @brief Activa o no el registro de eventos (los benchmarks lo apagan).
+ */
+void hal_mock_record(bool enabled);
+const std::vector<HalEvent>& hal_mock_events();
+void hal_mock_clear_events();
+
+uint64_t hal_mock_now_ns();
+void hal_mock_advance_ns(uint64_t ns);
+
+/**
+ * @brief Nivel actual de un pin (lo último escrito, o el forzado).
+ */
+int hal_mock_pin_level(uint8_t pin);
+
+/**
+ * @brief Sostiene un pin en un nivel sin importar lo que escriba el
+ * firmware (p. ej. SDA retenido por un esclavo). level < 0 lo suelta.
+ */
+void hal_mock_pin_force(uint8_t pin, int level);
+
+/**
+ * @brief Conecta un dispositivo I2C en 'address'.
+ */
+void hal_mock_i2c_attach(uint8_t address);
+
+/**
+ * @brief Banco de registros de un dispositivo conectado (nullptr si no hay).
+ */
+uint8_t* hal_mock_i2c_regs(uint8_t address);
+
+/**
+ * @brief Las próximas 'count' transacciones a 'address' fallan con el
+ * código de Wire 'err' (2 NACK de dirección, 5 timeout...).
+ */
+void hal_mock_i2c_fail(uint8_t address, uint8_t err, int count);
+
+uint32_t hal_mock_spi_clock();
+
+/**
+ * @brief Pines 0..31 como los ve el registro GPIO.out.
+ */
+uint32_t hal_mock_gpio_out();
+
+/**
+ * @brief Señal cuadrada de 'hz' en un pin de entrada (la cuenta el PCNT).
+ * 0 la quita.
+ */
+void hal_mock_pin_signal(uint8_t pin, double hz);
+
+/**
+ * @brief Texto escrito en Serial desde el último reset.
+ */
+const std::string& hal_mock_serial_output();
+
+#endif // HAL_MOCK_H
@@ -0,0 +1,239 @@
+#include <stdlib.h>
+#include <algorithm>
+#include <Adafruit_GFX.h>
+#include <Adafruit_SH110X.h>
+#include <si5351.h>
+#include <Wire.h>
+
+// ==========================================================
+// ADAFRUIT_GFX
+// ==========================================================
+
+void Adafruit_GFX::fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) {
+  for (int16_t i = x; i < x + w; i++) {
+    for (int16_t j = y; j < y + h; j++) drawPixel(i, j, color);
+  }
+}
+
+void Adafruit_GFX::drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color) {
+  fillRect(x, y, w, 1, color);
+}
+
+void Adafruit_GFX::drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color) {
+  fillRect(x, y, 1, h, color);
+}
+
+// Bresenham, como la librería
+void Adafruit_GFX::drawLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t color) {
+  bool steep = abs(y1 - y0) > abs(x1 - x0);
+  if (steep) { int16_t t = x0; x0 = y0; y0 = t; t = x1; x1 = y1; y1 = t; }
+  if (x0 > x1) { int16_t t = x0; x0 = x1; x1 = t; t = y0; y0 = y1; y1 = t; }
+  int16_t dx = x1 - x0, dy = abs(y1 - y0);
+  int16_t err = dx / 2;
+  int16_t ystep = (y0 < y1) ? 1 : -1;
+  for (; x0 <= x1; x0++) {
+    if (steep) drawPixel(y0, x0, color);
+    else drawPixel(x0, y0, color);
+    err -= dy;
+    if (err < 0) { y0 += ystep; err += dx; }
+  }
+}
+
+void Adafruit_GFX::drawCircle(int16_t x0, int16_t y0, int16_t r, uint16_t color) {
+  int16_t f = 1 - r, ddF_x = 1, ddF_y = -2 * r, x = 0, y = r;
+  drawPixel(x0, y0 + r, color);
+  drawPixel(x0, y0 - r, color);
+  drawPixel(x0 + r, y0, color);
+  drawPixel(x0 - r, y0, color);
+  while (x < y) {
+    if (f >= 0) { y--; ddF_y += 2; f += ddF_y; }
+    x++;
+    ddF_x += 2;
+    f += ddF_x;
+    drawPixel(x0 + x, y0 + y, color);
+    drawPixel(x0 - x, y0 + y, color);
+    drawPixel(x0 + x, y0 - y, color);
+    drawPixel(x0 - x, y0 - y, color);
+    drawPixel(x0 + y, y0 + x, color);
+    drawPixel(x0 - y, y0 + x, color);
+    drawPixel(x0 + y, y0 - x, color);
+    drawPixel(x0 - y, y0 - x, color);
+  }
+}
+
+void Adafruit_GFX::fillCircle(int16_t x0, int16_t y0, int16_t r, uint16_t color) {
+  for (int16_t dy = -r; dy <= r; dy++) {
+    for (int16_t dx = -r; dx <= r; dx++) {
+      if (dx * dx + dy * dy <= r * r) drawPixel(x0 + dx, y0 + dy, color);
+    }
+  }
+}
+
+void Adafruit_GFX::drawChar(int16_t x, int16_t y, unsigned char c, uint16_t color, uint8_t size) {
+  if (x >= width_ || y >= height_ || x + 6 * size - 1 < 0 || y + 8 * size - 1 < 0) return;
+  for (int8_t col = 0; col < 5; col++) {
+    uint8_t line = 0;
+    if (c > ' ') {
+      line = (uint8_t)((((c * 0x9D) >> col) ^ (c << col)) & 0x7F);
+      if (!line) line = 0x41;
+    }
+    for (int8_t row = 0; row < 8; row++, line >>= 1) {
+      if (line & 1) fillRect(x + col * size, y + row * size, size, size, color);
+    }
+  }
+}
+
+size_t Adafruit_GFX::write(uint8_t c) {
+  if (c == '\n') {
+    cursor_x_ = 0;
+    cursor_y_ += text_size_ * 8;
+  } else if (c != '\r') {
+    if (wrap_ && cursor_x_ + text_size_ * 6 > width_) {
+      cursor_x_ = 0;
+      cursor_y_ += text_size_ * 8;
+    }
+    drawChar(cursor_x_, cursor_y_, c, text_color_, text_size_);
+    cursor_x_ += text_size_ * 6;
+  }
+  return 1;
+}
+
+size_t Adafruit_GFX::print(const char* s) {
+  size_t n = 0;
+  while (*s) n += write((uint8_t)*s++);
+  return n;
+}
+
+void Adafruit_GFX::getTextBounds(const char* str, int16_t x, int16_t y, int16_t* x1, int16_t* y1,
+                                 uint16_t* w, uint16_t* h) {
+  *x1 = x;
+  *y1 = y;
+  *w = *h = 0;
+  int16_t minx = width_, miny = height_, maxx = -1, maxy = -1;
+  for (; *str; str++) {
+    if (*str == '\n') {
+      x = 0;
+      y += text_size_ * 8;
+    } else if (*str != '\r') {
+      if (wrap_ && x + text_size_ * 6 > width_) {
+        x = 0;
+        y += text_size_ * 8;
+      }
+      int16_t x2 = x + text_size_ * 6 - 1, y2 = y + text_size_ * 8 - 1;
+      if (x2 > maxx) maxx = x2;
+      if (y2 > maxy) maxy = y2;
+      if (x < minx) minx = x;
+      if (y < miny) miny = y;
+      x += text_size_ * 6;
+    }
+  }
+  if (maxx >= minx) { *x1 = minx; *w = maxx - minx + 1; }
+  if (maxy >= miny) { *y1 = miny; *h = maxy - miny + 1; }
+}
+
+// ==========================================================
+// SH1106G
+// ==========================================================
+
+Adafruit_SH1106G::Adafruit_SH1106G(uint16_t w, uint16_t h, TwoWire* twi, int8_t, uint32_t, uint32_t)
+    : Adafruit_GFX(w, h), wire_(twi), buffer_(w * ((h + 7) / 8), 0) {}
+
+bool Adafruit_SH1106G::begin(uint8_t i2caddr, bool) {
+  // Secuencia de inicio de la librería para el SH1106G (byte de control 0x00 = comandos)
+  static const uint8_t init[] = {
+    0x00, 0xAE, 0xD5, 0x80, 0xA8, 0x3F, 0xD3, 0x00, 0x40, 0xAD, 0x8B, 0xA1, 0xC8,
+    0xDA, 0x12, 0x81, 0xFF, 0xD9, 0x1F, 0xDB, 0x40, 0x33, 0xA6, 0x20, 0x10, 0xA4,
+  };
+  static const uint8_t on[] = {0x00, 0xAF};
+  wire_->beginTransmission(i2caddr);
+  if (wire_->endTransmission() != 0) return false;
+  wire_->beginTransmission(i2caddr);
+  wire_->write(init, sizeof(init));
+  if (wire_->endTransmission() != 0) return false;
+  delay(100);
+  wire_->beginTransmission(i2caddr);
+  wire_->write(on, sizeof(on));
+  return wire_->endTransmission() == 0;
+}
+
+void Adafruit_SH1106G::clearDisplay() {
+  std::fill(buffer_.begin(), buffer_.end(), 0);
+}
+
+void Adafruit_SH1106G::drawPixel(int16_t x, int16_t y, uint16_t color) {
+  if (x < 0 || y < 0 || x >= width_ || y >= height_) return;
+  uint8_t& b = buffer_[x + (y / 8) * width_];
+  uint8_t bit = 1 << (y & 7);
+  if (color == SH110X_WHITE) b |= bit;
+  else if (color == SH110X_BLACK) b &= ~bit;
+  else b ^= bit;
+}
+
+// ==========================================================
+// SI5351 (ETHERKIT)
+// ==========================================================
+
+#define SI5351_REG_STATUS        0
+#define SI5351_REG_OUTPUT_EN     3
+#define SI5351_REG_CLK0_CTRL     16
+#define SI5351_REG_PLLA          26
+#define SI5351_REG_PLLB          34
+#define SI5351_REG_PLL_RESET     177
+#define SI5351_REG_CRYSTAL_LOAD  183
+
+uint8_t Si5351::si5351_write(uint8_t addr, uint8_t data) {
+  Wire.beginTransmission(addr_);
+  Wire.write(addr);
+  Wire.write(data);
+  return Wire.endTransmission();
+}
+
+uint8_t Si5351::si5351_write_bulk(uint8_t addr, uint8_t bytes, const uint8_t* data) {
+  Wire.beginTransmission(addr_);
+  Wire.write(addr);
+  Wire.write(data, bytes);
+  return Wire.endTransmission();
+}
+
+uint8_t Si5351::si5351_read(uint8_t addr) {
+  Wire.beginTransmission(addr_);
+  Wire.write(addr);
+  Wire.endTransmission();
+  Wire.requestFrom(addr_, (size_t)1);
+  int v = Wire.read();
+  return v < 0 ? 0 : (uint8_t)v;
+}
+
+bool Si5351::init(uint8_t xtal_load_c, uint32_t, int32_t) {
+  Wire.begin();
+  Wire.beginTransmission(addr_);
+  if (Wire.endTransmission() != 0) return false;
+  while (si5351_read(SI5351_REG_STATUS) & 0x80) { }
+  si5351_write(SI5351_REG_CRYSTAL_LOAD, (xtal_load_c & 0xC0) | 0x12);
+  reset();
+  return true;
+}
+
+void Si5351::reset() {
+  // PLL en 800 MHz con cristal de 25 MHz: a = 32 -> P1 = 3584, P2 = 0, P3 = 1
+  static const uint8_t pll_800mhz[8] = {0x00, 0x01, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x00};
+  for (uint8_t r = SI5351_REG_CLK0_CTRL; r < SI5351_REG_CLK0_CTRL + 8; r++) si5351_write(r, 0x80);
+  si5351_write_bulk(SI5351_REG_PLLA, 8, pll_800mhz);
+  si5351_write_bulk(SI5351_REG_PLLB, 8, pll_800mhz);
+  si5351_write(SI5351_REG_PLL_RESET, 0xA0);
+  // La librería apaga las 8 salidas de a una; el resultado es el mismo
+  si5351_write(SI5351_REG_OUTPUT_EN, 0xFF);
+}
+
+void Si5351::output_enable(enum si5351_clock clk, uint8_t enable) {
+  uint8_t v = si5351_read(SI5351_REG_OUTPUT_EN);
+  if (enable) v &= ~(1 << (uint8_t)clk);
+  else v |= (1 << (uint8_t)clk);
+  si5351_write(SI5351_REG_OUTPUT_EN, v);
+}
+
+void Si5351::drive_strength(enum si5351_clock clk, enum si5351_drive drive) {
+  uint8_t r = SI5351_REG_CLK0_CTRL + (uint8_t)clk;
+  uint8_t v = si5351_read(r);
+  si5351_write(r, (v & ~0x03) | ((uint8_t)drive & 0x03));
+}
@@ -0,0 +1,39 @@
+#ifndef HOST_MOCK_SI5351_H
+#define HOST_MOCK_SI5351_H
+
+#include <Arduino.h>
+
+// Parte de la librería Si5351 de Etherkit que usa el firmware. Como la
+// real, habla directo por Wire (no por i2c_bus): init() espera SYS_INIT,
+// carga el cristal, apaga las salidas y deja los PLL en 800 MHz, así los
+// registros del dispositivo simulado quedan como en el chip tras init().
+
+#define SI5351_BUS_BASE_ADDR     0x60
+#define SI5351_CRYSTAL_LOAD_6PF  (1 << 6)
+#define SI5351_CRYSTAL_LOAD_8PF  (2 << 6)
+#define SI5351_CRYSTAL_LOAD_10PF (3 << 6)
+
+enum si5351_clock {
+  SI5351_CLK0, SI5351_CLK1, SI5351_CLK2, SI5351_CLK3,
+  SI5351_CLK4, SI5351_CLK5, SI5351_CLK6, SI5351_CLK7
+};
+enum si5351_drive { SI5351_DRIVE_2MA, SI5351_DRIVE_4MA, SI5351_DRIVE_6MA, SI5351_DRIVE_8MA };
+
+class Si5351 {
+public:
+  explicit Si5351(uint8_t i2c_addr = SI5351_BUS_BASE_ADDR) : addr_(i2c_addr) {}
+
+  bool init(uint8_t xtal_load_c, uint32_t xo_freq, int32_t corr);
+  void reset();
+  void output_enable(enum si5351_clock clk, uint8_t enable);
+  void drive_strength(enum si5351_clock clk, enum si5351_drive drive);
+
+  uint8_t si5351_write(uint8_t addr, uint8_t data);
+  uint8_t si5351_write_bulk(uint8_t addr, uint8_t bytes, const uint8_t* data);
+  uint8_t si5351_read(uint8_t addr);
+
+private:
+  uint8_t addr_;
+};
+
+#endif // HOST_MOCK_SI5351_H
@@ -0,0 +1,30 @@
+#ifndef HOST_MOCK_GPIO_STRUCT_H
+#define HOST_MOCK_GPIO_STRUCT_H
+
+#include <stdint.h>
+
+// Registros de salida del GPIO del ESP32 (pines 0..31). Leer 'out' da los
+// niveles actuales; escribir 'out', 'out_w1ts' (pone en 1) o 'out_w1tc'
+// (pone en 0) cambia los pines en el HAL simulado y graba un HAL_GPIO_OUT.
+
+struct HostGpioOut {
+  operator uint32_t() const;
+  HostGpioOut& operator=(uint32_t value);
+};
+
+struct HostGpioW1ts {
+  HostGpioW1ts& operator=(uint32_t mask);
+};
+
+struct HostGpioW1tc {
+  HostGpioW1tc& operator=(uint32_t mask);
+};
+
+struct gpio_dev_t {
+  HostGpioOut out;
+  HostGpioW1ts out_w1ts;
+  HostGpioW1tc out_w1tc;
+};
+extern gpio_dev_t GPIO;
+
+#endif // HOST_MOCK_GPIO_STRUCT_H
@@ -0,0 +1,34 @@
+#ifndef HOST_TESTS_SI5351_REGS_H
+#define HOST_TESTS_SI5351_REGS_H
+
+#include <stdint.h>
+
+// Relación a + b/c que codifica un bloque de 8 registros de PLL o
+// Multisynth (AN619), para que los tests verifiquen la frecuencia que
+// generaría el chip en vez de comparar bytes.
+struct Si5351Decoded {
+  double ratio;
+  uint8_t r_div;
+  bool divby4;
+};
+
+inline Si5351Decoded si5351_decode(const uint8_t* r) {
+  uint32_t p1 = ((uint32_t)(r[2] & 0x03) << 16) | ((uint32_t)r[3] << 8) | r[4];
+  uint32_t p2 = ((uint32_t)(r[5] & 0x0F) << 16) | ((uint32_t)r[6] << 8) | r[7];
+  uint32_t p3 = ((uint32_t)(r[5] >> 4) << 16) | ((uint32_t)r[0] << 8) | r[1];
+  Si5351Decoded d;
+  d.r_div = (r[2] >> 4) & 0x07;
+  d.divby4 = (r[2] & 0x0C) == 0x0C;
+  d.ratio = d.divby4 ? 4.0 : ((double)p1 + 512.0 + (double)p2 / p3) / 128.0;
+  return d;
+}
+
+/**
+ * @brief Frecuencia de salida de un par PLL + MS con el cristal en mHz.
+ */
+inline double si5351_output_hz(const uint8_t* pll, const uint8_t* ms, uint64_t xtal_mhz) {
+  Si5351Decoded p = si5351_decode(pll), m = si5351_decode(ms);
+  return (xtal_mhz / 1000.0) * p.ratio / (m.ratio * (1 << m.r_div));
+}
+
+#endif // HOST_TESTS_SI5351_REGS_H
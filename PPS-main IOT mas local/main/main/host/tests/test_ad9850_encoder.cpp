@@ -0,0 +1,75 @@
+#include <gtest/gtest.h>
+#include "ad9850_encoder.h"
+#include "config.h"
+#include "../legacy/ad9850_legacy.h"
+
+static const uint32_t CLK = (uint32_t)AD9850_CLK_FREQ;
+
+TEST(Ad9850Encoder, TuningWordIsExactFloor) {
+  EXPECT_EQ(ad9850_tuning_word(0, CLK), 0u);
+  // 1 MHz * 2^32 / 125 MHz = 34359738.368
+  EXPECT_EQ(ad9850_tuning_word(1000000, CLK), 34359738u);
+  // 40 MHz * 2^32 / 125 MHz = 1374389534.72
+  EXPECT_EQ(ad9850_tuning_word(AD9850_MAX_FREQ, CLK), 1374389534u);
+}
+
+// El cálculo entero no debe quedar nunca por debajo del de double (que trunca
+// con 53 bits de mantisa) ni diferir en más de una unidad
+TEST(Ad9850Encoder, TuningWordTracksLegacyDouble) {
+  for (uint32_t f = 0; f <= AD9850_MAX_FREQ; f += 9973) {
+    uint32_t now = ad9850_tuning_word(f, CLK);
+    uint32_t old = ad9850_tuning_word_legacy(f, AD9850_CLK_FREQ);
+    ASSERT_LE(now > old ? now - old : old - now, 1u) << "f=" << f;
+  }
+}
+
+TEST(Ad9850Encoder, EncodesFortyBitsAndLatch) {
+  uint8_t samples[AD9850_SAMPLES_PER_WORD];
+  size_t n = ad9850_encode_word(0xA5A5A5A5u, 0x00, samples);
+  ASSERT_EQ(n, (size_t)AD9850_SAMPLES_PER_WORD);
+
+  int rising = 0;
+  uint8_t prev = 0;
+  for (size_t i = 0; i < n; i++) {
+    if ((samples[i] & AD9850_SAMPLE_W_CLK) && !(prev & AD9850_SAMPLE_W_CLK)) rising++;
+    // DATA nunca cambia con W_CLK alto
+    if (i && (samples[i] & AD9850_SAMPLE_W_CLK)) {
+      EXPECT_EQ(samples[i] & AD9850_SAMPLE_DATA, samples[i - 1] & AD9850_SAMPLE_DATA) << "muestra " << i;
+    }
+    prev = samples[i];
+  }
+  EXPECT_EQ(rising, AD9850_WORD_BITS);
+  EXPECT_EQ(samples[n - 2], AD9850_SAMPLE_FQ_UD);
+  EXPECT_EQ(samples[n - 1], 0);
+}
+
+TEST(Ad9850Encoder, DecodeRoundTrip) {
+  const uint32_t words[] = {0u, 1u, 0x80000000u, 0xFFFFFFFFu, 34359738u, 1374389534u};
+  const uint8_t controls[] = {0x00, 0x04, 0xFF};
+  for (uint32_t w : words) {
+    for (uint8_t c : controls) {
+      uint8_t samples[AD9850_SAMPLES_PER_WORD];
+      size_t n = ad9850_encode_word(w, c, samples);
+      uint32_t got_w = ~w;
+      uint8_t got_c = ~c;
+      ASSERT_TRUE(ad9850_decode_word(samples, n, &got_w, &got_c));
+      EXPECT_EQ(got_w, w);
+      EXPECT_EQ(got_c, c);
+    }
+  }
+}
+
+TEST(Ad9850Encoder, DecodeRejectsTruncatedTrain) {
+  uint8_t samples[AD9850_SAMPLES_PER_WORD];
+  size_t n = ad9850_encode_word(12345u, 0x00, samples);
+  uint32_t w;
+  uint8_t c;
+  // Sin los dos últimos bits de datos el latch llega con 38 capturas
+  uint8_t cut[AD9850_SAMPLES_PER_WORD];
+  size_t m = 0;
+  for (size_t i = 0; i < n; i++) {
+    if (i >= n - 6 && i < n - 2) continue;
+    cut[m++] = samples[i];
+  }
+  EXPECT_FALSE(ad9850_decode_word(cut, m, &w, &c));
+}
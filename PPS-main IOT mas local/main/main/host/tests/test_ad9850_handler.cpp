@@ -0,0 +1,151 @@
+#include <gtest/gtest.h>
+#include <ArduinoJson.h>
+#include "hal_mock.h"
+#include "firmware_globals.h"
+#include "ad9850_handler.h"
+#include "ad9850_encoder.h"
+#include "config.h"
+
+static const uint32_t CLK = (uint32_t)AD9850_CLK_FREQ;
+
+// Reconstruye lo que vio el chip en DATA/W_CLK/FQ_UD, sea por digitalWrite()
+// o por los registros GPIO, y decodifica una palabra por cada pulso de FQ_UD
+static std::vector<uint32_t> capturedWords() {
+  std::vector<uint32_t> words;
+  std::vector<uint8_t> train;
+  uint8_t level = 0;
+  for (const HalEvent& e : hal_mock_events()) {
+    uint8_t next = level;
+    if (e.type == HAL_PIN_WRITE) {
+      uint8_t bit = (e.id == AD9850_PIN_DATA) ? AD9850_SAMPLE_DATA :
+                    (e.id == AD9850_PIN_W_CLK) ? AD9850_SAMPLE_W_CLK :
+                    (e.id == AD9850_PIN_FQ_UD) ? AD9850_SAMPLE_FQ_UD : 0;
+      if (!bit) continue;
+      next = e.value ? (level | bit) : (level & ~bit);
+    } else if (e.type == HAL_GPIO_OUT) {
+      uint32_t out = e.data[0] | (e.data[1] << 8) | (e.data[2] << 16) | ((uint32_t)e.data[3] << 24);
+      next = ((out >> AD9850_PIN_DATA) & 1 ? AD9850_SAMPLE_DATA : 0) |
+             ((out >> AD9850_PIN_W_CLK) & 1 ? AD9850_SAMPLE_W_CLK : 0) |
+             ((out >> AD9850_PIN_FQ_UD) & 1 ? AD9850_SAMPLE_FQ_UD : 0);
+    } else {
+      continue;
+    }
+    if (next == level) continue;
+    train.push_back(next);
+    if ((level & AD9850_SAMPLE_FQ_UD) && !(next & AD9850_SAMPLE_FQ_UD)) {
+      uint32_t w;
+      uint8_t c;
+      if (ad9850_decode_word(train.data(), train.size(), &w, &c)) words.push_back(w);
+      train.clear();
+    }
+    level = next;
+  }
+  return words;
+}
+
+class Ad9850Handler : public ::testing::Test {
+protected:
+  void SetUp() override {
+    hal_mock_reset();
+    host_firmware_reset();
+    ad9850_setup(RESTORE_NONE);
+    ad9850_apply_state(1000000, 1000, true);
+    hal_mock_clear_events();
+  }
+
+  JsonDocument& reply() {
+    EXPECT_FALSE(deserializeJson(reply_, host_last_reply().json.c_str()));
+    return reply_;
+  }
+
+  void command(const char* json) {
+    StaticJsonDocument<512> doc;
+    ASSERT_FALSE(deserializeJson(doc, json));
+    handle_ad9850_command(0, doc);
+  }
+
+  StaticJsonDocument<512> reply_;
+};
+
+TEST_F(Ad9850Handler, SetupSendsZeroWord) {
+  hal_mock_reset();
+  ad9850_setup(RESTORE_NONE);
+  std::vector<uint32_t> words = capturedWords();
+  ASSERT_EQ(words.size(), 1u);
+  EXPECT_EQ(words[0], 0u);
+}
+
+// Tras un reinicio en caliente no hay pulsos de modo serial ni palabra nueva
+TEST_F(Ad9850Handler, WarmSetupLeavesChipAlone) {
+  hal_mock_reset();
+  ad9850_setup(RESTORE_RTC);
+  for (const HalEvent& e : hal_mock_events()) {
+    if (e.type == HAL_PIN_WRITE) {
+      EXPECT_EQ(e.value, LOW) << "pin " << (int)e.id;
+    }
+  }
+}
+
+TEST_F(Ad9850Handler, SetFreqSendsTuningWord) {
+  command("{\"accion\":\"ad9850_command\",\"sub_accion\":\"set_freq\",\"frecuencia_hz\":7000000}");
+  std::vector<uint32_t> words = capturedWords();
+  ASSERT_EQ(words.size(), 1u);
+  EXPECT_EQ(words[0], ad9850_tuning_word(7000000, CLK));
+  EXPECT_EQ(ad9850_get_word(), words[0]);
+
+  JsonDocument& r = reply();
+  EXPECT_STREQ(r["status"], "ok");
+  EXPECT_EQ(r["datos"]["frecuencia_hz"].as<uint32_t>(), 7000000u);
+}
+
+TEST_F(Ad9850Handler, DisabledOutputStaysAtZero) {
+  command("{\"accion\":\"ad9850_command\",\"sub_accion\":\"disable\"}");
+  command("{\"accion\":\"ad9850_command\",\"sub_accion\":\"set_freq\",\"frecuencia_hz\":5000000}");
+  std::vector<uint32_t> words = capturedWords();
+  ASSERT_EQ(words.size(), 1u);   // Solo la del disable
+  EXPECT_EQ(words[0], 0u);
+}
+
+// Las palabras de la lista llegan completas y en orden por los registros GPIO
+TEST_F(Ad9850Handler, PlayListStreamsEveryWord) {
+  command("{\"accion\":\"ad9850_command\",\"sub_accion\":\"play_list\","
+          "\"frecuencias_hz\":[1000000,2000000,50000000,3000000],\"repeticiones\":2}");
+  std::vector<uint32_t> words = capturedWords();
+  const uint32_t expected[] = {1000000, 2000000, 3000000};   // 50 MHz fuera de rango
+  ASSERT_EQ(words.size(), 6u);
+  for (size_t i = 0; i < words.size(); i++) {
+    EXPECT_EQ(words[i], ad9850_tuning_word(expected[i % 3], CLK)) << "palabra " << i;
+  }
+  EXPECT_EQ(ad9850_get_word(), words.back());
+
+  JsonDocument& r = reply();
+  EXPECT_EQ(r["datos"]["palabras"].as<int>(), 3);
+  EXPECT_EQ(r["datos"]["repeticiones"].as<int>(), 2);
+  EXPECT_EQ(r["datos"]["frecuencia_hz"].as<uint32_t>(), 3000000u);
+}
+
+// Sin repeticiones válidas no se envía nada y el estado no cambia
+TEST_F(Ad9850Handler, PlayListRejectsRepeatsBelowOne) {
+  const char* const cmds[] = {
+    "{\"accion\":\"ad9850_command\",\"sub_accion\":\"play_list\",\"frecuencias_hz\":[2000000,3000000],\"repeticiones\":0}",
+    "{\"accion\":\"ad9850_command\",\"sub_accion\":\"play_list\",\"frecuencias_hz\":[2000000,3000000],\"repeticiones\":-2}",
+  };
+  for (const char* cmd : cmds) {
+    command(cmd);
+    EXPECT_TRUE(capturedWords().empty()) << cmd;
+    EXPECT_EQ(ad9850_get_word(), ad9850_tuning_word(1000000, CLK)) << cmd;
+
+    JsonDocument& r = reply();
+    EXPECT_STREQ(r["status"], "error") << cmd;
+    EXPECT_STREQ(r["mensaje"], "'repeticiones' debe ser al menos 1.") << cmd;
+    EXPECT_EQ(r["datos"]["frecuencia_hz"].as<uint32_t>(), 1000000u) << cmd;
+    EXPECT_TRUE(r["datos"]["palabras"].isNull()) << cmd;
+  }
+}
+
+TEST_F(Ad9850Handler, LoadWordSendsItUnchanged) {
+  ASSERT_TRUE(ad9850_load_word(0x12345678u, 1000000, 1000, true));
+  std::vector<uint32_t> words = capturedWords();
+  ASSERT_EQ(words.size(), 1u);
+  EXPECT_EQ(words[0], 0x12345678u);
+}
@@ -0,0 +1,68 @@
+#include <gtest/gtest.h>
+#include <SPI.h>
+#include "hal_mock.h"
+#include "adf4351_bus.h"
+#include "adf4351_plan.h"
+#include "config.h"
+
+class Adf4351Bus : public ::testing::Test {
+protected:
+  void SetUp() override {
+    hal_mock_reset();
+    adf4351_bus_begin();
+    hal_mock_clear_events();
+  }
+};
+
+TEST_F(Adf4351Bus, BeginConfiguresModeZeroMsbFirst) {
+  EXPECT_EQ(SPI.dataMode(), SPI_MODE0);
+  EXPECT_EQ(SPI.bitOrder(), MSBFIRST);
+  EXPECT_EQ(hal_mock_pin_level(ADF4351_SS_PIN), HIGH);
+}
+
+// R5 primero, cada registro MSB primero, y LE sube después de cada 32 bits
+TEST_F(Adf4351Bus, FrameIsR5ToR0WithLatchPerRegister) {
+  uint32_t regs[6];
+  adf4351_plan_registers(2400000000ULL, ADF4351_REF_CLK_HZ, 3, true, regs);
+  adf4351_bus_write(regs);
+
+  std::vector<uint8_t> bytes;
+  std::vector<size_t> bytes_at_latch;
+  bool le_high_during_bytes = false;
+  int level = HIGH;
+  for (const HalEvent& e : hal_mock_events()) {
+    if (e.type == HAL_SPI_BYTE) {
+      bytes.push_back(e.value);
+      if (level == HIGH) le_high_during_bytes = true;
+    } else if (e.type == HAL_PIN_WRITE && e.id == ADF4351_SS_PIN) {
+      if (e.value == HIGH && level == LOW) bytes_at_latch.push_back(bytes.size());
+      level = e.value;
+    }
+  }
+
+  ASSERT_EQ(bytes.size(), 24u);
+  for (int i = 0; i < 6; i++) {
+    uint32_t r = regs[5 - i];
+    EXPECT_EQ(bytes[i * 4 + 0], (uint8_t)(r >> 24)) << "R" << 5 - i;
+    EXPECT_EQ(bytes[i * 4 + 1], (uint8_t)(r >> 16)) << "R" << 5 - i;
+    EXPECT_EQ(bytes[i * 4 + 2], (uint8_t)(r >> 8)) << "R" << 5 - i;
+    EXPECT_EQ(bytes[i * 4 + 3], (uint8_t)r) << "R" << 5 - i;
+  }
+  // Un flanco por registro más el de cierre, sin bytes nuevos entre ambos
+  ASSERT_EQ(bytes_at_latch.size(), 7u);
+  for (size_t i = 0; i < 6; i++) EXPECT_EQ(bytes_at_latch[i], (i + 1) * 4);
+  EXPECT_FALSE(le_high_during_bytes);
+  EXPECT_EQ(hal_mock_pin_level(ADF4351_SS_PIN), HIGH);
+}
+
+TEST_F(Adf4351Bus, FrameTimeIsDominatedByLatchDelays) {
+  uint32_t regs[6];
+  adf4351_plan_registers(100000000ULL, ADF4351_REF_CLK_HZ, 0, true, regs);
+  uint64_t t0 = hal_mock_now_ns();
+  adf4351_bus_write(regs);
+  uint64_t dt_us = (hal_mock_now_ns() - t0) / 1000;
+
+  // 10 us iniciales + 6 x (10 + 10) us de LE + 100 us finales + 24 bytes de SPI
+  uint64_t spi_us = 24ULL * 8 * 1000000ULL / hal_mock_spi_clock();
+  EXPECT_EQ(dt_us, 10u + 6 * 20u + 100u + spi_us);
+}
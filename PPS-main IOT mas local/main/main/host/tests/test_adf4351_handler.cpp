@@ -0,0 +1,100 @@
+#include <gtest/gtest.h>
+#include <ArduinoJson.h>
+#include "hal_mock.h"
+#include "firmware_globals.h"
+#include "adf4351_handler.h"
+#include "adf4351_plan.h"
+#include "config.h"
+
+// Tramas de 24 bytes enviadas por SPI, devueltas como R0..R5
+static std::vector<std::vector<uint32_t>> capturedFrames() {
+  std::vector<uint8_t> bytes;
+  for (const HalEvent& e : hal_mock_events()) {
+    if (e.type == HAL_SPI_BYTE) bytes.push_back(e.value);
+  }
+  std::vector<std::vector<uint32_t>> frames;
+  for (size_t f = 0; f + 24 <= bytes.size(); f += 24) {
+    std::vector<uint32_t> regs(6);
+    for (int i = 0; i < 6; i++) {
+      const uint8_t* b = &bytes[f + i * 4];
+      regs[5 - i] = ((uint32_t)b[0] << 24) | ((uint32_t)b[1] << 16) | ((uint32_t)b[2] << 8) | b[3];
+    }
+    frames.push_back(regs);
+  }
+  EXPECT_EQ(bytes.size() % 24, 0u);
+  return frames;
+}
+
+static std::vector<uint32_t> planned(uint64_t hz, uint8_t power, bool enabled) {
+  std::vector<uint32_t> regs(6);
+  adf4351_plan_registers(hz, ADF4351_REF_CLK_HZ, power, enabled, regs.data());
+  return regs;
+}
+
+class Adf4351Handler : public ::testing::Test {
+protected:
+  void SetUp() override {
+    hal_mock_reset();
+    host_firmware_reset();
+    adf4351_setup(RESTORE_NVS);
+    ASSERT_TRUE(adf4351_apply_state(1000000000ULL, 1000, 3, true));
+    hal_mock_clear_events();
+  }
+
+  void command(const char* json) {
+    StaticJsonDocument<256> doc;
+    ASSERT_FALSE(deserializeJson(doc, json));
+    handle_adf4351_command(7, doc);
+  }
+};
+
+TEST_F(Adf4351Handler, SetFreqWritesOnePlannedFrame) {
+  command("{\"accion\":\"adf4351_command\",\"sub_accion\":\"set_freq\",\"frecuencia_hz\":2400000000}");
+  std::vector<std::vector<uint32_t>> frames = capturedFrames();
+  ASSERT_EQ(frames.size(), 1u);
+  EXPECT_EQ(frames[0], planned(2400000000ULL, 3, true));
+
+  StaticJsonDocument<512> r;
+  ASSERT_FALSE(deserializeJson(r, host_last_reply().json.c_str()));
+  EXPECT_EQ(host_last_reply().client, 7);
+  EXPECT_STREQ(r["accion"], "respuesta_adf4351");
+  EXPECT_STREQ(r["datos"]["frecuencia_hz"], "2400000000");
+}
+
+TEST_F(Adf4351Handler, OutOfRangeFreqWritesNothing) {
+  command("{\"accion\":\"adf4351_command\",\"sub_accion\":\"set_freq\",\"frecuencia_hz\":5000000000}");
+  EXPECT_TRUE(capturedFrames().empty());
+  uint64_t f;
+  uint32_t step;
+  uint8_t power;
+  bool on;
+  adf4351_get_state(&f, &step, &power, &on);
+  EXPECT_EQ(f, 1000000000ULL);
+}
+
+TEST_F(Adf4351Handler, PowerAndDisableReplanR4) {
+  command("{\"accion\":\"adf4351_command\",\"sub_accion\":\"set_power\",\"potencia\":1}");
+  command("{\"accion\":\"adf4351_command\",\"sub_accion\":\"disable\"}");
+  std::vector<std::vector<uint32_t>> frames = capturedFrames();
+  ASSERT_EQ(frames.size(), 2u);
+  EXPECT_EQ(frames[0], planned(1000000000ULL, 1, true));
+  EXPECT_EQ(frames[1], planned(1000000000ULL, 1, false));
+}
+
+TEST_F(Adf4351Handler, ChangeFreqUsesStoredStep) {
+  command("{\"accion\":\"adf4351_command\",\"sub_accion\":\"set_step\",\"paso_hz\":1000000}");
+  EXPECT_TRUE(capturedFrames().empty());
+  command("{\"accion\":\"adf4351_command\",\"sub_accion\":\"change_freq\",\"direccion\":\"up\"}");
+  std::vector<std::vector<uint32_t>> frames = capturedFrames();
+  ASSERT_EQ(frames.size(), 1u);
+  EXPECT_EQ(frames[0], planned(1001000000ULL, 3, true));
+}
+
+// Reinicio en caliente: la imagen guardada se envía tal cual
+TEST_F(Adf4351Handler, LoadRegistersSkipsPlanning) {
+  const uint32_t regs[6] = {0x11111110, 0x22222221, 0x33333332, 0x44444443, 0x55555554, 0x66666665};
+  ASSERT_TRUE(adf4351_load_registers(regs, 2000000000ULL, 1000, 3, true));
+  std::vector<std::vector<uint32_t>> frames = capturedFrames();
+  ASSERT_EQ(frames.size(), 1u);
+  EXPECT_EQ(frames[0], std::vector<uint32_t>(regs, regs + 6));
+}
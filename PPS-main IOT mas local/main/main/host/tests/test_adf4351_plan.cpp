@@ -0,0 +1,77 @@
+#include <gtest/gtest.h>
+#include "adf4351_plan.h"
+#include "config.h"
+#include "../legacy/adf4351_legacy.h"
+
+// Barrido de todo el rango con un paso primo (no cae siempre en los mismos
+// residuos respecto del PFD), en todas las potencias y con la salida on/off.
+TEST(Adf4351Plan, MatchesLegacyPlannerAcrossRange) {
+  const uint64_t step_hz = 99991;
+  size_t cases = 0, mismatches = 0;
+  for (uint64_t f = ADF4351_MIN_FREQ; f <= ADF4351_MAX_FREQ; f += step_hz) {
+    for (uint8_t power = 0; power < 4; power++) {
+      for (int enabled = 0; enabled < 2; enabled++) {
+        uint32_t expected[6], got[6];
+        adf4351_plan_registers_legacy(f, ADF4351_REF_CLK_HZ, power, enabled, expected);
+        adf4351_plan_registers(f, ADF4351_REF_CLK_HZ, power, enabled, got);
+        cases++;
+        for (int r = 0; r < 6; r++) {
+          if (expected[r] != got[r]) {
+            if (mismatches++ < 5) {
+              ADD_FAILURE() << "f=" << f << " potencia=" << (int)power << " on=" << enabled
+                            << " R" << r << ": " << std::hex << got[r] << " != " << expected[r];
+            }
+            break;
+          }
+        }
+      }
+    }
+  }
+  EXPECT_EQ(mismatches, 0u);
+  EXPECT_GT(cases, 300000u);
+}
+
+TEST(Adf4351Plan, MatchesLegacyAtDividerEdges) {
+  const uint64_t edges[] = {68750000ULL, 137500000ULL, 275000000ULL,
+                            550000000ULL, 1100000000ULL, 2200000000ULL};
+  for (uint64_t edge : edges) {
+    for (int64_t d = -1; d <= 1; d++) {
+      uint32_t expected[6], got[6];
+      adf4351_plan_registers_legacy(edge + d, ADF4351_REF_CLK_HZ, 3, true, expected);
+      adf4351_plan_registers(edge + d, ADF4351_REF_CLK_HZ, 3, true, got);
+      for (int r = 0; r < 6; r++) EXPECT_EQ(got[r], expected[r]) << "f=" << edge + d << " R" << r;
+    }
+  }
+}
+
+TEST(Adf4351Plan, DividerKeepsVcoInRange) {
+  for (uint64_t f = ADF4351_MIN_FREQ; f <= ADF4351_MAX_FREQ; f += 1000003) {
+    uint64_t vco = f << adf4351_rf_divider(f);
+    EXPECT_GE(vco, 2200000000ULL) << "f=" << f;
+    EXPECT_LE(vco, 4400000000ULL) << "f=" << f;
+  }
+}
+
+TEST(Adf4351Plan, DecodesKnownFrequency) {
+  // 1 GHz: divisor /4 (código 2), VCO 4 GHz = 500 x 8 MHz exactos, prescaler 8/9
+  uint32_t regs[6];
+  adf4351_plan_registers(1000000000ULL, 8000000, 2, true, regs);
+  EXPECT_EQ(regs[0] & 0x7, 0u);
+  EXPECT_EQ(regs[0] >> 15, 500u);
+  EXPECT_EQ((regs[0] >> 3) & 0xFFF, 0u);
+  EXPECT_EQ((regs[1] >> 27) & 1, 1u);
+  EXPECT_EQ((regs[1] >> 3) & 0xFFF, 4095u);
+  EXPECT_EQ((regs[4] >> 20) & 0x7, 2u);
+  EXPECT_EQ((regs[4] >> 5) & 1, 1u);
+  EXPECT_EQ((regs[4] >> 3) & 0x3, 2u);
+  for (int r = 0; r < 6; r++) EXPECT_EQ(regs[r] & 0x7, (uint32_t)r);
+}
+
+TEST(Adf4351Plan, FractionalPartRoundsToNearest) {
+  // 1000.5 MHz -> VCO 4002 MHz = 500.25 x 8 MHz: FRAC = round(0.25 * 4095) = 1024
+  uint32_t regs[6];
+  adf4351_plan_registers(1000500000ULL, 8000000, 0, false, regs);
+  EXPECT_EQ(regs[0] >> 15, 500u);
+  EXPECT_EQ((regs[0] >> 3) & 0xFFF, 1024u);
+  EXPECT_EQ((regs[4] >> 5) & 1, 0u);
+}
@@ -0,0 +1,107 @@
+#include <gtest/gtest.h>
+#include <ArduinoJson.h>
+#include "hal_mock.h"
+#include "firmware_globals.h"
+#include "main_interface.h"
+
+// Mismos nombres que thingProperties.h
+extern int cloud_selector;
+extern bool cloud_enable;
+extern String cloud_input;
+extern String cloud_display;
+void onCloudEnableChange();
+void onCloudInputChange();
+
+class CloudBridge : public ::testing::Test {
+protected:
+  void SetUp() override {
+    hal_mock_reset();
+    host_firmware_reset();
+  }
+
+  // Escribe en el campo de texto de la Nube y devuelve el comando generado
+  JsonDocument& input(int selector, const char* text) {
+    cloud_selector = selector;
+    cloud_input = text;
+    onCloudInputChange();
+    command_.clear();
+    if (host_last_command().count) {
+      EXPECT_FALSE(deserializeJson(command_, host_last_command().json.c_str()));
+    }
+    return command_;
+  }
+
+  StaticJsonDocument<256> command_;
+};
+
+TEST_F(CloudBridge, FrequencyWithSuffixBecomesSetFreq) {
+  JsonDocument& c = input(0, " 7.1M ");
+  EXPECT_EQ(host_last_command().client, CLOUD_CLIENT_ID);
+  EXPECT_STREQ(c["accion"], "vfo_command");
+  EXPECT_STREQ(c["sub_accion"], "set_freq");
+  EXPECT_EQ(c["frecuencia_hz"].as<uint64_t>(), 7100000u);
+  EXPECT_EQ(cloud_input, "");
+  EXPECT_EQ(cloud_display, "Set: 7.10 MHz");
+
+  JsonDocument& g = input(2, "2.4g");
+  EXPECT_STREQ(g["accion"], "adf4351_command");
+  EXPECT_EQ(g["frecuencia_hz"].as<uint64_t>(), 2400000000ULL);
+}
+
+// Los rangos se validan antes de llegar al handler
+TEST_F(CloudBridge, OutOfRangeFrequencyIsNotSent) {
+  input(2, "20m");
+  EXPECT_EQ(host_last_command().count, 0u);
+  EXPECT_EQ(cloud_display, "Error: Min ADF4351 es 35MHz");
+
+  input(0, "300m");
+  EXPECT_EQ(host_last_command().count, 0u);
+  EXPECT_EQ(cloud_display, "Error: VFO admite 10kHz - 225MHz");
+}
+
+TEST_F(CloudBridge, ShortcutsMapToSubActions) {
+  JsonDocument& up = input(1, "+");
+  EXPECT_STREQ(up["accion"], "ad9850_command");
+  EXPECT_STREQ(up["sub_accion"], "change_freq");
+  EXPECT_STREQ(up["direccion"], "up");
+
+  JsonDocument& scan = input(1, "E");
+  EXPECT_STREQ(scan["accion"], "escanear_i2c");
+
+  JsonDocument& band = input(0, "b");
+  EXPECT_STREQ(band["sub_accion"], "set_band");
+}
+
+TEST_F(CloudBridge, PowerOnlyForAdf4351) {
+  input(1, "p");
+  EXPECT_EQ(host_last_command().count, 0u);
+  EXPECT_EQ(cloud_display, "Error: 'p' solo para ADF4351");
+
+  JsonDocument& c = input(2, "p");
+  EXPECT_STREQ(c["sub_accion"], "set_power");
+  EXPECT_LE(c["potencia"].as<int>(), 3);
+}
+
+TEST_F(CloudBridge, UnknownTextIsNotSent) {
+  input(0, "hola");
+  EXPECT_EQ(host_last_command().count, 0u);
+  EXPECT_EQ(cloud_display, "CMD desconocido: hola");
+}
+
+// En el VFO el switch es RX/TX; en los generadores, la salida
+TEST_F(CloudBridge, EnableSwitchDependsOnModule) {
+  cloud_selector = 0;
+  cloud_enable = true;
+  onCloudEnableChange();
+  StaticJsonDocument<256> c;
+  ASSERT_FALSE(deserializeJson(c, host_last_command().json.c_str()));
+  EXPECT_STREQ(c["sub_accion"], "set_rxtx");
+  EXPECT_STREQ(c["modo"], "tx");
+
+  cloud_selector = 2;
+  cloud_enable = false;
+  onCloudEnableChange();
+  ASSERT_FALSE(deserializeJson(c, host_last_command().json.c_str()));
+  EXPECT_STREQ(c["accion"], "adf4351_command");
+  EXPECT_STREQ(c["sub_accion"], "disable");
+}
@@ -0,0 +1,139 @@
+#include <gtest/gtest.h>
+#include <set>
+#include <string.h>
+#include <Adafruit_SH110X.h>
+#include "hal_mock.h"
+#include "firmware_globals.h"
+#include "display_handler.h"
+#include "i2c_bus.h"
+#include "config.h"
+
+extern Adafruit_SH1106G display;
+extern String cloud_display;
+
+// RAM del SH1106 (132 columnas) reconstruida a partir de las escrituras I2C:
+// 0x00 + comandos de página/columna, 0x40 + datos con autoincremento
+struct PanelModel {
+  uint8_t ram[ALTO / 8][132];
+  std::set<int> pages_written;
+  size_t data_bytes;
+  size_t max_chunk;
+
+  PanelModel() { reset(); }
+  void reset() {
+    memset(ram, 0, sizeof(ram));
+    pages_written.clear();
+    data_bytes = 0;
+    max_chunk = 0;
+  }
+
+  void apply(const std::vector<HalEvent>& events) {
+    for (const HalEvent& e : events) {
+      if (e.type != HAL_I2C_WRITE || e.id != OLED_ADDR || e.value != 0 || e.data.empty()) continue;
+      if (e.data[0] == 0x00) {
+        for (size_t i = 1; i < e.data.size(); i++) {
+          uint8_t c = e.data[i];
+          if ((c & 0xF0) == 0xB0) page = c & 0x07;
+          else if ((c & 0xF0) == 0x00) col = (col & 0xF0) | (c & 0x0F);
+          else if ((c & 0xF0) == 0x10) col = (col & 0x0F) | ((c & 0x0F) << 4);
+        }
+      } else if (e.data[0] == 0x40) {
+        size_t n = e.data.size() - 1;
+        for (size_t i = 0; i < n; i++) ram[page][col++] = e.data[i + 1];
+        pages_written.insert(page);
+        data_bytes += n;
+        if (n > max_chunk) max_chunk = n;
+      }
+    }
+  }
+
+  // Lo visible (columnas 2..129) coincide con el framebuffer
+  bool matches(const uint8_t* fb) const {
+    for (int p = 0; p < ALTO / 8; p++) {
+      if (memcmp(&ram[p][2], fb + p * ANCHO, ANCHO) != 0) return false;
+    }
+    return true;
+  }
+
+  uint8_t page = 0;
+  uint8_t col = 0;
+};
+
+class DisplayHandler : public ::testing::Test {
+protected:
+  void SetUp() override {
+    hal_mock_reset();
+    host_firmware_reset();
+    hal_mock_i2c_attach(OLED_ADDR);
+    i2c_bus_begin();
+    ASSERT_TRUE(display_setup());
+
+    // Panel en un estado conocido: todo encendido y luego todo apagado
+    // obliga a enviar cada byte sin importar lo que quedó de otro test
+    display.fillRect(0, 0, ANCHO, ALTO, SH110X_WHITE);
+    display_request_push();
+    display_push_now();
+    display.clearDisplay();
+    display_request_push();
+    display_push_now();
+    // Con el byte de dirección: 32 trozos de 1+1+32 y 8 direccionamientos de 1+4
+    ASSERT_EQ(display_last_frame_stats().bytes, 32u * 34u + 8u * 5u);
+    hal_mock_clear_events();
+
+    strcpy(currentDisplayState.moduleName, "Si5351  (RX)");
+    strcpy(currentDisplayState.primaryDisplay, "7.100 MHz");
+    strcpy(currentDisplayState.secondaryDisplay, "Banda: 40m");
+    strcpy(currentDisplayState.tertiaryDisplay, "Paso: 1kHz");
+  }
+
+  void render() {
+    showMainScreen();
+    display_push_now();
+    panel.apply(hal_mock_events());
+    hal_mock_clear_events();
+  }
+
+  PanelModel panel;
+};
+
+TEST_F(DisplayHandler, FirstFrameReachesPanel) {
+  render();
+  EXPECT_TRUE(panel.matches(display.getBuffer()));
+  EXPECT_LE(panel.max_chunk, 32u);
+}
+
+TEST_F(DisplayHandler, UnchangedFrameSendsNothing) {
+  render();
+  panel.reset();
+  render();
+  EXPECT_EQ(panel.data_bytes, 0u);
+  EXPECT_EQ(display_last_frame_stats().bytes, 0u);
+}
+
+// "Paso" está en la fila 40: solo la página 5 y solo sus columnas
+TEST_F(DisplayHandler, TextChangeSendsOnlyTouchedPage) {
+  render();
+  panel.pages_written.clear();
+  panel.data_bytes = 0;
+
+  strcpy(currentDisplayState.tertiaryDisplay, "Paso: 5kHz");
+  render();
+  EXPECT_EQ(panel.pages_written, std::set<int>({5}));
+  EXPECT_LT(panel.data_bytes, (size_t)ANCHO - 67);
+  EXPECT_TRUE(panel.matches(display.getBuffer()));
+}
+
+TEST_F(DisplayHandler, ServiceLimitsFrameRate) {
+  display_mark_dirty();
+  display_service();
+  EXPECT_EQ(cloud_display, "Si5351  (RX): 7.100 MHz | Banda: 40m Paso: 1kHz");
+
+  strcpy(currentDisplayState.primaryDisplay, "7.101 MHz");
+  display_mark_dirty();
+  display_service();   // Dentro del mismo intervalo: no redibuja
+  EXPECT_EQ(cloud_display, "Si5351  (RX): 7.100 MHz | Banda: 40m Paso: 1kHz");
+
+  delay(1000 / DISPLAY_MAX_FPS);
+  display_service();
+  EXPECT_EQ(cloud_display, "Si5351  (RX): 7.101 MHz | Banda: 40m Paso: 1kHz");
+}
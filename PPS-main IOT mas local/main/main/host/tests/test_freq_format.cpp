@@ -0,0 +1,75 @@
+#include <gtest/gtest.h>
+#include <string>
+#include "freq_format.h"
+#include "../legacy/format_legacy.h"
+
+static std::string fmt(uint64_t hz, uint8_t unit, uint8_t decimals, size_t cap = 32) {
+  char buf[32];
+  size_t n = format_frequency(buf, cap, hz, unit, decimals);
+  EXPECT_EQ(n, strlen(buf));
+  return buf;
+}
+
+TEST(FreqFormat, PlainUnits) {
+  EXPECT_EQ(fmt(0, FREQ_UNIT_HZ, 0), "0 Hz");
+  EXPECT_EQ(fmt(999, FREQ_UNIT_HZ, 0), "999 Hz");
+  EXPECT_EQ(fmt(455000, FREQ_UNIT_KHZ, 0), "455 kHz");
+  EXPECT_EQ(fmt(7100000, FREQ_UNIT_MHZ, 3), "7.100 MHz");
+  EXPECT_EQ(fmt(2400000000ULL, FREQ_UNIT_GHZ, 3), "2.400 GHz");
+}
+
+// Los decimales se agrupan de a tres; la parte entera no se agrupa
+TEST(FreqFormat, ThousandsGrouping) {
+  EXPECT_EQ(fmt(1234567890ULL, FREQ_UNIT_MHZ, 6), "1234.567 890 MHz");
+  EXPECT_EQ(fmt(1234567890ULL, FREQ_UNIT_GHZ, 9), "1.234 567 890 GHz");
+  EXPECT_EQ(fmt(1234567890ULL, FREQ_UNIT_GHZ, 4), "1.234 6 GHz");
+  EXPECT_EQ(fmt(1234567890ULL, FREQ_UNIT_KHZ, 3), "1234567.890 kHz");
+  EXPECT_EQ(fmt(10000, FREQ_UNIT_MHZ, 6), "0.010 000 MHz");
+}
+
+// El redondeo de los decimales se arrastra a la parte entera:
+// 999.9995 kHz (999 999.5 Hz no existe en enteros, 999 999 Hz sí) a 3 decimales en MHz
+TEST(FreqFormat, RoundingCarriesIntoIntegerPart) {
+  EXPECT_EQ(fmt(999999, FREQ_UNIT_MHZ, 3), "1.000 MHz");
+  EXPECT_EQ(fmt(999500, FREQ_UNIT_MHZ, 3), "1.000 MHz");
+  EXPECT_EQ(fmt(999499, FREQ_UNIT_MHZ, 3), "0.999 MHz");
+  EXPECT_EQ(fmt(999999, FREQ_UNIT_KHZ, 0), "1000 kHz");
+  EXPECT_EQ(fmt(9999999500ULL, FREQ_UNIT_GHZ, 3), "10.000 GHz");
+  EXPECT_EQ(fmt(4399999999ULL, FREQ_UNIT_GHZ, 6), "4.400 000 GHz");
+}
+
+// 64 bits enteros: sin la mantisa de 24 bits del float, el Hz sobrevive en GHz
+TEST(FreqFormat, GhzKeepsEveryHertz) {
+  EXPECT_EQ(fmt(4399999999ULL, FREQ_UNIT_GHZ, 9), "4.399 999 999 GHz");
+  EXPECT_EQ(fmt(1000000001ULL, FREQ_UNIT_GHZ, 9), "1.000 000 001 GHz");
+  EXPECT_EQ(fmt(4123456789ULL, FREQ_UNIT_GHZ, 6), "4.123 457 GHz");
+
+  // El camino anterior redondeaba a 4 decimales con String(double) y después
+  // pasaba por float (un ulp vale ~477 Hz a 4.4 GHz): con 3 decimales en GHz
+  // el resultado coincide, pero no había más dígitos confiables para mostrar
+  EXPECT_EQ(std::string(formatAdf4351Legacy(4399999999ULL).c_str()), "4.400 GHz");
+}
+
+TEST(FreqFormat, DecimalsAreCappedAtTheUnit) {
+  EXPECT_EQ(fmt(999, FREQ_UNIT_HZ, 3), "999 Hz");
+  EXPECT_EQ(fmt(12345, FREQ_UNIT_KHZ, 9), "12.345 kHz");
+}
+
+TEST(FreqFormat, TruncatesToCapacity) {
+  EXPECT_EQ(fmt(7100000, FREQ_UNIT_MHZ, 3, 5), "7.10");
+  EXPECT_EQ(fmt(7100000, FREQ_UNIT_MHZ, 3, 1), "");
+  char buf[1] = {'x'};
+  EXPECT_EQ(format_frequency(buf, 0, 7100000, FREQ_UNIT_MHZ, 3), 0u);
+  EXPECT_EQ(buf[0], 'x');
+}
+
+// La línea principal del ADF4351 no cambia de aspecto respecto del camino anterior
+TEST(FreqFormat, MatchesLegacyDisplayAtThreeDecimals) {
+  const uint64_t freqs[] = {35000000ULL, 100000000ULL, 433920000ULL, 999999000ULL,
+                            1000000000ULL, 2400000000ULL, 4400000000ULL};
+  for (uint64_t hz : freqs) {
+    char buf[32];
+    format_frequency(buf, sizeof(buf), hz, hz >= 1000000000ULL ? FREQ_UNIT_GHZ : FREQ_UNIT_MHZ, 3);
+    EXPECT_EQ(std::string(buf), std::string(formatAdf4351Legacy(hz).c_str())) << "hz=" << hz;
+  }
+}
@@ -0,0 +1,125 @@
+#include <gtest/gtest.h>
+#include "hal_mock.h"
+#include "i2c_bus.h"
+#include "config.h"
+
+class I2cBus : public ::testing::Test {
+protected:
+  void SetUp() override {
+    hal_mock_reset();
+    i2c_bus_reset_stats();
+    i2c_bus_begin();
+    hal_mock_clear_events();
+  }
+};
+
+TEST_F(I2cBus, ReadSendsPrefixWithRepeatedStart) {
+  hal_mock_i2c_attach(SI5351_ADDR);
+  uint8_t* regs = hal_mock_i2c_regs(SI5351_ADDR);
+  for (int i = 0; i < 8; i++) regs[16 + i] = 0x40 + i;
+
+  const uint8_t first = 16;
+  uint8_t out[8] = {};
+  ASSERT_EQ(i2c_bus_read(SI5351_ADDR, &first, 1, out, sizeof(out), I2C_CLIENT_SYNTH), 0);
+  for (int i = 0; i < 8; i++) EXPECT_EQ(out[i], 0x40 + i);
+
+  const std::vector<HalEvent>& ev = hal_mock_events();
+  ASSERT_EQ(ev.size(), 2u);
+  EXPECT_EQ(ev[0].type, HAL_I2C_WRITE);
+  EXPECT_EQ(ev[0].id, SI5351_ADDR);
+  EXPECT_EQ(ev[0].data, std::vector<uint8_t>{16});
+  EXPECT_EQ(ev[1].type, HAL_I2C_READ);
+  EXPECT_EQ(ev[1].data.size(), 8u);
+
+  // Dirección dos veces (escritura y lectura) + prefijo + datos
+  const I2cBusStats& st = i2c_bus_stats(I2C_CLIENT_SYNTH);
+  EXPECT_EQ(st.transactions, 1u);
+  EXPECT_EQ(st.bytes, 1u + 8u + 2u);
+  EXPECT_EQ(st.errors, 0u);
+}
+
+TEST_F(I2cBus, WriteLandsInDeviceRegisters) {
+  hal_mock_i2c_attach(SI5351_ADDR);
+  const uint8_t burst[] = {26, 0x11, 0x22, 0x33};
+  ASSERT_EQ(i2c_bus_write(SI5351_ADDR, burst, sizeof(burst), I2C_CLIENT_SYNTH), 0);
+  uint8_t* regs = hal_mock_i2c_regs(SI5351_ADDR);
+  EXPECT_EQ(regs[26], 0x11);
+  EXPECT_EQ(regs[27], 0x22);
+  EXPECT_EQ(regs[28], 0x33);
+
+  // 5 bytes de 9 bits + START/STOP a I2C_BUS_CLOCK_HZ
+  uint64_t expected_ns = (5 * 9 + 2) * 1000000000ULL / I2C_BUS_CLOCK_HZ;
+  EXPECT_EQ(hal_mock_events()[0].t_ns + expected_ns, hal_mock_now_ns());
+}
+
+TEST_F(I2cBus, NackIsCountedWithoutRecovery) {
+  EXPECT_EQ(i2c_bus_probe(0x3C, I2C_CLIENT_OTHER), I2C_ERR_NACK_ADDR);
+  EXPECT_EQ(i2c_bus_device_stats(0x3C).nacks, 1u);
+  EXPECT_EQ(i2c_bus_recoveries(), 0u);
+  EXPECT_EQ(i2c_bus_quarantine_left_ms(0x3C), 0u);
+}
+
+// La cuenta de fallos por dirección sobrevive entre tests (estado estático
+// de i2c_bus.cpp): cada test usa su propia dirección
+TEST_F(I2cBus, StuckSdaIsClockedFree) {
+  hal_mock_i2c_attach(0x51);
+  hal_mock_i2c_fail(0x51, I2C_ERR_TIMEOUT, 1);
+  hal_mock_pin_force(I2C_SDA_PIN, LOW);
+
+  const uint8_t b = 0;
+  EXPECT_EQ(i2c_bus_write(0x51, &b, 1, I2C_CLIENT_OTHER), I2C_ERR_TIMEOUT);
+  EXPECT_EQ(i2c_bus_recoveries(), 1u);
+
+  // SDA no se suelta nunca: se generan los 9 pulsos completos de SCL
+  int scl_low = 0;
+  for (const HalEvent& e : hal_mock_events()) {
+    if (e.type == HAL_PIN_WRITE && e.id == I2C_SCL_PIN && e.value == LOW) scl_low++;
+  }
+  EXPECT_EQ(scl_low, 9);
+  EXPECT_NE(hal_mock_serial_output().find("SDA sigue en bajo"), std::string::npos);
+}
+
+TEST_F(I2cBus, RepeatedStallsQuarantineOnlyOtherClients) {
+  hal_mock_i2c_attach(0x50);
+  hal_mock_i2c_attach(SI5351_ADDR);
+  hal_mock_i2c_fail(0x50, I2C_ERR_TIMEOUT, I2C_QUARANTINE_AFTER);
+  hal_mock_i2c_fail(SI5351_ADDR, I2C_ERR_TIMEOUT, I2C_QUARANTINE_AFTER);
+
+  const uint8_t b = 0;
+  for (int i = 0; i < I2C_QUARANTINE_AFTER; i++) {
+    i2c_bus_write(0x50, &b, 1, I2C_CLIENT_OTHER);
+    i2c_bus_write(SI5351_ADDR, &b, 1, I2C_CLIENT_SYNTH);
+  }
+  EXPECT_GT(i2c_bus_quarantine_left_ms(0x50), 0u);
+  EXPECT_EQ(i2c_bus_write(0x50, &b, 1, I2C_CLIENT_OTHER), I2C_ERR_QUARANTINE);
+
+  // El sintetizador nunca queda bloqueado
+  EXPECT_EQ(i2c_bus_quarantine_left_ms(SI5351_ADDR), 0u);
+  EXPECT_EQ(i2c_bus_write(SI5351_ADDR, &b, 1, I2C_CLIENT_SYNTH), 0);
+
+  hal_mock_advance_ns((uint64_t)I2C_QUARANTINE_MS * 1000000ULL);
+  EXPECT_EQ(i2c_bus_write(0x50, &b, 1, I2C_CLIENT_OTHER), 0);
+}
+
+// Core 2.x: el prefijo sin STOP sale con la lectura, así que el NACK de un
+// dispositivo ausente llega como requestFrom() == 0. No es un cuelgue.
+TEST_F(I2cBus, ReadFromAbsentDeviceIsNackNotStall) {
+  const uint8_t reg = 0;
+  uint8_t out[2];
+  for (int i = 0; i <= I2C_QUARANTINE_AFTER; i++) {
+    EXPECT_EQ(i2c_bus_read(0x52, &reg, 1, out, sizeof(out), I2C_CLIENT_OTHER), I2C_ERR_NACK_ADDR);
+  }
+  EXPECT_EQ(i2c_bus_device_stats(0x52).nacks, (uint32_t)I2C_QUARANTINE_AFTER + 1);
+  EXPECT_EQ(i2c_bus_recoveries(), 0u);
+  EXPECT_EQ(i2c_bus_quarantine_left_ms(0x52), 0u);
+}
+
+TEST_F(I2cBus, ReadThatHitsTheTimeoutIsStall) {
+  hal_mock_i2c_attach(0x53);
+  hal_mock_i2c_fail(0x53, I2C_ERR_TIMEOUT, 1);
+  const uint8_t reg = 0;
+  uint8_t out[2];
+  EXPECT_EQ(i2c_bus_read(0x53, &reg, 1, out, sizeof(out), I2C_CLIENT_OTHER), I2C_ERR_TIMEOUT);
+  EXPECT_EQ(i2c_bus_device_stats(0x53).timeouts, 1u);
+  EXPECT_EQ(i2c_bus_recoveries(), 1u);
+}
@@ -0,0 +1,116 @@
+#include <gtest/gtest.h>
+#include "si5351_plan.h"
+#include "si5351_regs.h"
+
+static const uint64_t XTAL_MHZ = 25000000000ULL;   // 25 MHz en mHz
+
+// Error máximo por redondear b: media unidad de 1/c en la etapa fraccional
+// (el MS con PLL fijo, el PLL en los demás modos)
+static double toleranceHz(uint64_t f, const Si5351PlanShape& shape, const uint8_t* pll, const uint8_t* ms) {
+  double ratio = si5351_decode(shape.mode == SI5351_PLAN_FIXED_PLL ? ms : pll).ratio;
+  return (double)f / (2.0 * SI5351_PLAN_FRAC_DENOM * ratio) + 1e-3;
+}
+
+TEST(Si5351Plan, EncodeParamsMatchesAn619) {
+  uint8_t out[8];
+  si5351_encode_params(out, 32, 0, 0, false);   // PLL fijo de 800 MHz
+  const uint8_t expected[8] = {0xFF, 0xFF, 0x00, 0x0E, 0x00, 0xF0, 0x00, 0x00};
+  for (int i = 0; i < 8; i++) EXPECT_EQ(out[i], expected[i]) << "byte " << i;
+
+  si5351_encode_params(out, 0, 0, 5, true);
+  EXPECT_EQ(out[2], (5 << 4) | 0x0C);
+  EXPECT_TRUE(si5351_decode(out).divby4);
+}
+
+TEST(Si5351Plan, RatioRoundsFraction) {
+  uint32_t a, b;
+  si5351_ratio(10, 4, a, b);
+  EXPECT_EQ(a, 2u);
+  EXPECT_EQ(b, (uint32_t)((SI5351_PLAN_FRAC_DENOM + 1) / 2));
+  si5351_ratio(SI5351_PLAN_FRAC_DENOM * 16 - 1, SI5351_PLAN_FRAC_DENOM * 4, a, b);
+  EXPECT_EQ(a, 4u);   // b redondea a c: se pasa a la parte entera
+  EXPECT_EQ(b, 0u);
+}
+
+// La salida decodificada cae dentro de la resolución fraccional en todo el rango
+TEST(Si5351Plan, ClockHitsRequestedFrequency) {
+  for (uint64_t f = 4000; f <= 225000000ULL; f = f * 11 / 10 + 7) {
+    Si5351PlanShape shape;
+    uint8_t pll[8], ms[8];
+    si5351_plan_clock(f, XTAL_MHZ, shape, pll, ms);
+    EXPECT_NEAR(si5351_output_hz(pll, ms, XTAL_MHZ), (double)f, toleranceHz(f, shape, pll, ms)) << "f=" << f;
+
+    double vco = (XTAL_MHZ / 1000.0) * si5351_decode(pll).ratio;
+    EXPECT_GE(vco, (double)SI5351_PLAN_VCO_MIN_HZ) << "f=" << f;
+    EXPECT_LE(vco, (double)SI5351_PLAN_VCO_MAX_HZ) << "f=" << f;
+  }
+}
+
+TEST(Si5351Plan, ClockPicksModeByFrequency) {
+  Si5351PlanShape shape;
+  uint8_t pll[8], ms[8];
+
+  si5351_plan_clock(10000, XTAL_MHZ, shape, pll, ms);
+  EXPECT_EQ(shape.mode, SI5351_PLAN_FIXED_PLL);
+  EXPECT_GT(shape.r_div, 0);   // 800 MHz / 10 kHz no entra en 2047
+  EXPECT_EQ(si5351_decode(ms).r_div, shape.r_div);
+
+  si5351_plan_clock(7100000, XTAL_MHZ, shape, pll, ms);
+  EXPECT_EQ(shape.mode, SI5351_PLAN_FIXED_PLL);
+  EXPECT_EQ(shape.r_div, 0);
+
+  si5351_plan_clock(120000000, XTAL_MHZ, shape, pll, ms);
+  EXPECT_EQ(shape.mode, SI5351_PLAN_INT_MS);
+  EXPECT_EQ(shape.int_div, 6);
+
+  si5351_plan_clock(200000000, XTAL_MHZ, shape, pll, ms);
+  EXPECT_EQ(shape.int_div, 4);
+  EXPECT_TRUE(si5351_decode(ms).divby4);
+}
+
+// 800 MHz / 8 MHz = 100: MS entero y par, el chip puede usar MS_INT
+TEST(Si5351Plan, ClockReportsEvenIntegerDivider) {
+  Si5351PlanShape shape;
+  uint8_t pll[8], ms[8];
+  EXPECT_TRUE(si5351_plan_clock(8000000, XTAL_MHZ, shape, pll, ms));
+  EXPECT_FALSE(si5351_plan_clock(7100000, XTAL_MHZ, shape, pll, ms));
+}
+
+TEST(Si5351Plan, IqUsesEvenDividerInsideVcoRange) {
+  Si5351PlanShape none = {SI5351_PLAN_NONE, 0, 0};
+  for (uint64_t f = 4800000; f <= 150000000ULL; f = f * 21 / 20 + 3) {
+    Si5351PlanShape shape;
+    uint8_t pll[8], ms[8];
+    ASSERT_TRUE(si5351_plan_iq(f, XTAL_MHZ, none, shape, pll, ms)) << "f=" << f;
+    EXPECT_EQ(shape.int_div % 2, 0) << "f=" << f;
+    EXPECT_LE(shape.int_div, SI5351_PLAN_IQ_MAX_DIV);
+    EXPECT_NEAR(si5351_decode(ms).ratio, (double)shape.int_div, 1e-9);
+    EXPECT_NEAR(si5351_output_hz(pll, ms, XTAL_MHZ), (double)f, toleranceHz(f, shape, pll, ms)) << "f=" << f;
+  }
+  Si5351PlanShape shape;
+  uint8_t pll[8], ms[8];
+  EXPECT_FALSE(si5351_plan_iq(4000000, XTAL_MHZ, none, shape, pll, ms));   // Haría falta d > 126
+}
+
+// Un paso chico conserva el divisor (y con él la cuadratura, sin reset del PLL)
+TEST(Si5351Plan, IqKeepsCurrentDividerWhileItFits) {
+  Si5351PlanShape none = {SI5351_PLAN_NONE, 0, 0};
+  Si5351PlanShape first, next;
+  uint8_t pll[8], ms[8];
+  ASSERT_TRUE(si5351_plan_iq(7000000, XTAL_MHZ, none, first, pll, ms));
+  ASSERT_TRUE(si5351_plan_iq(7100000, XTAL_MHZ, first, next, pll, ms));
+  EXPECT_EQ(next.int_div, first.int_div);
+
+  // Si el divisor vigente deja el VCO fuera de rango se elige otro
+  ASSERT_TRUE(si5351_plan_iq(14000000, XTAL_MHZ, first, next, pll, ms));
+  EXPECT_NE(next.int_div, first.int_div);
+}
+
+// La corrección del cristal (mHz) mueve el PLL, no la salida
+TEST(Si5351Plan, CorrectedCrystalKeepsOutput) {
+  const uint64_t xtal = XTAL_MHZ + 25000000000ULL * 3 / 1000000;   // +3 ppm
+  Si5351PlanShape shape;
+  uint8_t pll[8], ms[8];
+  si5351_plan_clock(120000000, xtal, shape, pll, ms);
+  EXPECT_NEAR(si5351_output_hz(pll, ms, xtal), 120000000.0, toleranceHz(120000000, shape, pll, ms));
+}
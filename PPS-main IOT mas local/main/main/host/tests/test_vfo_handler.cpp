@@ -0,0 +1,119 @@
+#include <gtest/gtest.h>
+#include <ArduinoJson.h>
+#include <Wire.h>
+#include "hal_mock.h"
+#include "firmware_globals.h"
+#include "vfo_handler.h"
+#include "si5351_cal.h"
+#include "i2c_bus.h"
+#include "config.h"
+#include "si5351_regs.h"
+
+static const uint64_t XTAL_MHZ = SI5351_CRYSTAL_FREQ * 1000ULL;
+static const uint32_t IF_HZ = 455000;
+
+// CLK0 según los registros del chip simulado (PLLA 26..33, MS0 42..49)
+static double clk0Hz(int32_t correction_ppb = 0) {
+  const uint8_t* regs = hal_mock_i2c_regs(SI5351_ADDR);
+  double xtal = XTAL_MHZ * (1.0 + correction_ppb * 1e-9);
+  return si5351_output_hz(&regs[26], &regs[42], (uint64_t)xtal);
+}
+
+static size_t synthWrites() {
+  size_t n = 0;
+  for (const HalEvent& e : hal_mock_events()) {
+    if (e.type == HAL_I2C_WRITE && e.id == SI5351_ADDR) n++;
+  }
+  return n;
+}
+
+class VfoHandler : public ::testing::Test {
+protected:
+  void SetUp() override {
+    hal_mock_reset();
+    host_firmware_reset();
+    hal_mock_i2c_attach(SI5351_ADDR);
+    i2c_bus_begin();
+    vfo_setup(RESTORE_NONE);
+    ASSERT_TRUE(vfo_apply_state(7000000, 1000, false));
+    hal_mock_clear_events();
+  }
+
+  JsonDocument& command(const char* json) {
+    StaticJsonDocument<256> doc;
+    EXPECT_FALSE(deserializeJson(doc, json));
+    handleVfoCommand(3, doc);
+    EXPECT_FALSE(deserializeJson(reply_, host_last_reply().json.c_str()));
+    return reply_;
+  }
+
+  StaticJsonDocument<768> reply_;
+};
+
+// En RX el LO de CLK0 lleva sumada la FI
+TEST_F(VfoHandler, SetFreqTunesClk0WithIf) {
+  JsonDocument& r = command("{\"accion\":\"vfo_command\",\"sub_accion\":\"set_freq\",\"frecuencia_hz\":7100000}");
+  EXPECT_STREQ(r["status"], "ok");
+  EXPECT_EQ(r["datos"]["frecuencia_hz"].as<uint32_t>(), 7100000u);
+  EXPECT_STREQ(r["datos"]["banda_nombre"], "40m");
+  EXPECT_NEAR(clk0Hz(), 7100000.0 + IF_HZ, 0.5);
+  EXPECT_FALSE(r["datos"]["pll_reset"].as<bool>());
+  EXPECT_GT(synthWrites(), 0u);
+}
+
+TEST_F(VfoHandler, TxDropsIf) {
+  command("{\"accion\":\"vfo_command\",\"sub_accion\":\"set_rxtx\",\"modo\":\"tx\"}");
+  EXPECT_NEAR(clk0Hz(), 7000000.0, 0.5);
+}
+
+TEST_F(VfoHandler, OutOfRangeFreqIsRejectedWithoutBusTraffic) {
+  JsonDocument& r = command("{\"accion\":\"vfo_command\",\"sub_accion\":\"set_freq\",\"frecuencia_hz\":300000000}");
+  EXPECT_STREQ(r["status"], "error");
+  EXPECT_EQ(r["datos"]["frecuencia_hz"].as<uint32_t>(), 7000000u);
+  EXPECT_EQ(synthWrites(), 0u);
+
+  JsonDocument& m = command("{\"accion\":\"vfo_command\",\"sub_accion\":\"set_freq\"}");
+  EXPECT_STREQ(m["mensaje"], "Falta 'frecuencia_hz'.");
+}
+
+// IQ solo entre 4.8 y 150 MHz: el pedido falla y la salida no cambia
+TEST_F(VfoHandler, IqOutsideRangeIsRejected) {
+  ASSERT_TRUE(vfo_apply_state(3600000, 1000, true));
+  JsonDocument& r = command("{\"accion\":\"vfo_command\",\"sub_accion\":\"set_output_mode\",\"modo_salida\":\"iq\"}");
+  EXPECT_STREQ(r["status"], "error");
+  EXPECT_STREQ(r["datos"]["salida"], "NORMAL");
+}
+
+// CLK2 a 10 MHz cableado al PCNT; el cristal simulado corre 5 ppm rápido
+TEST_F(VfoHandler, PcntCalibrationCorrectsCrystal) {
+  hal_mock_pin_signal(SI5351_CAL_PIN, SI5351_CAL_FREQ_HZ * (1.0 + 5e-6));
+  JsonDocument& r = command("{\"accion\":\"vfo_command\",\"sub_accion\":\"calibrar\",\"metodo\":\"pcnt\"}");
+  EXPECT_STREQ(r["status"], "ok");
+  int32_t ppb = r["datos"]["correccion_ppb"];
+  EXPECT_NEAR(ppb, 5000, 2);
+  EXPECT_EQ(si5351_cal_load(), ppb);
+
+  // Con la corrección aplicada el LO real sigue en la frecuencia pedida
+  EXPECT_NEAR(clk0Hz(ppb), 7000000.0 + IF_HZ, 0.5);
+}
+
+TEST_F(VfoHandler, PcntWithoutSignalFails) {
+  JsonDocument& r = command("{\"accion\":\"vfo_command\",\"sub_accion\":\"calibrar\",\"metodo\":\"pcnt\"}");
+  EXPECT_STREQ(r["status"], "error");
+  EXPECT_EQ(r["datos"]["correccion_ppb"].as<int32_t>(), 0);
+}
+
+TEST(VfoHandlerNoChip, CommandsReplyError) {
+  hal_mock_reset();
+  host_firmware_reset();
+  i2c_bus_begin();
+  vfo_setup(RESTORE_NONE);
+
+  StaticJsonDocument<256> doc;
+  ASSERT_FALSE(deserializeJson(doc, "{\"accion\":\"vfo_command\",\"sub_accion\":\"set_freq\",\"frecuencia_hz\":7100000}"));
+  handleVfoCommand(1, doc);
+  StaticJsonDocument<256> r;
+  ASSERT_FALSE(deserializeJson(r, host_last_reply().json.c_str()));
+  EXPECT_STREQ(r["status"], "error");
+  EXPECT_FALSE(vfo_apply_state(7100000, 1000, false));
+}
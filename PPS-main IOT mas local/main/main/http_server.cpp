@@ -0,0 +1,148 @@
+#include <ArduinoJson.h>
+#include "http_server.h"
+#include "main_interface.h"
+#include "latency_metrics.h"
+
+// ==========================================================
+// PEDIDOS REST ENCOLADOS PARA loop()
+// ==========================================================
+// La tarea HTTP crea el pedido, lo encola y espera el semáforo. Si se
+// vence el tiempo, lo marca como abandonado y loop() lo libera al terminar.
+struct RestJob {
+  char accion[32];
+  char body[HTTP_REST_MAX_BODY];
+  String reply;
+  SemaphoreHandle_t done;
+  bool finished;
+  bool abandoned;
+};
+
+static httpd_handle_t server_handle = nullptr;
+static QueueHandle_t rest_queue = nullptr;
+static portMUX_TYPE job_mux = portMUX_INITIALIZER_UNLOCKED;
+static String* capture_target = nullptr;
+
+static void freeJob(RestJob* job) {
+  vSemaphoreDelete(job->done);
+  delete job;
+}
+
+httpd_handle_t http_server_start() {
+  if (server_handle) return server_handle;
+  httpd_config_t config = HTTPD_DEFAULT_CONFIG();
+  config.stack_size = 8192;
+  config.max_uri_handlers = 16;
+  config.lru_purge_enable = true;      // Si se llenan los sockets, cae el más viejo
+  config.uri_match_fn = httpd_uri_match_wildcard;
+  if (httpd_start(&server_handle, &config) != ESP_OK) {
+    Serial.println(F("No se pudo iniciar el servidor HTTP."));
+    server_handle = nullptr;
+  } else {
+    Serial.println(F("Servidor HTTP iniciado (puerto 80)."));
+  }
+  return server_handle;
+}
+
+static esp_err_t sendJsonError(httpd_req_t* req, const char* status, const char* mensaje) {
+  char json[128];
+  snprintf(json, sizeof(json), "{\"status\":\"error\",\"mensaje\":\"%s\"}", mensaje);
+  httpd_resp_set_status(req, status);
+  httpd_resp_set_type(req, "application/json");
+  return httpd_resp_send(req, json, HTTPD_RESP_USE_STRLEN);
+}
+
+static esp_err_t handleApi(httpd_req_t* req) {
+  if (req->content_len >= HTTP_REST_MAX_BODY) {
+    return sendJsonError(req, "413 Payload Too Large", "Cuerpo demasiado grande.");
+  }
+
+  RestJob* job = new RestJob();
+  // "/api/<accion>[?...]"
+  const char* accion = req->uri + strlen("/api/");
+  size_t n = strcspn(accion, "?");
+  if (n >= sizeof(job->accion)) n = sizeof(job->accion) - 1;
+  memcpy(job->accion, accion, n);
+  job->accion[n] = '\0';
+
+  size_t received = 0;
+  while (received < req->content_len) {
+    int r = httpd_req_recv(req, job->body + received, req->content_len - received);
+    if (r == HTTPD_SOCK_ERR_TIMEOUT) continue;
+    if (r <= 0) {
+      delete job;
+      return ESP_FAIL;
+    }
+    received += r;
+  }
+  job->body[received] = '\0';
+
+  job->done = xSemaphoreCreateBinary();
+  if (xQueueSend(rest_queue, &job, 0) != pdTRUE) {
+    freeJob(job);
+    return sendJsonError(req, "503 Service Unavailable", "Cola de comandos llena.");
+  }
+
+  bool ok = xSemaphoreTake(job->done, pdMS_TO_TICKS(HTTP_REST_TIMEOUT_MS)) == pdTRUE;
+  portENTER_CRITICAL(&job_mux);
+  if (!ok && !job->finished) job->abandoned = true;
+  bool finished = job->finished;
+  portEXIT_CRITICAL(&job_mux);
+  // Terminó justo al vencer el plazo: loop() está por dar el semáforo
+  if (!ok && finished) xSemaphoreTake(job->done, portMAX_DELAY);
+
+  if (!finished) {
+    return sendJsonError(req, "504 Gateway Timeout", "El comando no termino a tiempo.");
+  }
+  httpd_resp_set_type(req, "application/json");
+  esp_err_t err = job->reply.length() > 0
+      ? httpd_resp_send(req, job->reply.c_str(), job->reply.length())
+      : httpd_resp_send(req, "{\"status\":\"ok\"}", HTTPD_RESP_USE_STRLEN);
+  freeJob(job);
+  return err;
+}
+
+void http_server_register_api(httpd_handle_t server) {
+  if (!server) return;
+  if (!rest_queue) rest_queue = xQueueCreate(HTTP_REST_QUEUE_LEN, sizeof(RestJob*));
+  httpd_uri_t get_api = {"/api/*", HTTP_GET, handleApi, nullptr};
+  httpd_uri_t post_api = {"/api/*", HTTP_POST, handleApi, nullptr};
+  httpd_register_uri_handler(server, &get_api);
+  httpd_register_uri_handler(server, &post_api);
+}
+
+void http_server_capture_reply(const String& json) {
+  // Vale la primera: algunos comandos mandan después un estado de cortesía
+  // (p. ej. memoria/recuperar -> estado del generador) que no es la respuesta
+  if (capture_target && capture_target->length() == 0) *capture_target = json;
+}
+
+void http_server_service() {
+  if (!rest_queue) return;
+  RestJob* job;
+  while (xQueueReceive(rest_queue, &job, 0) == pdTRUE) {
+    StaticJsonDocument<512> restDoc;
+    uint32_t t0 = metrics_cycles();
+    if (job->body[0] != '\0' && deserializeJson(restDoc, job->body)) {
+      job->reply = "{\"status\":\"error\",\"mensaje\":\"JSON invalido.\"}";
+    } else {
+      uint32_t parseCycles = metrics_cycles() - t0;
+      if (!restDoc.containsKey("accion")) restDoc["accion"] = (const char*)job->accion;
+      const char* accion = restDoc["accion"] | "";
+      if (job->body[0] != '\0') metrics_record_for(accion, METRIC_PARSE, parseCycles);
+      if (accion[0] == '\0') {
+        job->reply = "{\"status\":\"error\",\"mensaje\":\"Falta la accion.\"}";
+      } else {
+        capture_target = &job->reply;
+        ejecutarComandoCentral(REST_CLIENT_ID, restDoc);
+        capture_target = nullptr;
+      }
+    }
+
+    portENTER_CRITICAL(&job_mux);
+    job->finished = true;
+    bool abandoned = job->abandoned;
+    portEXIT_CRITICAL(&job_mux);
+    if (abandoned) freeJob(job);
+    else xSemaphoreGive(job->done);
+  }
+}
@@ -0,0 +1,48 @@
+#ifndef HTTP_SERVER_H
+#define HTTP_SERVER_H
+
+#include <Arduino.h>
+#include <esp_http_server.h>
+
+// ==========================================================
+// SERVIDOR HTTP ASÍNCRONO (ESP-IDF httpd)
+// ==========================================================
+// Corre en su propia tarea y atiende varias conexiones a la vez, así que
+// loop() ya no llama a handleClient(). Sirve:
+//   - Modo AP: el portal de configuración (portal_config.cpp).
+//   - Modo estación: el panel desde la flash (web_ui.cpp) y /api/...
+//
+// /api/<accion> es un espejo REST de los comandos WebSocket:
+//   GET  /api/estadisticas_i2c
+//   POST /api/vfo_command   {"sub_accion":"set_freq","frecuencia_hz":7100000}
+// El cuerpo es el mismo JSON del WebSocket ("accion" se toma de la ruta).
+// El comando no se ejecuta en la tarea HTTP: se encola y lo corre
+// http_server_service() desde loop(), igual que un mensaje WebSocket, y
+// la respuesta vuelve en el cuerpo HTTP.
+
+#define HTTP_REST_MAX_BODY    512
+#define HTTP_REST_QUEUE_LEN   4
+#define HTTP_REST_TIMEOUT_MS  3000
+
+/**
+ * @brief Arranca el servidor (una sola vez) y devuelve su handle.
+ */
+httpd_handle_t http_server_start();
+
+/**
+ * @brief Registra /api/* (espejo REST de ejecutarComandoCentral).
+ */
+void http_server_register_api(httpd_handle_t server);
+
+/**
+ * @brief Ejecuta los comandos REST encolados. Llamar en cada loop().
+ */
+void http_server_service();
+
+/**
+ * @brief Guarda la respuesta del comando REST en ejecución (ver enviarRespuesta()).
+ * Solo se conserva la primera respuesta de cada pedido.
+ */
+void http_server_capture_reply(const String& json);
+
+#endif // HTTP_SERVER_H
@@ -0,0 +1,175 @@
+#include <Wire.h>
+#include "i2c_bus.h"
+#include "display_handler.h"
+#include "config.h"
+
+static I2cBusStats bus_stats[I2C_CLIENT_COUNT];
+static I2cDeviceStats device_stats[128];
+static uint32_t quarantine_until_ms[128];   // 0 = sin cuarentena
+static uint8_t consecutive_failures[128];
+static uint32_t bus_recoveries = 0;
+
+static void configureWire() {
+  Wire.begin(I2C_SDA_PIN, I2C_SCL_PIN);
+  Wire.setClock(I2C_BUS_CLOCK_HZ);
+  Wire.setTimeOut(I2C_BUS_TIMEOUT_MS);
+}
+
+void i2c_bus_begin() {
+  configureWire();
+  Serial.printf("Bus I2C a %lu Hz.\n", (unsigned long)Wire.getClock());
+}
+
+// ==========================================================
+// RECUPERACIÓN DEL BUS
+// ==========================================================
+// Si un esclavo quedó a mitad de un byte sosteniendo SDA en bajo, se
+// sueltan los pines del periférico y se generan hasta 9 pulsos de SCL
+// a mano hasta que libere SDA, seguidos de una condición de STOP.
+static bool recoverBus() {
+  const uint32_t half_us = 5;   // ~100 kHz
+  Wire.end();
+  pinMode(I2C_SDA_PIN, INPUT_PULLUP);
+  pinMode(I2C_SCL_PIN, OUTPUT_OPEN_DRAIN);
+  digitalWrite(I2C_SCL_PIN, HIGH);
+  delayMicroseconds(half_us);
+
+  for (uint8_t i = 0; i < 9 && digitalRead(I2C_SDA_PIN) == LOW; i++) {
+    digitalWrite(I2C_SCL_PIN, LOW);
+    delayMicroseconds(half_us);
+    digitalWrite(I2C_SCL_PIN, HIGH);
+    delayMicroseconds(half_us);
+  }
+
+  // STOP: SDA sube mientras SCL está alto
+  pinMode(I2C_SDA_PIN, OUTPUT_OPEN_DRAIN);
+  digitalWrite(I2C_SDA_PIN, LOW);
+  delayMicroseconds(half_us);
+  digitalWrite(I2C_SCL_PIN, HIGH);
+  delayMicroseconds(half_us);
+  digitalWrite(I2C_SDA_PIN, HIGH);
+  delayMicroseconds(half_us);
+  bool released = digitalRead(I2C_SDA_PIN) == HIGH && digitalRead(I2C_SCL_PIN) == HIGH;
+
+  configureWire();
+  bus_recoveries++;
+  Serial.printf("Bus I2C recuperado (%s).\n", released ? "lineas libres" : "SDA sigue en bajo");
+  return released;
+}
+
+// ==========================================================
+// CONTABILIDAD Y CUARENTENA
+// ==========================================================
+static bool inQuarantine(uint8_t address, I2cClient client) {
+  // El sintetizador y el display nunca se bloquean: son parte del instrumento
+  if (client != I2C_CLIENT_OTHER || quarantine_until_ms[address] == 0) return false;
+  if ((int32_t)(millis() - quarantine_until_ms[address]) >= 0) {
+    quarantine_until_ms[address] = 0;
+    consecutive_failures[address] = 0;
+    return false;
+  }
+  return true;
+}
+
+static uint8_t account(uint8_t address, I2cClient client, size_t wire_bytes, uint32_t dt, uint8_t err) {
+  I2cBusStats& st = bus_stats[client];
+  st.transactions++;
+  st.bytes += wire_bytes;
+  st.busy_us += dt;
+  if (dt > st.max_us) st.max_us = dt;
+  if (err != 0) st.errors++;
+
+  I2cDeviceStats& dev = device_stats[address & 0x7F];
+  dev.transactions++;
+  dev.total_us += dt;
+  if (dt > dev.max_us) dev.max_us = dt;
+  if (err == I2C_ERR_NACK_ADDR || err == I2C_ERR_NACK_DATA) dev.nacks++;
+  else if (err == I2C_ERR_TIMEOUT) dev.timeouts++;
+  else if (err != 0) dev.errors++;
+
+  // Un NACK es rápido y normal (p.ej. el escáner); solo los cuelgues cuentan
+  bool stalled = (err == I2C_ERR_TIMEOUT || err == I2C_ERR_OTHER);
+  if (stalled) {
+    if (err == I2C_ERR_TIMEOUT || digitalRead(I2C_SDA_PIN) == LOW || digitalRead(I2C_SCL_PIN) == LOW) {
+      recoverBus();
+    }
+    if (++consecutive_failures[address & 0x7F] >= I2C_QUARANTINE_AFTER && client == I2C_CLIENT_OTHER) {
+      quarantine_until_ms[address & 0x7F] = (millis() + I2C_QUARANTINE_MS) | 1;
+      Serial.printf("Direccion 0x%02X en cuarentena por %u ms.\n", address, (unsigned)I2C_QUARANTINE_MS);
+    }
+  } else if (err == 0) {
+    consecutive_failures[address & 0x7F] = 0;
+  }
+  return err;
+}
+
+// En el core 2.x endTransmission(false) no toca el bus: el prefijo sale
+// junto con la lectura y un NACK de dirección solo se ve como requestFrom()
+// devolviendo menos bytes. Si terminó antes del timeout y con las líneas
+// libres, nadie respondió; si no, es un cuelgue y va a la recuperación.
+static uint8_t shortReadError(size_t got, uint32_t dt_us) {
+  if (dt_us >= I2C_BUS_TIMEOUT_MS * 1000UL) return I2C_ERR_TIMEOUT;
+  if (got > 0 || digitalRead(I2C_SDA_PIN) == LOW || digitalRead(I2C_SCL_PIN) == LOW) return I2C_ERR_OTHER;
+  return I2C_ERR_NACK_ADDR;
+}
+
+uint8_t i2c_bus_write(uint8_t address, const uint8_t* data, size_t len, I2cClient client) {
+  if (inQuarantine(address, client)) return I2C_ERR_QUARANTINE;
+  uint32_t t0 = micros();
+  Wire.beginTransmission(address);
+  if (len) Wire.write(data, len);
+  uint8_t err = Wire.endTransmission();
+  return account(address, client, len + 1, micros() - t0, err);
+}
+
+uint8_t i2c_bus_read(uint8_t address, const uint8_t* prefix, size_t prefix_len,
+                     uint8_t* out, size_t len, I2cClient client) {
+  if (inQuarantine(address, client)) return I2C_ERR_QUARANTINE;
+  uint32_t t0 = micros();
+  uint8_t err = 0;
+  if (prefix_len) {
+    Wire.beginTransmission(address);
+    Wire.write(prefix, prefix_len);
+    err = Wire.endTransmission(false);
+  }
+  if (err == 0) {
+    size_t got = Wire.requestFrom((uint16_t)address, len, true);
+    for (size_t i = 0; i < got; i++) out[i] = Wire.read();
+    if (got != len) err = shortReadError(got, micros() - t0);
+  }
+  return account(address, client, prefix_len + len + (prefix_len ? 2 : 1), micros() - t0, err);
+}
+
+uint8_t i2c_bus_probe(uint8_t address, I2cClient client) {
+  return i2c_bus_write(address, nullptr, 0, client);
+}
+
+void i2c_bus_service() {
+  // Un solo trozo por iteración: el sintetizador nunca queda detrás de un frame entero
+  display_push_step();
+}
+
+const I2cBusStats& i2c_bus_stats(I2cClient client) {
+  return bus_stats[client];
+}
+
+const I2cDeviceStats& i2c_bus_device_stats(uint8_t address) {
+  return device_stats[address & 0x7F];
+}
+
+uint32_t i2c_bus_quarantine_left_ms(uint8_t address) {
+  uint32_t until = quarantine_until_ms[address & 0x7F];
+  if (until == 0) return 0;
+  int32_t left = (int32_t)(until - millis());
+  return left > 0 ? left : 0;
+}
+
+uint32_t i2c_bus_recoveries() {
+  return bus_recoveries;
+}
+
+void i2c_bus_reset_stats() {
+  memset(bus_stats, 0, sizeof(bus_stats));
+  memset(device_stats, 0, sizeof(device_stats));
+  bus_recoveries = 0;
+}
@@ -0,0 +1,108 @@
+#ifndef I2C_BUS_H
+#define I2C_BUS_H
+
+#include <Arduino.h>
+
+// ==========================================================
+// BUS I2C COMPARTIDO (Si5351, OLED y dispositivos del usuario)
+// ==========================================================
+// Centraliza la velocidad del bus y la contabilidad de ocupación.
+// Prioridades:
+//   - Sintetizador: se escribe en el momento, en ráfagas por dispositivo.
+//   - Display: el framebuffer se envía en trozos desde i2c_bus_service(),
+//     así una escritura al Si5351 nunca espera más que un trozo del OLED.
+// Salud del bus:
+//   - Cada transacción se contabiliza también por dirección (latencia,
+//     NACKs, timeouts).
+//   - Ante un timeout o el bus trabado se libera SDA con pulsos de SCL y
+//     un STOP, y se reinicia el periférico.
+//   - Una dirección de usuario con I2C_QUARANTINE_AFTER cuelgues seguidos
+//     queda en cuarentena I2C_QUARANTINE_MS: sus transacciones fallan al
+//     instante (I2C_ERR_QUARANTINE) en vez de frenar al sintetizador.
+
+// Códigos de Wire.endTransmission() y uno propio para la cuarentena
+#define I2C_ERR_DATA_TOO_LONG  1
+#define I2C_ERR_NACK_ADDR      2
+#define I2C_ERR_NACK_DATA      3
+#define I2C_ERR_OTHER          4
+#define I2C_ERR_TIMEOUT        5
+#define I2C_ERR_QUARANTINE     6
+
+enum I2cClient : uint8_t {
+  I2C_CLIENT_SYNTH,
+  I2C_CLIENT_DISPLAY,
+  I2C_CLIENT_OTHER,
+  I2C_CLIENT_COUNT
+};
+
+/**
+ * @brief Ocupación acumulada del bus por cliente.
+ */
+struct I2cBusStats {
+  uint32_t transactions;
+  uint32_t bytes;          // Bytes en el cable (dirección + datos)
+  uint32_t busy_us;        // Tiempo total con el bus ocupado
+  uint32_t max_us;         // Transacción más larga
+  uint32_t errors;
+};
+
+/**
+ * @brief Salud acumulada de una dirección.
+ */
+struct I2cDeviceStats {
+  uint32_t transactions;
+  uint32_t total_us;       // Para la latencia media
+  uint32_t max_us;
+  uint32_t nacks;          // Dirección o dato sin ACK
+  uint32_t timeouts;
+  uint32_t errors;         // Otros errores (bus ocupado, lectura incompleta)
+};
+
+/**
+ * @brief Inicializa Wire con la velocidad y timeout de config.h. Llamar en setup().
+ */
+void i2c_bus_begin();
+
+/**
+ * @brief Escribe una transacción completa (START, datos, STOP) y la contabiliza.
+ * @return Código de Wire.endTransmission() (0 = OK).
+ */
+uint8_t i2c_bus_write(uint8_t address, const uint8_t* data, size_t len, I2cClient client);
+
+/**
+ * @brief Lee 'len' bytes. Si 'prefix_len' > 0, antes escribe 'prefix' sin STOP
+ * (START repetido), el patrón típico "registro y lectura".
+ * @return 0 si se recibieron todos los bytes; si no, el código de Wire
+ * (2 = nadie respondió, 5 = timeout, 4 = lectura incompleta o bus trabado).
+ */
+uint8_t i2c_bus_read(uint8_t address, const uint8_t* prefix, size_t prefix_len,
+                     uint8_t* out, size_t len, I2cClient client);
+
+/**
+ * @brief Prueba si una dirección responde (START + dirección + STOP).
+ * @return Código de Wire.endTransmission() (0 = el dispositivo respondió ACK).
+ */
+uint8_t i2c_bus_probe(uint8_t address, I2cClient client);
+
+/**
+ * @brief Atiende el trabajo de baja prioridad pendiente (trozos del OLED).
+ * Llamar en cada iteración de loop().
+ */
+void i2c_bus_service();
+
+const I2cBusStats& i2c_bus_stats(I2cClient client);
+const I2cDeviceStats& i2c_bus_device_stats(uint8_t address);
+
+/**
+ * @brief Milisegundos de cuarentena restantes de una dirección (0 = libre).
+ */
+uint32_t i2c_bus_quarantine_left_ms(uint8_t address);
+
+/**
+ * @brief Cantidad de recuperaciones del bus desde el arranque (o el último reset).
+ */
+uint32_t i2c_bus_recoveries();
+
+void i2c_bus_reset_stats();
+
+#endif // I2C_BUS_H
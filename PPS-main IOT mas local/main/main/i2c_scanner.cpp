@@ -1,55 +1,142 @@
 #include <Wire.h>
 #include <ArduinoJson.h>
-#include <WebSocketsServer.h>
 #include "i2c_scanner.h"
+#include "i2c_bus.h"
 #include "config.h"
+#include "main_interface.h"
 #include "display_handler.h"
 
-extern WebSocketsServer webSocket;
 extern int connectedModuleCount;
 
-void performI2CScanAndReply(uint8_t clientNum) {
-  updateOledStatus("ESCANEAR I2C");
+// ==========================================================
+// ESTADO DEL ESCÁNER E INVENTARIO
+// ==========================================================
+#define I2C_SCAN_FIRST       1
+#define I2C_SCAN_LAST        126
+#define I2C_SCAN_PROGRESS_EVERY 16   // Direcciones entre mensajes de progreso
+
+static uint32_t last_seen_ms[128];      // Última respuesta por dirección (0 = ausente)
+static uint32_t inventory_ms = 0;       // Fin del último escaneo completo (0 = sin inventario)
+static bool scanning = false;
+static uint8_t scan_addr = I2C_SCAN_FIRST;
+static uint8_t scan_found = 0;
+static uint32_t scan_started_ms = 0;
+static uint32_t waiting_clients = 0;    // bit n = el cliente n espera la respuesta
+static bool announce_result = false;    // Mostrar el resultado en el OLED
+
+static void sendToWaiting(JsonDocument& doc, bool is_progress) {
+  String output;
+  serializeJson(doc, output);
+  for (uint8_t c = 0; c < 32; c++) {
+    if (!(waiting_clients & (1UL << c))) continue;
+    if (is_progress) enviarEstado(c, output);
+    else enviarRespuesta(c, output);
+  }
+}
 
-  StaticJsonDocument<512> responseDoc;
+static void buildInventory(JsonDocument& responseDoc) {
+  uint32_t now = millis();
   responseDoc["status"] = "ok";
   responseDoc["accion"] = "respuesta_escaner";
   JsonArray dispositivos = responseDoc.createNestedArray("dispositivos");
+  JsonArray detalle = responseDoc.createNestedArray("detalle");
+  for (uint8_t address = I2C_SCAN_FIRST; address <= I2C_SCAN_LAST; address++) {
+    if (last_seen_ms[address] == 0) continue;
+    dispositivos.add(address);
+    JsonObject d = detalle.createNestedObject();
+    d["direccion"] = address;
+    d["visto_hace_ms"] = now - last_seen_ms[address];
+  }
+  responseDoc["edad_ms"] = now - inventory_ms;
+  responseDoc["escaneando"] = scanning;
+}
+
+void i2c_scanner_start() {
+  if (scanning) return;
+  scanning = true;
+  scan_addr = I2C_SCAN_FIRST;
+  scan_found = 0;
+  scan_started_ms = millis();
+}
+
+static void finishScan() {
+  scanning = false;
+  inventory_ms = millis() | 1;
+  connectedModuleCount = scan_found;
+  Serial.printf("Escaneo finalizado. Se encontraron %d dispositivos en %lu ms.\n",
+                scan_found, (unsigned long)(inventory_ms - scan_started_ms));
+
+  if (waiting_clients) {
+    StaticJsonDocument<1024> responseDoc;
+    buildInventory(responseDoc);
+    sendToWaiting(responseDoc, false);
+    waiting_clients = 0;
+  }
+  if (announce_result) {
+    announce_result = false;
+    printToAll("Escaneo: " + String(scan_found) + " disp.");
+    display_mark_dirty();
+  }
+}
 
-  byte count = 0;
-  Serial.println("Iniciando escaneo I2C...");
-  for (byte address = 1; address < 127; address++) {
-    if (address == OLED_ADDR) continue;
+void i2c_scanner_service() {
+  if (!scanning) {
+    if (I2C_SCAN_INTERVAL_MS > 0 && inventory_ms != 0 &&
+        millis() - inventory_ms >= I2C_SCAN_INTERVAL_MS) {
+      i2c_scanner_start();   // Re-escaneo silencioso en segundo plano
+    }
+    return;
+  }
+
+  for (uint8_t n = 0; n < I2C_SCAN_ADDR_PER_LOOP && scan_addr <= I2C_SCAN_LAST; n++, scan_addr++) {
+    if (scan_addr == OLED_ADDR) continue;
+    bool present = (i2c_bus_probe(scan_addr, I2C_CLIENT_OTHER) == 0);
+    bool was_present = (last_seen_ms[scan_addr] != 0);
+    if (present) {
+      last_seen_ms[scan_addr] = millis() | 1;
+      scan_found++;
+      if (!was_present) Serial.printf("Dispositivo encontrado en 0x%02X\n", scan_addr);
+    } else {
+      last_seen_ms[scan_addr] = 0;
+      if (was_present) Serial.printf("Dispositivo 0x%02X ya no responde\n", scan_addr);
+    }
 
-    Wire.beginTransmission(address);
-    if (Wire.endTransmission() == 0) {
-      Serial.printf("Dispositivo encontrado en 0x%02X\n", address);
-      dispositivos.add(address);
-      count++;
+    if (waiting_clients && (scan_addr % I2C_SCAN_PROGRESS_EVERY) == 0) {
+      StaticJsonDocument<128> progressDoc;
+      progressDoc["status"] = "ok";
+      progressDoc["accion"] = "progreso_escaner";
+      progressDoc["direccion"] = scan_addr;
+      progressDoc["total"] = I2C_SCAN_LAST;
+      progressDoc["encontrados"] = scan_found;
+      sendToWaiting(progressDoc, true);
     }
-    delay(1); // Mantenemos este delay corto para el Watchdog
-  }
-  
-  connectedModuleCount = count;
-  Serial.printf("Escaneo finalizado. Se encontraron %d dispositivos.\n", count);
-
-  printToAll("Escaneo: " + String(count) + " disp.");
-  
-  // ==========================================================
-  // == INICIO DE LA CORRECCIÓN ==
-  // ==========================================================
-  // delay(2000); // <- ELIMINA O COMENTA ESTA LÍNEA. Es la causa del problema de red.
-  // ==========================================================
-  // == FIN DE LA CORRECCIÓN ==
-  // ==========================================================
-  
-  showMainScreen();
+  }
+
+  if (scan_addr > I2C_SCAN_LAST) finishScan();
+}
 
+static void replyFromCache(uint8_t clientNum) {
+  StaticJsonDocument<1024> responseDoc;
+  buildInventory(responseDoc);
   String output;
   serializeJson(responseDoc, output);
-  
-  Serial.println("Enviando respuesta a cliente WebSocket:");
-  Serial.println(output);
-  
-  webSocket.sendTXT(clientNum, output);
-}
\ No newline at end of file
+  enviarRespuesta(clientNum, output);
+}
+
+void performI2CScanAndReply(uint8_t clientNum, bool refresh) {
+  if (inventory_ms != 0 && !refresh) {
+    // Respuesta inmediata desde la caché
+    replyFromCache(clientNum);
+    return;
+  }
+
+  updateOledStatus("ESCANEAR I2C");
+  announce_result = true;
+  i2c_scanner_start();
+  if (clientNum < 32) {
+    waiting_clients |= (1UL << clientNum);
+  } else {
+    // REST / Nube no pueden esperar: reciben el estado actual ("escaneando": true)
+    replyFromCache(clientNum);
+  }
+}
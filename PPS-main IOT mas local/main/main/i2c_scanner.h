@@ -3,12 +3,29 @@
 
 #include <Arduino.h>
 
+// El escaneo no bloquea: i2c_scanner_service() prueba unas pocas direcciones
+// por cada loop() y mantiene un inventario con la última vez que respondió
+// cada dispositivo. Cada I2C_SCAN_INTERVAL_MS se re-escanea en segundo plano
+// para detectar módulos conectados o quitados en caliente.
+
 /**
- * @brief Realiza un escaneo de dispositivos en el bus I2C, actualiza la pantalla
- * y envía el resultado a un cliente WebSocket específico.
+ * @brief Responde con el inventario en caché. Si no hay inventario todavía o
+ * se pide 'refresh', inicia un escaneo y responde al terminar (con mensajes
+ * 'progreso_escaner' mientras avanza).
  * 
  * @param clientNum El ID del cliente WebSocket que recibirá la respuesta.
+ * @param refresh true para forzar un escaneo nuevo.
+ */
+void performI2CScanAndReply(uint8_t clientNum, bool refresh);
+
+/**
+ * @brief Inicia un escaneo incremental (si no hay uno en curso).
+ */
+void i2c_scanner_start();
+
+/**
+ * @brief Avanza el escaneo en curso. Llamar en cada iteración de loop().
  */
-void performI2CScanAndReply(uint8_t clientNum);
+void i2c_scanner_service();
 
 #endif // I2C_SCANNER_H
\ No newline at end of file
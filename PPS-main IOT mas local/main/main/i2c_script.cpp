@@ -0,0 +1,137 @@
+#include <Wire.h>
+#include "i2c_script.h"
+#include "i2c_bus.h"
+#include "display_handler.h"
+#include "config.h"
+#include "main_interface.h"
+
+#ifdef I2C_BUFFER_LENGTH
+#define I2C_SCRIPT_CHUNK  I2C_BUFFER_LENGTH
+#else
+#define I2C_SCRIPT_CHUNK  32
+#endif
+
+static const char HEX_DIGITS[] = "0123456789ABCDEF";
+
+static bool validAddress(int address) {
+  return address >= 8 && address <= 119;
+}
+
+void handle_i2c_script(uint8_t clientNum, JsonDocument& doc) {
+  JsonArray ops = doc["ops"].as<JsonArray>();
+  int default_address = doc["direccion"] | -1;
+
+  DynamicJsonDocument responseDoc(2048 + 2 * I2C_SCRIPT_MAX_READ);
+  responseDoc["accion"] = "respuesta_script_i2c";
+  const char* error_msg = nullptr;
+  int failed_op = -1;
+
+  if (ops.isNull() || ops.size() == 0) {
+    error_msg = "Falta la lista 'ops'.";
+  } else if (ops.size() > I2C_SCRIPT_MAX_OPS) {
+    error_msg = "Demasiadas operaciones en el guion.";
+  }
+
+  JsonArray resultados = responseDoc.createNestedArray("resultados");
+  uint8_t prefix[I2C_SCRIPT_CHUNK];   // Bytes de un write sin STOP, pendientes
+  size_t prefix_len = 0;
+  int prefix_address = -1;
+  size_t total_read = 0;
+  uint32_t script_t0 = micros();
+
+  for (size_t i = 0; !error_msg && i < ops.size(); i++) {
+    JsonObject op = ops[i];
+    const char* tipo = op["op"] | "";
+    int address = op["direccion"] | default_address;
+    JsonObject r = resultados.createNestedObject();
+    r["op"] = tipo;
+    uint32_t t0 = micros();
+    uint8_t err = 0;
+
+    if (prefix_len && (strcmp(tipo, "read") != 0 || address != prefix_address)) {
+      error_msg = "Un write con stop:false debe seguirse de un read a la misma direccion.";
+    } else if (strcmp(tipo, "delay") == 0) {
+      uint32_t us = (uint32_t)(op["ms"] | 0) * 1000UL + (uint32_t)(op["us"] | 0);
+      if (us > I2C_SCRIPT_MAX_DELAY_MS * 1000UL) us = I2C_SCRIPT_MAX_DELAY_MS * 1000UL;
+      if (us >= 1000) delay(us / 1000);
+      delayMicroseconds(us % 1000);
+    } else if (!validAddress(address)) {
+      error_msg = "Direccion I2C invalida.";
+    } else if (strcmp(tipo, "write") == 0) {
+      JsonArray bytes = op["bytes"].as<JsonArray>();
+      uint8_t buf[I2C_SCRIPT_CHUNK];
+      size_t len = 0;
+      for (JsonVariant v : bytes) {
+        if (len == sizeof(buf)) break;
+        buf[len++] = v.as<uint8_t>();
+      }
+      if (len < bytes.size()) {
+        error_msg = "Escritura mayor al buffer de Wire.";
+      } else if (op["stop"] | true) {
+        err = i2c_bus_write(address, buf, len, I2C_CLIENT_OTHER);
+      } else {
+        // Se envía junto con la lectura siguiente (START repetido)
+        memcpy(prefix, buf, len);
+        prefix_len = len;
+        prefix_address = address;
+        r["reinicio"] = true;
+      }
+      r["direccion"] = address;
+    } else if (strcmp(tipo, "read") == 0) {
+      int cantidad = op["cantidad"] | 0;
+      if (cantidad <= 0 || total_read + cantidad > I2C_SCRIPT_MAX_READ) {
+        error_msg = "Cantidad de lectura invalida o limite del guion excedido.";
+      } else {
+        char hex[2 * I2C_SCRIPT_MAX_READ + 1];
+        size_t n = 0;
+        int chunks = 0;
+        while (n < (size_t)cantidad && err == 0) {
+          uint8_t chunk[I2C_SCRIPT_CHUNK];
+          size_t len = min((size_t)cantidad - n, sizeof(chunk));
+          err = i2c_bus_read(address, prefix, prefix_len, chunk, len, I2C_CLIENT_OTHER);
+          prefix_len = 0;   // Los trozos siguientes continúan desde el puntero del dispositivo
+          if (err == 0) {
+            for (size_t k = 0; k < len; k++) {
+              hex[2 * (n + k)] = HEX_DIGITS[chunk[k] >> 4];
+              hex[2 * (n + k) + 1] = HEX_DIGITS[chunk[k] & 0x0F];
+            }
+            n += len;
+            chunks++;
+          }
+        }
+        hex[2 * n] = '\0';
+        total_read += n;
+        r["direccion"] = address;
+        r["datos"] = hex;   // Hexadecimal, 2 caracteres por byte
+        r["trozos"] = chunks;
+      }
+    } else {
+      error_msg = "Operacion desconocida (write, read o delay).";
+    }
+
+    r["us"] = micros() - t0;
+    if (err != 0) {
+      r["error"] = err;
+      error_msg = "Error I2C en el guion.";
+    }
+    if (error_msg) failed_op = i;
+  }
+
+  responseDoc["total_us"] = micros() - script_t0;
+  if (!error_msg && prefix_len) {
+    error_msg = "El guion termina con un write sin STOP.";
+  }
+  if (error_msg) {
+    responseDoc["status"] = "error";
+    responseDoc["mensaje"] = error_msg;
+    if (failed_op >= 0) responseDoc["op_fallida"] = failed_op;
+  } else {
+    responseDoc["status"] = "ok";
+  }
+
+  if (clientNum != CLOUD_CLIENT_ID) {
+    String output;
+    serializeJson(responseDoc, output);
+    enviarRespuesta(clientNum, output);
+  }
+}
@@ -0,0 +1,34 @@
+#ifndef I2C_SCRIPT_H
+#define I2C_SCRIPT_H
+
+#include <Arduino.h>
+#include <ArduinoJson.h>
+
+// ==========================================================
+// GUIONES DE TRANSACCIONES I2C (UN SOLO VIAJE DE IDA Y VUELTA)
+// ==========================================================
+// Ejecuta una lista de operaciones seguidas y responde una sola vez con
+// el resultado y el tiempo de cada una. Formato:
+//
+// {"accion":"script_i2c", "direccion":96, "ops":[
+//    {"op":"write", "bytes":[0, 1]},                 // START..STOP
+//    {"op":"write", "bytes":[16], "stop":false},     // Sin STOP: la lectura
+//    {"op":"read",  "cantidad":50},                  // siguiente usa START repetido
+//    {"op":"delay", "ms":5},                         // o "us"
+//    {"op":"read",  "direccion":104, "cantidad":300} // Otra dirección
+// ]}
+//
+// "direccion" en una op reemplaza a la del guion. Las lecturas mayores al
+// buffer de Wire se parten en trozos consecutivos (el dispositivo debe
+// auto-incrementar su puntero). El guion se detiene en la primera falla.
+
+#define I2C_SCRIPT_MAX_OPS       32
+#define I2C_SCRIPT_MAX_READ      512   // Bytes leídos en total por guion
+#define I2C_SCRIPT_MAX_DELAY_MS  100
+
+/**
+ * @brief Procesa la acción "script_i2c" y responde con "respuesta_script_i2c".
+ */
+void handle_i2c_script(uint8_t clientNum, JsonDocument& doc);
+
+#endif // I2C_SCRIPT_H
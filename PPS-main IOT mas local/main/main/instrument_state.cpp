@@ -0,0 +1,181 @@
+#include <Preferences.h>
+#include "instrument_state.h"
+#include "main_interface.h"
+#include "vfo_handler.h"
+#include "ad9850_handler.h"
+#include "adf4351_handler.h"
+#include "rf_switch_handler.h"
+#include "display_handler.h"
+#include "config.h"
+
+#define STATE_NVS_NAMESPACE  "instrumento"
+#define STATE_NVS_KEY        "estado"
+#define STATE_VERSION        1
+
+static InstrumentSnapshot saved;        // Referencia para detectar cambios
+static bool saved_valid = false;
+static bool stored = false;             // 'saved' está en flash
+static InstrumentSnapshot pending;      // Último estado visto distinto de 'saved'
+static bool dirty = false;
+static uint32_t last_change_ms = 0;
+static uint32_t last_write_ms = 0;
+static uint32_t last_poll_ms = 0;
+static uint32_t writes = 0;
+
+// ==========================================================
+// INSTANTÁNEA
+// ==========================================================
+
+void instrument_state_capture(InstrumentSnapshot& s) {
+  memset(&s, 0, sizeof(s));   // Sin basura en el relleno: se compara con memcmp
+  s.version = STATE_VERSION;
+  s.generador = rf_switch_generator_stats().current;
+  s.oscilador = rf_switch_oscillator_stats().current;
+
+  bool flag, iq;
+  vfo_get_state(&s.vfo_freq_hz, &s.vfo_paso_hz, &flag);
+  s.vfo_tx = flag;
+  vfo_get_outputs(&iq, &s.vfo_clk2_hz);
+  s.vfo_iq = iq;
+  ad9850_get_state(&s.ad9850_freq_hz, &s.ad9850_paso_hz, &flag);
+  s.ad9850_on = flag;
+  adf4351_get_state(&s.adf4351_freq_hz, &s.adf4351_paso_hz, &s.adf4351_potencia, &flag);
+  s.adf4351_on = flag;
+}
+
+static void writeSnapshot(const InstrumentSnapshot& s) {
+  Preferences prefs;
+  prefs.begin(STATE_NVS_NAMESPACE, false);
+  prefs.putBytes(STATE_NVS_KEY, &s, sizeof(s));
+  prefs.end();
+  saved = s;
+  saved_valid = true;
+  stored = true;
+  dirty = false;
+  last_write_ms = millis();
+  writes++;
+  Serial.println("[Estado] Grabado en NVS.");
+}
+
+// ==========================================================
+// RESTAURACIÓN Y SERVICIO
+// ==========================================================
+
+bool instrument_state_load() {
+  Preferences prefs;
+  prefs.begin(STATE_NVS_NAMESPACE, true);
+  saved_valid = prefs.getBytesLength(STATE_NVS_KEY) == sizeof(saved) &&
+                prefs.getBytes(STATE_NVS_KEY, &saved, sizeof(saved)) == sizeof(saved) &&
+                saved.version == STATE_VERSION;
+  stored = saved_valid;
+  prefs.end();
+
+  if (!saved_valid) Serial.println("[Estado] Sin estado guardado: valores por defecto.");
+  return saved_valid;
+}
+
+void instrument_state_apply() {
+  if (!saved_valid) return;
+
+  // Rutas primero, luego un único commit por chip. Los *_setup() no
+  // programaron nada: si un valor ya no es válido (otro firmware, otros
+  // rangos) se escriben los valores por defecto que dejaron cargados.
+  InstrumentSnapshot defaults;
+  instrument_state_capture(defaults);
+  select_generator(saved.generador);
+  select_oscillator(saved.oscilador);
+  vfo_apply_state(saved.vfo_freq_hz, saved.vfo_paso_hz, saved.vfo_tx);   // Si falla, vuelve solo al anterior
+  vfo_apply_outputs(saved.vfo_iq, saved.vfo_clk2_hz);
+  if (!ad9850_apply_state(saved.ad9850_freq_hz, saved.ad9850_paso_hz, saved.ad9850_on)) {
+    ad9850_apply_state(defaults.ad9850_freq_hz, defaults.ad9850_paso_hz, defaults.ad9850_on);
+  }
+  if (!adf4351_apply_state(saved.adf4351_freq_hz, saved.adf4351_paso_hz, saved.adf4351_potencia, saved.adf4351_on)) {
+    adf4351_apply_state(defaults.adf4351_freq_hz, defaults.adf4351_paso_hz, defaults.adf4351_potencia, defaults.adf4351_on);
+  }
+  display_mark_dirty();
+  Serial.println("[Estado] Restaurado desde NVS.");
+}
+
+void instrument_state_service() {
+  uint32_t now = millis();
+  if (now - last_poll_ms < STATE_POLL_MS) return;
+  last_poll_ms = now;
+
+  InstrumentSnapshot current;
+  instrument_state_capture(current);
+  if (saved_valid && memcmp(&current, &saved, sizeof(current)) == 0) {
+    dirty = false;   // Igual a lo grabado (o volvió a serlo): nada que escribir
+    return;
+  }
+  if (!dirty || memcmp(&current, &pending, sizeof(current)) != 0) {
+    pending = current;   // Sigue cambiando: se reinicia la agrupación
+    dirty = true;
+    last_change_ms = now;
+    return;
+  }
+
+  if (now - last_change_ms >= STATE_SAVE_DEBOUNCE_MS &&
+      (writes == 0 || now - last_write_ms >= STATE_SAVE_MIN_INTERVAL_MS)) {
+    writeSnapshot(pending);
+  }
+}
+
+// ==========================================================
+// COMANDO
+// ==========================================================
+
+static void snapshotToJson(const InstrumentSnapshot& s, JsonObject obj) {
+  obj["generador"] = s.generador;
+  obj["oscilador"] = s.oscilador;
+  JsonObject vfo = obj.createNestedObject("vfo");
+  vfo["frecuencia_hz"] = s.vfo_freq_hz;
+  vfo["paso_hz"] = s.vfo_paso_hz;
+  vfo["modo"] = s.vfo_tx ? "TX" : "RX";
+  vfo["salida"] = s.vfo_iq ? "IQ" : "NORMAL";
+  vfo["clk2_hz"] = s.vfo_clk2_hz;
+  JsonObject ad = obj.createNestedObject("ad9850");
+  ad["frecuencia_hz"] = s.ad9850_freq_hz;
+  ad["paso_hz"] = s.ad9850_paso_hz;
+  ad["habilitado"] = (bool)s.ad9850_on;
+  JsonObject adf = obj.createNestedObject("adf4351");
+  adf["frecuencia_hz"] = String(s.adf4351_freq_hz);
+  adf["paso_hz"] = s.adf4351_paso_hz;
+  adf["potencia"] = s.adf4351_potencia;
+  adf["habilitado"] = (bool)s.adf4351_on;
+}
+
+void handle_instrument_state_command(uint8_t clientNum, JsonDocument& doc) {
+  const char* sub_accion = doc["sub_accion"] | "";
+
+  StaticJsonDocument<768> responseDoc;
+  responseDoc["status"] = "ok";
+  responseDoc["accion"] = "respuesta_estado_instrumento";
+  responseDoc["sub_accion"] = sub_accion;
+
+  if (strcmp(sub_accion, "guardar") == 0) {
+    InstrumentSnapshot current;
+    instrument_state_capture(current);
+    writeSnapshot(current);
+  } else if (strcmp(sub_accion, "olvidar") == 0) {
+    Preferences prefs;
+    prefs.begin(STATE_NVS_NAMESPACE, false);
+    prefs.remove(STATE_NVS_KEY);
+    prefs.end();
+    // El estado actual pasa a ser la referencia: solo un cambio nuevo vuelve a grabar
+    instrument_state_capture(saved);
+    saved_valid = true;
+    stored = false;
+    dirty = false;
+  } else if (sub_accion[0] != '\0') {
+    responseDoc["status"] = "error";
+    responseDoc["mensaje"] = "Sub-accion no reconocida (guardar, olvidar).";
+  }
+
+  responseDoc["guardado"] = stored;
+  responseDoc["pendiente"] = dirty;
+  responseDoc["escrituras"] = writes;
+  if (stored) snapshotToJson(saved, responseDoc.createNestedObject("datos"));
+
+  String output; serializeJson(responseDoc, output);
+  enviarRespuesta(clientNum, output);
+}
@@ -0,0 +1,76 @@
+#ifndef INSTRUMENT_STATE_H
+#define INSTRUMENT_STATE_H
+
+#include <Arduino.h>
+#include <ArduinoJson.h>
+
+// ==========================================================
+// ESTADO DEL INSTRUMENTO PERSISTENTE (NVS)
+// ==========================================================
+// Guarda el estado vivo de los tres generadores y de los switches RF para
+// que el banco vuelva como quedó tras un reinicio. Los handlers no saben
+// nada de esto: instrument_state_service() toma una instantánea con los
+// *_get_state() cada STATE_POLL_MS y, si difiere de la grabada, la escribe
+// cuando pasaron STATE_SAVE_DEBOUNCE_MS sin cambios y al menos
+// STATE_SAVE_MIN_INTERVAL_MS desde la escritura anterior. Una sesión de
+// sintonía continua produce así una escritura cada tanto, nunca una por paso.
+
+// De dónde sale el estado inicial de los chips. Se decide en setup() antes
+// de inicializar el hardware, así cada chip se programa una sola vez: los
+// *_setup() cargan los valores por defecto solo con RESTORE_NONE.
+enum RestoreSource : uint8_t {
+  RESTORE_NONE,   // Sin estado guardado: valores por defecto
+  RESTORE_NVS,    // Se aplicará la instantánea de la NVS tras los *_setup()
+  RESTORE_RTC     // Reinicio en caliente: los chips siguen andando y se les
+                  // reescriben las imágenes del checkpoint (warm_restart.h)
+};
+
+struct InstrumentSnapshot {
+  uint8_t version;
+  uint8_t generador;        // Ruta del switch 1 (RF_ROUTE_UNKNOWN = no tocar)
+  uint8_t oscilador;        // Ruta del switch 2
+  uint8_t vfo_tx;
+  uint8_t vfo_iq;
+  uint8_t ad9850_on;
+  uint8_t adf4351_potencia;
+  uint8_t adf4351_on;
+  uint32_t vfo_freq_hz;
+  uint32_t vfo_paso_hz;
+  uint32_t vfo_clk2_hz;
+  uint32_t ad9850_freq_hz;
+  uint32_t ad9850_paso_hz;
+  uint32_t adf4351_paso_hz;
+  uint64_t adf4351_freq_hz;
+};
+
+/**
+ * @brief Lee el estado guardado en NVS (también es la referencia para
+ * detectar cambios). Llamar en setup() antes de los *_setup().
+ * @return true si había un estado válido.
+ */
+bool instrument_state_load();
+
+/**
+ * @brief Aplica el estado leído con un commit por chip. Llamar en setup()
+ * tras inicializar generadores y switches con RESTORE_NVS.
+ */
+void instrument_state_apply();
+
+/**
+ * @brief Instantánea del estado vivo a través de los *_get_state().
+ */
+void instrument_state_capture(InstrumentSnapshot& s);
+
+/**
+ * @brief Detecta cambios y graba en NVS con agrupación. Llamar en loop().
+ */
+void instrument_state_service();
+
+/**
+ * @brief Acción "estado_instrumento": devuelve la instantánea vigente.
+ * sub_accion "guardar" graba ya; "olvidar" borra lo guardado (el próximo
+ * arranque usa los valores por defecto).
+ */
+void handle_instrument_state_command(uint8_t clientNum, JsonDocument& doc);
+
+#endif // INSTRUMENT_STATE_H
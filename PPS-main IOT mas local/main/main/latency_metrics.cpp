@@ -0,0 +1,149 @@
+#include "latency_metrics.h"
+#include "main_interface.h"
+
+// Comandos con histograma propio; el resto cae en "otros"
+static const char* const CMD_NAMES[] = {
+  "vfo_command",
+  "ad9850_command",
+  "adf4351_command",
+  "memory_command",
+  "select_oscillator",
+  "oled_command",
+  "escanear_i2c",
+  "transaccion_i2c",
+  "script_i2c",
+  "otros",
+  "fondo",
+};
+static constexpr uint8_t CMD_COUNT = sizeof(CMD_NAMES) / sizeof(CMD_NAMES[0]);
+static constexpr uint8_t CMD_OTHER = CMD_COUNT - 2;
+static constexpr uint8_t CMD_BACKGROUND = CMD_COUNT - 1;
+
+static const char* const STAGE_NAMES[METRIC_STAGE_COUNT] = {
+  "parseo", "despacho", "planificacion", "bus", "pantalla", "envio"
+};
+
+struct MetricHistogram {
+  uint32_t count;
+  uint32_t max_cycles;
+  uint64_t total_cycles;
+  uint32_t buckets[METRIC_BUCKETS];
+};
+
+static MetricHistogram hist[CMD_COUNT][METRIC_STAGE_COUNT];
+
+// Peor caso de la respuesta: todas las etapas de todos los comandos con muestras.
+// Las claves son literales (no se copian), así que solo cuentan los nodos.
+static constexpr size_t METRICS_DOC_SIZE =
+    JSON_OBJECT_SIZE(5) + JSON_ARRAY_SIZE(CMD_COUNT) +
+    CMD_COUNT * JSON_OBJECT_SIZE(1 + METRIC_STAGE_COUNT) +
+    CMD_COUNT * METRIC_STAGE_COUNT * (JSON_OBJECT_SIZE(6) + JSON_ARRAY_SIZE(METRIC_BUCKETS));
+static uint8_t current_cmd = CMD_BACKGROUND;
+static uint32_t cpu_mhz = 0;
+
+// ==========================================================
+// REGISTRO
+// ==========================================================
+
+static void record(uint8_t cmd, MetricStage stage, uint32_t cycles) {
+  if (!cpu_mhz) cpu_mhz = getCpuFrequencyMhz();
+  MetricHistogram& h = hist[cmd][stage];
+  uint32_t us = cycles / cpu_mhz;
+  uint8_t b = us ? 32 - __builtin_clz(us) : 0;
+  if (b >= METRIC_BUCKETS) b = METRIC_BUCKETS - 1;
+  h.buckets[b]++;
+  h.count++;
+  h.total_cycles += cycles;
+  if (cycles > h.max_cycles) h.max_cycles = cycles;
+}
+
+uint8_t metrics_command_index(const char* accion) {
+  for (uint8_t i = 0; i < CMD_OTHER; i++) {
+    if (strcmp(accion, CMD_NAMES[i]) == 0) return i;
+  }
+  return CMD_OTHER;
+}
+
+void metrics_begin_command(const char* accion) {
+  current_cmd = metrics_command_index(accion);
+}
+
+void metrics_end_command() {
+  current_cmd = CMD_BACKGROUND;
+}
+
+void metrics_record(MetricStage stage, uint32_t cycles) {
+  record(current_cmd, stage, cycles);
+}
+
+void metrics_record_for(const char* accion, MetricStage stage, uint32_t cycles) {
+  record(metrics_command_index(accion), stage, cycles);
+}
+
+// ==========================================================
+// CONSULTA
+// ==========================================================
+
+// Borde superior (us) del bucket donde la cuenta acumulada alcanza la fracción pedida
+static uint32_t percentileUs(const MetricHistogram& h, uint32_t per_mille) {
+  uint64_t target = ((uint64_t)h.count * per_mille + 999) / 1000;
+  uint32_t acc = 0;
+  for (uint8_t b = 0; b < METRIC_BUCKETS; b++) {
+    acc += h.buckets[b];
+    if (acc >= target) return 1UL << b;
+  }
+  return 1UL << (METRIC_BUCKETS - 1);
+}
+
+void handle_metrics_command(uint8_t clientNum, JsonDocument& doc) {
+  const char* sub_accion = doc["sub_accion"] | "";
+  if (!cpu_mhz) cpu_mhz = getCpuFrequencyMhz();
+
+  DynamicJsonDocument responseDoc(METRICS_DOC_SIZE);
+  if (responseDoc.capacity() == 0) {
+    StaticJsonDocument<200> errorDoc;
+    errorDoc["status"] = "error";
+    errorDoc["accion"] = "respuesta_metrics";
+    errorDoc["mensaje"] = "Sin memoria para el informe de metricas.";
+    String output; serializeJson(errorDoc, output);
+    enviarRespuesta(clientNum, output);
+    return;
+  }
+  responseDoc["status"] = "ok";
+  responseDoc["accion"] = "respuesta_metrics";
+  responseDoc["cpu_mhz"] = cpu_mhz;
+  JsonArray comandos = responseDoc.createNestedArray("comandos");
+  for (uint8_t c = 0; c < CMD_COUNT; c++) {
+    JsonObject cmd;
+    for (uint8_t s = 0; s < METRIC_STAGE_COUNT; s++) {
+      const MetricHistogram& h = hist[c][s];
+      if (!h.count) continue;
+      if (cmd.isNull()) {
+        cmd = comandos.createNestedObject();
+        cmd["comando"] = CMD_NAMES[c];
+      }
+      JsonObject e = cmd.createNestedObject(STAGE_NAMES[s]);
+      e["n"] = h.count;
+      e["media_us"] = (uint32_t)(h.total_cycles / h.count / cpu_mhz);
+      e["max_us"] = h.max_cycles / cpu_mhz;
+      e["p50_us"] = percentileUs(h, 500);
+      e["p99_us"] = percentileUs(h, 990);
+      JsonArray buckets = e.createNestedArray("histograma");
+      for (uint8_t b = 0; b < METRIC_BUCKETS; b++) buckets.add(h.buckets[b]);
+    }
+  }
+
+  if (responseDoc.overflowed()) {
+    // No debería ocurrir con METRICS_DOC_SIZE; un informe truncado no se reinicia
+    responseDoc.clear();
+    responseDoc["status"] = "error";
+    responseDoc["accion"] = "respuesta_metrics";
+    responseDoc["mensaje"] = "Informe de metricas truncado.";
+  } else if (strcmp(sub_accion, "reiniciar") == 0) {
+    memset(hist, 0, sizeof(hist));
+    responseDoc["reiniciado"] = true;
+  }
+
+  String output; serializeJson(responseDoc, output);
+  enviarRespuesta(clientNum, output);
+}
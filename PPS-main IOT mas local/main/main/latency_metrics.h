@@ -0,0 +1,69 @@
+#ifndef LATENCY_METRICS_H
+#define LATENCY_METRICS_H
+
+#include <Arduino.h>
+#include <ArduinoJson.h>
+
+// ==========================================================
+// LATENCIA POR COMANDO (HISTOGRAMAS DE BUCKETS FIJOS)
+// ==========================================================
+// Cada etapa del camino caliente se mide con el contador de ciclos de la
+// CPU (una instrucción) y se acumula en un histograma del tipo de comando
+// en curso. Los buckets son potencias de dos en microsegundos:
+//   0: < 1 us, k: [2^(k-1), 2^k) us, el último incluye todo lo mayor.
+// Registrar una muestra es una división y un par de incrementos, sin
+// locks: todo se llama desde loop(). Se consulta y reinicia con "metrics".
+//
+// DISPATCH es inclusiva (contiene PLAN, BUS y SEND del mismo comando).
+// El trabajo fuera de un comando (refresco de pantalla, envío de las
+// colas WebSocket) se registra como "fondo".
+
+enum MetricStage : uint8_t {
+  METRIC_PARSE,      // deserializeJson
+  METRIC_DISPATCH,   // ejecutarComandoCentral
+  METRIC_PLAN,       // Cálculo de registros (Si5351, ADF4351)
+  METRIC_BUS,        // Escritura al chip (I2C, SPI, serie del AD9850)
+  METRIC_DISPLAY,    // Redibujado de la pantalla
+  METRIC_SEND,       // Encolado / envío de la respuesta
+  METRIC_STAGE_COUNT
+};
+
+#define METRIC_BUCKETS  16
+
+/**
+ * @brief Marca de tiempo en ciclos de CPU.
+ */
+static inline uint32_t metrics_cycles() {
+  return ESP.getCycleCount();
+}
+
+/**
+ * @brief Índice del tipo de comando ("otros" si no está en la tabla).
+ */
+uint8_t metrics_command_index(const char* accion);
+
+/**
+ * @brief Tipo de comando al que se atribuyen las muestras siguientes.
+ * metrics_end_command() vuelve a "fondo".
+ */
+void metrics_begin_command(const char* accion);
+void metrics_end_command();
+
+/**
+ * @brief Agrega una muestra al comando en curso.
+ */
+void metrics_record(MetricStage stage, uint32_t cycles);
+
+/**
+ * @brief Agrega una muestra a un comando dado (p. ej. el parseo, que
+ * ocurre antes de saber qué comando es).
+ */
+void metrics_record_for(const char* accion, MetricStage stage, uint32_t cycles);
+
+/**
+ * @brief Acción "metrics": histogramas por comando y etapa.
+ * sub_accion "reiniciar" los pone a cero después de responder.
+ */
+void handle_metrics_command(uint8_t clientNum, JsonDocument& doc);
+
+#endif // LATENCY_METRICS_H
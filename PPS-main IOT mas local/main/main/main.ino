@@ -10,7 +10,6 @@
 // ==========================================================
 #include <WiFi.h>
 #include <SPI.h>
-#include <WebServer.h>
 #include <EEPROM.h>
 #include <WebSocketsServer.h>
 #include <Wire.h>
@@ -28,6 +27,17 @@
 #include "i2c_scanner.h"
 #include "vfo_handler.h"
 #include "rf_switch_handler.h" 
+#include "i2c_bus.h"
+#include "memory_channels.h"
+#include "i2c_script.h"
+#include "web_ui.h"
+#include "http_server.h"
+#include "ws_tx.h"
+#include "boot_timeline.h"
+#include "wifi_cache.h"
+#include "instrument_state.h"
+#include "warm_restart.h"
+#include "latency_metrics.h"
 
 // INTEGRACIÓN NUBE
 #include "main_interface.h"  // Define CLOUD_CLIENT_ID y la firma de la función central
@@ -38,7 +48,6 @@
 // ==========================================================
 Adafruit_SH1106G display(ANCHO, ALTO, &Wire, -1);
 Si5351 si5351;
-WebServer server(80);
 WebSocketsServer webSocket = WebSocketsServer(81);
 StaticJsonDocument<512> doc;
 
@@ -54,7 +63,8 @@ bool si5351_present = false;
 int connectedModuleCount = 0;
 int webSocketClients = 0;
 
-bool modoCloudActivo = false;
+bool modoCloudActivo = false;     // true = modo estación (control local + nube opcional)
+bool webSocketIniciado = false;
 // ==========================================================
 // CALLBACKS DE CONEXIÓN (NUEVO)
 // ==========================================================
@@ -62,20 +72,53 @@ void startWebSocketServer(); // Prototipo
 
 // Esta función se ejecuta AUTOMÁTICAMENTE cuando la nube se conecta
 void onCloudConnect() {
-  Serial.println(F(">>> EVENTO: Nube Conectada. Iniciando WebSockets..."));
-  
-  // Iniciamos el WebSocket aquí para asegurar que el WiFi ya es estable
-  startWebSocketServer();
-  
+  Serial.println(F(">>> EVENTO: Nube Conectada."));
+  boot_mark(BOOT_CLOUD_CONNECTED);
   ipAddressLine = "IP: " + WiFi.localIP().toString();
   printToAll("ONLINE!\n" + ipAddressLine);
 }
 
+// ==========================================================
+// SERVICIO DE NUBE CON REINTENTOS
+// ==========================================================
+// ArduinoCloud.update() puede bloquear durante el handshake TLS. Mientras
+// no conecta se le da una ventana de CLOUD_ATTEMPT_MS; si falla, se deja
+// de llamar durante el backoff para que el control local no se frene.
+static bool cloudIniciada = false;
+static uint32_t cloudWindowStartMs = 0;
+static uint32_t cloudBackoffMs = CLOUD_BACKOFF_MIN_MS;
+static uint32_t cloudPausedUntilMs = 0;
+static bool cloudPaused = false;
+
+void cloudService() {
+  if (!CLOUD_ENABLED || !cloudIniciada) return;
+  uint32_t now = millis();
+
+  if (cloudPaused) {
+    if ((int32_t)(now - cloudPausedUntilMs) < 0) return;
+    cloudPaused = false;
+    cloudWindowStartMs = now;
+    Serial.println(F("[NUBE] Reintentando conexion..."));
+  }
+
+  ArduinoCloud.update();
+
+  if (ArduinoCloud.connected()) {
+    cloudBackoffMs = CLOUD_BACKOFF_MIN_MS;
+    cloudWindowStartMs = now;
+  } else if (now - cloudWindowStartMs >= CLOUD_ATTEMPT_MS) {
+    Serial.printf("[NUBE] Sin conexion; nuevo intento en %lu s.\n", (unsigned long)(cloudBackoffMs / 1000));
+    cloudPaused = true;
+    cloudPausedUntilMs = now + cloudBackoffMs;
+    cloudBackoffMs = min<uint32_t>(cloudBackoffMs * 2, CLOUD_BACKOFF_MAX_MS);
+  }
+}
+
 /*******************************************************************
 // NUEVA FUNCIÓN CENTRAL: ORQUESTADOR DE COMANDOS
 // Recibe órdenes tanto del WebSocket como del Cloud Bridge
 //*******************************************************************/
-void ejecutarComandoCentral(uint8_t clientNum, JsonDocument& doc) {
+static void despacharComando(uint8_t clientNum, JsonDocument& doc) {
   const char* accion = doc["accion"];
   
   // LOG para depuración
@@ -83,9 +126,42 @@ void ejecutarComandoCentral(uint8_t clientNum, JsonDocument& doc) {
     Serial.println("[BRIDGE] Ejecutando comando desde la Nube: " + String(accion));
   }
 
+  if (clientNum != CLOUD_CLIENT_ID) boot_mark(BOOT_FIRST_COMMAND);
+
+  // 0. TIEMPOS DE ARRANQUE
+  if (strcmp(accion, "tiempos_arranque") == 0) {
+    StaticJsonDocument<640> responseDoc;
+    responseDoc["status"] = "ok";
+    responseDoc["accion"] = "respuesta_tiempos_arranque";
+    JsonObject hitos = responseDoc.createNestedObject("hitos_ms");
+    for (uint8_t i = 0; i < BOOT_MARK_COUNT; i++) {
+      uint32_t ms = boot_mark_ms((BootMark)i);
+      if (ms) hitos[boot_mark_name((BootMark)i)] = ms;
+      else hitos[boot_mark_name((BootMark)i)] = nullptr;
+    }
+    if (wifi_cache_time_to_ip_ms()) responseDoc["wifi_ms_hasta_ip"] = wifi_cache_time_to_ip_ms();
+    else responseDoc["wifi_ms_hasta_ip"] = nullptr;
+    warm_restart_report(responseDoc.createNestedObject("reinicio"));
+    String output; serializeJson(responseDoc, output);
+    enviarRespuesta(clientNum, output);
+    return;
+  }
+
+  // 0a. LATENCIA POR COMANDO (histogramas)
+  else if (strcmp(accion, "metrics") == 0) {
+    handle_metrics_command(clientNum, doc);
+    return;
+  }
+
+  // 0b. CONEXIÓN WIFI (camino rápido / caché)
+  else if (strcmp(accion, "estado_wifi") == 0) {
+    handle_wifi_status_command(clientNum, doc);
+    return;
+  }
+
   // 1. ESCANER I2C
-  if (strcmp(accion, "escanear_i2c") == 0) {
-      performI2CScanAndReply(clientNum);
+  else if (strcmp(accion, "escanear_i2c") == 0) {
+      performI2CScanAndReply(clientNum, doc["refrescar"] | false);
       return;
   } 
 
@@ -110,6 +186,18 @@ void ejecutarComandoCentral(uint8_t clientNum, JsonDocument& doc) {
     return;
   }
   
+  // 4b. CANALES DE MEMORIA (aplican su propia ruta de switches)
+  else if (strcmp(accion, "memory_command") == 0) {
+    handle_memory_command(clientNum, doc);
+    return;
+  }
+
+  // 4c. ESTADO PERSISTENTE DEL INSTRUMENTO
+  else if (strcmp(accion, "estado_instrumento") == 0) {
+    handle_instrument_state_command(clientNum, doc);
+    return;
+  }
+  
   // 5. SELECCIÓN DE OSCILADOR (Switch Secundario)
   else if (strcmp(accion, "select_oscillator") == 0) {
     if (doc.containsKey("id")) {
@@ -120,7 +208,7 @@ void ejecutarComandoCentral(uint8_t clientNum, JsonDocument& doc) {
       String msg = "OSC " + String(osc_id) + " SELECCIONADO";
       updateOledStatus(msg); 
       delay(1000);           
-      showMainScreen();      
+      display_mark_dirty();      
 
       // Confirmación al cliente (Solo si es WebSocket real para no saturar)
       if (clientNum != CLOUD_CLIENT_ID) {
@@ -129,11 +217,35 @@ void ejecutarComandoCentral(uint8_t clientNum, JsonDocument& doc) {
         res["accion"] = "respuesta_osc_select"; 
         res["selected_id"] = osc_id; 
         String out; serializeJson(res, out); 
-        webSocket.sendTXT(clientNum, out);
+        enviarRespuesta(clientNum, out);
       }
     }
   }
   
+  // 5b. ESTADO DE LOS SWITCHES RF
+  else if (strcmp(accion, "estado_switches") == 0) {
+    if (clientNum != CLOUD_CLIENT_ID) {
+      StaticJsonDocument<384> responseDoc;
+      responseDoc["status"] = "ok";
+      responseDoc["accion"] = "respuesta_switches";
+      uint32_t now = millis();
+      const RfSwitchStats* all[2] = {&rf_switch_generator_stats(), &rf_switch_oscillator_stats()};
+      const char* nombres[2] = {"generador", "oscilador"};
+      for (uint8_t i = 0; i < 2; i++) {
+        JsonObject sw = responseDoc.createNestedObject(nombres[i]);
+        sw["ruta"] = all[i]->current;
+        sw["cambios"] = all[i]->changes;
+        sw["omitidos"] = all[i]->skipped;
+        sw["ultimo_cambio_ms"] = all[i]->last_change_ms;
+        sw["hace_ms"] = now - all[i]->last_change_ms;
+      }
+      responseDoc["asentado"] = rf_switch_is_settled();
+      String output; serializeJson(responseDoc, output);
+      enviarRespuesta(clientNum, output);
+    }
+    return;
+  }
+
   // 6. COMANDOS OLED DIRECTOS
   else if (strcmp(accion, "oled_command") == 0) {
     updateOledStatus("CMD OLED");
@@ -141,21 +253,22 @@ void ejecutarComandoCentral(uint8_t clientNum, JsonDocument& doc) {
     String mensaje_respuesta = "Comando OLED OK.";
     StaticJsonDocument<256> responseDoc;
 
-    Wire.beginTransmission(OLED_ADDR);
-    if (Wire.endTransmission() != 0) {
+    if (i2c_bus_probe(OLED_ADDR, I2C_CLIENT_DISPLAY) != 0) {
         responseDoc["status"] = "error";
         responseDoc["mensaje"] = "Fallo al comunicar con el display OLED.";
     } else {
         if (strcmp(sub_accion, "clear") == 0) {
             display.clearDisplay();
-            display.display();
+            display_request_push();
+            display_push_now();
             mensaje_respuesta = "Display limpiado.";
         } else if (strcmp(sub_accion, "print") == 0) {
             const char* texto = doc["texto"];
             display.clearDisplay();
             display.setCursor(0, 0);
             display.print(texto);
-            display.display();
+            display_request_push();
+            display_push_now();
             mensaje_respuesta = "Texto '" + String(texto) + "' escrito.";
         } else {
             mensaje_respuesta = "Sub-accion OLED no reconocida.";
@@ -168,12 +281,84 @@ void ejecutarComandoCentral(uint8_t clientNum, JsonDocument& doc) {
     if (clientNum != CLOUD_CLIENT_ID) {
       responseDoc["accion"] = "respuesta_oled";
       String output; serializeJson(responseDoc, output); 
-      webSocket.sendTXT(clientNum, output);
+      enviarRespuesta(clientNum, output);
+    }
+    return;
+  }
+
+  // 7. ESTADÍSTICAS DE OCUPACIÓN DEL BUS I2C
+  else if (strcmp(accion, "estadisticas_i2c") == 0) {
+    static const char* nombres[I2C_CLIENT_COUNT] = {"sintetizador", "display", "otros"};
+    StaticJsonDocument<2048> responseDoc;
+    responseDoc["status"] = "ok";
+    responseDoc["accion"] = "respuesta_estadisticas_i2c";
+    responseDoc["reloj_hz"] = Wire.getClock();
+    JsonObject clientes = responseDoc.createNestedObject("clientes");
+    for (uint8_t i = 0; i < I2C_CLIENT_COUNT; i++) {
+      const I2cBusStats& st = i2c_bus_stats((I2cClient)i);
+      JsonObject c = clientes.createNestedObject(nombres[i]);
+      c["transacciones"] = st.transactions;
+      c["bytes"] = st.bytes;
+      c["ocupado_us"] = st.busy_us;
+      c["max_us"] = st.max_us;
+      c["errores"] = st.errors;
+    }
+    const DisplayFrameStats& frame = display_last_frame_stats();
+    responseDoc["frame_oled_bytes"] = frame.bytes;
+    responseDoc["frame_oled_us"] = frame.us;
+    responseDoc["recuperaciones"] = i2c_bus_recoveries();
+    // Solo direcciones que alguna vez respondieron o colgaron el bus
+    JsonArray dispositivos = responseDoc.createNestedArray("dispositivos");
+    for (uint8_t addr = 1; addr < 128; addr++) {
+      const I2cDeviceStats& dev = i2c_bus_device_stats(addr);
+      if (dev.transactions == dev.nacks) continue;
+      JsonObject d = dispositivos.createNestedObject();
+      d["direccion"] = addr;
+      d["transacciones"] = dev.transactions;
+      d["lat_media_us"] = dev.total_us / dev.transactions;
+      d["lat_max_us"] = dev.max_us;
+      d["nacks"] = dev.nacks;
+      d["timeouts"] = dev.timeouts;
+      d["errores"] = dev.errors;
+      d["cuarentena_ms"] = i2c_bus_quarantine_left_ms(addr);
+    }
+    if (doc["reset"] | false) i2c_bus_reset_stats();
+
+    if (clientNum != CLOUD_CLIENT_ID) {
+      String output; serializeJson(responseDoc, output);
+      enviarRespuesta(clientNum, output);
+    }
+    return;
+  }
+
+  // 7b. COLAS DE SALIDA WEBSOCKET
+  else if (strcmp(accion, "estadisticas_ws") == 0) {
+    StaticJsonDocument<1536> responseDoc;
+    responseDoc["status"] = "ok";
+    responseDoc["accion"] = "respuesta_estadisticas_ws";
+    responseDoc["max_clientes"] = WS_MAX_CLIENTS;
+    responseDoc["conectados"] = ws_tx_client_count();
+    JsonArray clientes = responseDoc.createNestedArray("clientes");
+    for (uint8_t i = 0; i < WEBSOCKETS_SERVER_CLIENT_MAX; i++) {
+      const WsClientStats& st = ws_tx_stats(i);
+      if (!st.connected && st.sent == 0) continue;
+      JsonObject c = clientes.createNestedObject();
+      c["id"] = i;
+      c["conectado"] = st.connected;
+      c["cola_respuestas"] = st.ack_depth;
+      c["cola_estado"] = st.state_depth;
+      c["max_profundidad"] = st.max_depth;
+      c["enviados"] = st.sent;
+      c["estados_descartados"] = st.state_dropped;
+      c["desbordes"] = st.overflows;
+      c["bloqueos"] = st.blocked;
     }
+    String output; serializeJson(responseDoc, output);
+    enviarRespuesta(clientNum, output);
     return;
   }
 
-  // 7. TRANSACCIONES I2C DIRECTAS (RAW)
+  // 8. TRANSACCIONES I2C DIRECTAS (RAW)
   else if (strcmp(accion, "transaccion_i2c") == 0) {
       int direccion = doc["direccion"];
       bool error_flag = false;
@@ -186,79 +371,112 @@ void ejecutarComandoCentral(uint8_t clientNum, JsonDocument& doc) {
              responseDoc["mensaje"] = "Direccion I2C invalida.";
              responseDoc["accion"] = "respuesta_i2c";
              responseDoc["direccion"] = direccion;
-             String output; serializeJson(responseDoc, output); webSocket.sendTXT(clientNum, output);
+             String output; serializeJson(responseDoc, output); enviarRespuesta(clientNum, output);
           }
           return;
       }
 
+      // Pasa por i2c_bus para contabilizar la dirección y respetar su cuarentena
+      uint8_t wbuf[32];
+      size_t wlen = 0;
       if (doc.containsKey("bytes_a_escribir")) {
-          updateOledStatus("I2C WRITE");
-          JsonArray bytes_a_escribir = doc["bytes_a_escribir"].as<JsonArray>();
-          bool keep_connection_open = doc.containsKey("bytes_a_leer") && doc["bytes_a_leer"].as<int>() > 0;
-          Wire.beginTransmission(direccion);
-          for (JsonVariant v : bytes_a_escribir) {
-            Wire.write(v.as<byte>());
+          for (JsonVariant v : doc["bytes_a_escribir"].as<JsonArray>()) {
+            if (wlen < sizeof(wbuf)) wbuf[wlen++] = v.as<byte>();
           }
-          i2c_error = Wire.endTransmission(!keep_connection_open);
+      }
+      int bytes_a_leer = doc["bytes_a_leer"] | 0;
+
+      if (bytes_a_leer > 32) {
+          responseDoc["status"] = "error";
+          responseDoc["mensaje"] = "No se pueden leer mas de 32 bytes.";
+      } else if (bytes_a_leer > 0) {
+          // Escritura opcional + lectura con START repetido
+          updateOledStatus("I2C READ");
+          uint8_t rbuf[32];
+          i2c_error = i2c_bus_read(direccion, wbuf, wlen, rbuf, bytes_a_leer, I2C_CLIENT_OTHER);
+          if (i2c_error == 0) {
+              JsonArray datos = responseDoc.createNestedArray("datos");
+              for (int i = 0; i < bytes_a_leer; i++) {
+                datos.add(rbuf[i]);
+              }
+              responseDoc["status"] = "ok";
+          } else if (i2c_error == I2C_ERR_OTHER) {
+              responseDoc["status"] = "error";
+              responseDoc["mensaje"] = "No se recibieron los bytes esperados.";
+          } else {
+              error_flag = true;
+          }
+      } else if (doc.containsKey("bytes_a_escribir")) {
+          updateOledStatus("I2C WRITE");
+          i2c_error = i2c_bus_write(direccion, wbuf, wlen, I2C_CLIENT_OTHER);
           if (i2c_error != 0) {
             error_flag = true;
           }
       }
-
-      if (!error_flag && doc.containsKey("bytes_a_leer")) {
-          if (!error_flag) {
-              updateOledStatus("I2C READ");
-              int bytes_a_leer = doc["bytes_a_leer"];
-              if (bytes_a_leer > 0 && bytes_a_leer <= 32) {
-                  uint8_t received_bytes = Wire.requestFrom(direccion, bytes_a_leer);
-                  if (received_bytes == bytes_a_leer) {
-                      JsonArray datos = responseDoc.createNestedArray("datos");
-                      for (int i = 0; i < bytes_a_leer; i++) {
-                        datos.add(Wire.read());
-                      }
-                      responseDoc["status"] = "ok";
-                  } else {
-                      responseDoc["status"] = "error";
-                      responseDoc["mensaje"] = "No se recibieron los bytes esperados.";
-                  }
-              } else {
-                   responseDoc["status"] = "error";
-                   responseDoc["mensaje"] = "No se pueden leer mas de 32 bytes.";
-              }
-          }
-      } 
       
       if (!responseDoc.containsKey("status")) {
           if (error_flag) {
               responseDoc["status"] = "error";
-              responseDoc["mensaje"] = "Error I2C en escritura: " + String(i2c_error);
+              responseDoc["mensaje"] = (i2c_error == I2C_ERR_QUARANTINE)
+                  ? String("Direccion en cuarentena por fallas del bus.")
+                  : "Error I2C: " + String(i2c_error);
           } else {
               responseDoc["status"] = "ok";
           }
       }
       
-      delay(1000);
-      showMainScreen();
+      display_mark_dirty();
 
       if (clientNum != CLOUD_CLIENT_ID) {
         responseDoc["accion"] = "respuesta_i2c";
         responseDoc["direccion"] = direccion;
         String output; serializeJson(responseDoc, output);
-        webSocket.sendTXT(clientNum, output);
+        enviarRespuesta(clientNum, output);
       }
       return; 
   }
+
+  // 8b. GUIONES I2C (varias operaciones, una sola respuesta)
+  else if (strcmp(accion, "script_i2c") == 0) {
+      handle_i2c_script(clientNum, doc);
+      return;
+  }
   else {
     // Comando desconocido
     if (clientNum != CLOUD_CLIENT_ID) {
       StaticJsonDocument<200> errorDoc;
       errorDoc["status"] = "error"; 
       errorDoc["mensaje"] = "Accion no reconocida.";
-      String output; serializeJson(errorDoc, output); webSocket.sendTXT(clientNum, output);
+      String output; serializeJson(errorDoc, output); enviarRespuesta(clientNum, output);
     }
   }
 }
 
+// Punto de entrada común (WebSocket, REST, Nube): mide el despacho completo
+// y atribuye las etapas internas al tipo de comando (ver latency_metrics.h)
+void ejecutarComandoCentral(uint8_t clientNum, JsonDocument& doc) {
+  uint32_t t0 = metrics_cycles();
+  metrics_begin_command(doc["accion"] | "");
+  despacharComando(clientNum, doc);
+  metrics_record(METRIC_DISPATCH, metrics_cycles() - t0);
+  metrics_end_command();
+}
+
+void enviarRespuesta(uint8_t clientNum, const String& json) {
+  if (clientNum == CLOUD_CLIENT_ID) return;
+  uint32_t t0 = metrics_cycles();
+  if (clientNum == REST_CLIENT_ID) http_server_capture_reply(json);
+  else ws_tx_send(clientNum, json, true);
+  metrics_record(METRIC_SEND, metrics_cycles() - t0);
+}
+
+void enviarEstado(uint8_t clientNum, const String& json) {
+  if (clientNum == CLOUD_CLIENT_ID || clientNum == REST_CLIENT_ID) return;
+  uint32_t t0 = metrics_cycles();
+  ws_tx_send(clientNum, json, false);
+  metrics_record(METRIC_SEND, metrics_cycles() - t0);
+}
+
 /*******************************************************************
 // WEBSOCKET EVENT (REFACTORIZADO)
 // Ahora solo recibe datos y llama a ejecutarComandoCentral
@@ -267,15 +485,22 @@ void webSocketEvent(uint8_t num, WStype_t type, uint8_t * payload, size_t length
   switch (type) {
     case WStype_DISCONNECTED:
       Serial.printf("[Cliente %u] Desconectado!\n", num);
-      if(webSocketClients > 0) webSocketClients--;
-      showMainScreen();
+      ws_tx_client_disconnected(num);
+      webSocketClients = ws_tx_client_count();
+      display_mark_dirty();
       break;
       
     case WStype_CONNECTED: {
       IPAddress ip = webSocket.remoteIP(num);
       Serial.printf("[Cliente %u] Conectado desde %d.%d.%d.%d\n", num, ip[0], ip[1], ip[2], ip[3]);
-      webSocketClients++;
-      showMainScreen();
+      if (!ws_tx_client_connected(num)) {
+        Serial.printf("[Cliente %u] Rechazado: limite de %d clientes.\n", num, WS_MAX_CLIENTS);
+        webSocket.sendTXT(num, "{\"status\":\"error\",\"mensaje\":\"Limite de clientes alcanzado.\"}");
+        webSocket.disconnect(num);
+        break;
+      }
+      webSocketClients = ws_tx_client_count();
+      display_mark_dirty();
       // Al conectarse un nuevo cliente, le enviamos el estado actual del VFO
       doc.clear();
       handleVfoCommand(num, doc); 
@@ -285,12 +510,15 @@ void webSocketEvent(uint8_t num, WStype_t type, uint8_t * payload, size_t length
     case WStype_TEXT:
       Serial.println("[Cliente " + String(num) + "] RX: " + String((char*)payload));
       doc.clear();
+      uint32_t t0 = metrics_cycles();
       DeserializationError error = deserializeJson(doc, payload);
+      uint32_t parseCycles = metrics_cycles() - t0;
 
       if (error) { 
         Serial.println(F("Error deserializando JSON"));
         return; 
       }
+      metrics_record_for(doc["accion"] | "", METRIC_PARSE, parseCycles);
 
       // LLAMADA A LA LÓGICA CENTRAL
       ejecutarComandoCentral(num, doc);
@@ -301,6 +529,8 @@ void webSocketEvent(uint8_t num, WStype_t type, uint8_t * payload, size_t length
 void startWebSocketServer() {
   webSocket.begin();
   webSocket.onEvent(webSocketEvent);
+  webSocketIniciado = true;
+  boot_mark(BOOT_WS_READY);
   Serial.println(F("Servidor WebSocket Iniciado."));
 }
 
@@ -309,31 +539,6 @@ void startWebSocketServer() {
 //*******************************************************************
 void setup() {
   Serial.begin(115200);
-  Wire.begin(); 
-  Wire.setTimeOut(250); 
-  
-  display_setup();
-  delay(1000);
-  
-  // --- ESCANEO I2C ---
-  printToAll("Escaneando modulos...");
-  byte count = 0;
-  for (byte i = 1; i < 127; i++) {
-    if (i == OLED_ADDR) continue;
-    Wire.beginTransmission(i);
-    if (Wire.endTransmission() == 0) {
-      count++;
-    }
-  }
-  connectedModuleCount = count;
-  Serial.printf("Se encontraron %d modulos I2C.\n", connectedModuleCount);
-  delay(1500);
-
-  // --- INICIALIZACIÓN DE HARDWARE ---
-  vfo_setup(); delay(100);
-  ad9850_setup(); delay(100);
-  adf4351_setup(); delay(100);
-  rf_switch_setup();
 
   // --- LECTURA DE CREDENCIALES ---
   EEPROM.begin(512);
@@ -341,22 +546,55 @@ void setup() {
   String pass = EEPROM.readString(100);
   EEPROM.end();
 
-  // --- INTENTO DE CONEXIÓN MANUAL (SIN NUBE AÚN) ---
+  // --- ASOCIACIÓN WIFI EN PARALELO ---
+  // La pila WiFi negocia con el AP en su propia tarea mientras se
+  // inicializa el hardware; se la espera recién al final. Con caché
+  // válido va directo al canal y BSSID conocidos (ver wifi_cache.h).
+  if (ssid.length() > 0) {
+    WiFi.mode(WIFI_STA);
+    wifi_cache_begin(ssid, pass);
+    boot_mark(BOOT_WIFI_STARTED);
+  }
+
+  i2c_bus_begin();
+  display_setup();
+  boot_mark(BOOT_DISPLAY_READY);
+  
+  // --- ESCANEO I2C ---
+  // Corre por trozos desde loop(); connectedModuleCount se actualiza al terminar
+  i2c_scanner_start();
+
+  // --- INICIALIZACIÓN DE HARDWARE ---
+  // El estado de la última sesión se lee antes: si hay uno, los chips no
+  // se programan con los valores por defecto y solo reciben ese estado.
+  // Tras un reinicio en caliente, desde las imágenes en RTC (sin reiniciar
+  // los chips); si no, desde la NVS (re-planificando).
+  // Cada chip espera su propia condición de listo (sin pausas fijas)
+  bool hayEstado = instrument_state_load();   // También es la referencia para grabar cambios
+  RestoreSource restore = warm_restart_begin() ? RESTORE_RTC
+                        : hayEstado ? RESTORE_NVS : RESTORE_NONE;
+  vfo_setup(restore);
+  boot_mark(BOOT_SI5351_READY);
+  ad9850_setup(restore);
+  boot_mark(BOOT_AD9850_READY);
+  adf4351_setup(restore);
+  boot_mark(BOOT_ADF4351_READY);
+  rf_switch_setup(restore);
+  boot_mark(BOOT_RF_SWITCH_READY);
+  memory_channels_setup();
+  if (restore == RESTORE_RTC) warm_restart_apply();
+  else if (restore == RESTORE_NVS) instrument_state_apply();
+  boot_mark(BOOT_HARDWARE_DONE);
+
+  // --- ESPERA DE LA CONEXIÓN (SIN NUBE AÚN) ---
   bool wifiConectado = false;
 
   if(ssid.length() > 0){
     printToAll("Conectando WiFi:\n" + ssid);
-    
-    // Forzamos modo estación e intentamos conectar
-    WiFi.mode(WIFI_STA);
-    WiFi.begin(ssid.c_str(), pass.c_str());
-
-    // Esperamos 15 segundos (30 intentos de 500ms)
-    int intentos = 0;
-    while (WiFi.status() != WL_CONNECTED && intentos < 30) {
-      delay(500);
-      Serial.print(".");
-      intentos++;
+    uint32_t t0 = millis();
+    while (WiFi.status() != WL_CONNECTED && millis() - t0 < WIFI_CONNECT_TIMEOUT_MS) {
+      wifi_cache_service();
+      delay(10);
     }
 
     if (WiFi.status() == WL_CONNECTED) {
@@ -369,21 +607,35 @@ void setup() {
     // === CAMINO A: ÉXITO ===
     modoCloudActivo = true;
     ipAddressLine = "IP: " + WiFi.localIP().toString();
-    printToAll("WiFi OK. Iniciando Cloud...");
-
+    boot_mark(BOOT_WIFI_IP);
+    wifi_cache_on_connected();
+
+    // Control local primero: no depende de la nube
+    startWebSocketServer();
+    // Panel web desde la flash y espejo REST (puerto 80, tarea propia)
+    httpd_handle_t http = http_server_start();
+    web_ui_register(http);
+    http_server_register_api(http);
+    printToAll("LOCAL OK\n" + ipAddressLine);
+
+#if CLOUD_ENABLED
+    // La nube queda como servicio en segundo plano (ver cloudService())
     // 1. Configurar handler (necesario para la librería)
     ArduinoIoTPreferredConnection = new WiFiConnectionHandler(ssid.c_str(), pass.c_str());
     
     // 2. Inicializar propiedades
     initProperties(); 
     
-    // 3. Callback para iniciar WebSocket cuando la nube esté lista
+    // 3. Callback informativo cuando la nube esté lista
     ArduinoCloud.addCallback(ArduinoIoTCloudEvent::CONNECT, onCloudConnect);
 
     // 4. Arrancar la nube
     ArduinoCloud.begin(*ArduinoIoTPreferredConnection);
     setDebugMessageLevel(2);
     ArduinoCloud.printDebugInfo();
+    cloudIniciada = true;
+    cloudWindowStartMs = millis();
+#endif
 
   } else {
     // === CAMINO B: FALLO (MODO AP) ===
@@ -399,23 +651,37 @@ void setup() {
   
   Serial.print("Memoria Libre: ");
   Serial.println(ESP.getFreeHeap());
+  boot_mark(BOOT_SETUP_DONE);
 }
 void loop() {
+  // Pantalla: dibuja el último estado (si cambió) y lo envía por trozos
+  display_service();
+  i2c_bus_service();
+  i2c_scanner_service();
+  memory_channels_service();
+  instrument_state_service();
+  warm_restart_service();
+
   if (modoCloudActivo) {
     // --- MODO ONLINE ---
     
-    // 1. WebSocket Local (Prioridad)
-    if (WiFi.status() == WL_CONNECTED) {
+    // 1. WebSocket Local (Prioridad). La pila local completa (WebSocket,
+    // panel y REST) se levanta en setup() junto con la IP; sin IP a tiempo
+    // se pasa a modo AP y este camino no se usa.
+    if (webSocketIniciado && WiFi.status() == WL_CONNECTED) {
       webSocket.loop();
+      ws_tx_service();
     }
     
-    // 2. Arduino Cloud
-    ArduinoCloud.update();
+    // 2. Comandos REST encolados por el servidor HTTP
+    http_server_service();
+
+    // 3. Arduino Cloud (opcional, con reintentos)
+    cloudService();
     
   } else {
     // --- MODO AP (OFFLINE) ---
-    // Aquí SOLO atendemos al servidor web de configuración.
+    // El portal de configuración lo atiende la tarea del servidor HTTP.
     // NO llamamos a ArduinoCloud.update() para evitar bloqueos.
-    server.handleClient();
   }
 }
\ No newline at end of file
@@ -4,8 +4,21 @@
 #include <ArduinoJson.h>
 
 #define CLOUD_CLIENT_ID 255 
+#define REST_CLIENT_ID  254   // Pedidos HTTP a /api/... (ver http_server.h)
 
 // Debe decir JsonDocument&
 void ejecutarComandoCentral(uint8_t clientNum, JsonDocument& doc);
 
+/**
+ * @brief Entrega la respuesta de un comando a quien lo pidió: un cliente
+ * WebSocket, el pedido REST en curso, o nadie (Nube).
+ */
+void enviarRespuesta(uint8_t clientNum, const String& json);
+
+/**
+ * @brief Igual que enviarRespuesta() pero para mensajes de estado/progreso:
+ * si el cliente va atrasado solo recibe el más reciente.
+ */
+void enviarEstado(uint8_t clientNum, const String& json);
+
 #endif
\ No newline at end of file
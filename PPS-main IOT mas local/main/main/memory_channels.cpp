@@ -0,0 +1,183 @@
+#include <Preferences.h>
+#include "memory_channels.h"
+#include "main_interface.h"
+#include "vfo_handler.h"
+#include "ad9850_handler.h"
+#include "adf4351_handler.h"
+#include "rf_switch_handler.h"
+#include "display_handler.h"
+#include "config.h"
+
+#define MEM_NVS_NAMESPACE  "memorias"
+#define MEM_NVS_KEY        "tabla"
+
+static MemoryChannel channels[MEM_CHANNEL_COUNT];
+static bool table_dirty = false;
+static uint32_t last_change_ms = 0;
+
+// ==========================================================
+// PERSISTENCIA
+// ==========================================================
+
+static void clearTable() {
+  memset(channels, 0, sizeof(channels));
+  for (uint8_t i = 0; i < MEM_CHANNEL_COUNT; i++) channels[i].generador = MEM_GEN_FREE;
+}
+
+static void markDirty() {
+  table_dirty = true;
+  last_change_ms = millis();
+}
+
+void memory_channels_setup() {
+  Preferences prefs;
+  prefs.begin(MEM_NVS_NAMESPACE, true);
+  size_t len = prefs.getBytesLength(MEM_NVS_KEY);
+  // Si el formato cambió de tamaño se descarta en lugar de leer basura
+  if (len != sizeof(channels) || prefs.getBytes(MEM_NVS_KEY, channels, sizeof(channels)) != sizeof(channels)) {
+    clearTable();
+  }
+  prefs.end();
+
+  uint8_t used = 0;
+  for (uint8_t i = 0; i < MEM_CHANNEL_COUNT; i++) if (channels[i].generador != MEM_GEN_FREE) used++;
+  Serial.printf("Memorias: %d/%d canales en uso.\n", used, MEM_CHANNEL_COUNT);
+}
+
+void memory_channels_service() {
+  if (!table_dirty || millis() - last_change_ms < MEM_SAVE_DEBOUNCE_MS) return;
+  Preferences prefs;
+  prefs.begin(MEM_NVS_NAMESPACE, false);
+  prefs.putBytes(MEM_NVS_KEY, channels, sizeof(channels));
+  prefs.end();
+  table_dirty = false;
+  Serial.println("[MEM] Tabla grabada en NVS.");
+}
+
+// ==========================================================
+// CAPTURA Y APLICACIÓN DE PRESETS
+// ==========================================================
+
+// Copia el estado vivo del generador al canal
+static bool captureChannel(MemoryChannel& ch, uint8_t generador) {
+  bool en = false;
+  ch.generador = generador;
+  ch.potencia = 0;
+  if (generador == 0) {
+    uint32_t f, paso;
+    vfo_get_state(&f, &paso, &en);
+    ch.frecuencia_hz = f;
+    ch.paso_hz = paso;
+  } else if (generador == 1) {
+    uint32_t f, paso;
+    ad9850_get_state(&f, &paso, &en);
+    ch.frecuencia_hz = f;
+    ch.paso_hz = paso;
+  } else if (generador == 2) {
+    adf4351_get_state(&ch.frecuencia_hz, &ch.paso_hz, &ch.potencia, &en);
+  } else {
+    return false;
+  }
+  ch.habilitado = en;
+  return true;
+}
+
+// Ruta del switch + un commit de hardware al chip del preset
+static bool applyChannel(const MemoryChannel& ch) {
+  select_generator(ch.generador);
+  if (ch.oscilador != MEM_OSC_KEEP) select_oscillator(ch.oscilador);
+  switch (ch.generador) {
+    case 0: return vfo_apply_state((uint32_t)ch.frecuencia_hz, ch.paso_hz, ch.habilitado);
+    case 1: return ad9850_apply_state((uint32_t)ch.frecuencia_hz, ch.paso_hz, ch.habilitado);
+    case 2: return adf4351_apply_state(ch.frecuencia_hz, ch.paso_hz, ch.potencia, ch.habilitado);
+  }
+  return false;
+}
+
+static void channelToJson(uint8_t idx, JsonObject obj) {
+  const MemoryChannel& ch = channels[idx];
+  obj["canal"] = idx;
+  obj["nombre"] = ch.nombre;
+  obj["generador"] = ch.generador;
+  obj["frecuencia_hz"] = String(ch.frecuencia_hz);
+  obj["paso_hz"] = ch.paso_hz;
+  obj["potencia"] = ch.potencia;
+  obj["habilitado"] = (bool)ch.habilitado;
+  if (ch.oscilador != MEM_OSC_KEEP) obj["oscilador"] = ch.oscilador;
+}
+
+// Pide al handler del generador que envíe su estado (sin sub_accion no toca el hardware)
+static void replyGeneratorStatus(uint8_t clientNum, uint8_t generador) {
+  StaticJsonDocument<64> statusDoc;
+  if (generador == 0) handleVfoCommand(clientNum, statusDoc);
+  else if (generador == 1) handle_ad9850_command(clientNum, statusDoc);
+  else if (generador == 2) handle_adf4351_command(clientNum, statusDoc);
+}
+
+// ==========================================================
+// COMANDOS
+// ==========================================================
+
+void handle_memory_command(uint8_t clientNum, JsonDocument& doc) {
+  const char* sub_accion = doc["sub_accion"] | "";
+  int canal = doc["canal"] | -1;
+  bool canal_valido = canal >= 0 && canal < MEM_CHANNEL_COUNT;
+
+  DynamicJsonDocument responseDoc(2048);
+  responseDoc["status"] = "ok";
+  responseDoc["accion"] = "respuesta_memoria";
+  responseDoc["sub_accion"] = sub_accion;
+
+  if (strcmp(sub_accion, "listar") == 0) {
+    JsonArray lista = responseDoc.createNestedArray("canales");
+    for (uint8_t i = 0; i < MEM_CHANNEL_COUNT; i++) {
+      if (channels[i].generador != MEM_GEN_FREE) channelToJson(i, lista.createNestedObject());
+    }
+  }
+  else if (!canal_valido) {
+    responseDoc["status"] = "error";
+    responseDoc["mensaje"] = "Canal invalido (0-" + String(MEM_CHANNEL_COUNT - 1) + ").";
+  }
+  else if (strcmp(sub_accion, "guardar") == 0) {
+    MemoryChannel ch = {};
+    uint8_t generador = doc["generador"] | 255;
+    if (!captureChannel(ch, generador)) {
+      responseDoc["status"] = "error";
+      responseDoc["mensaje"] = "Generador invalido (0 VFO, 1 AD9850, 2 ADF4351).";
+    } else {
+      strlcpy(ch.nombre, doc["nombre"] | "", MEM_NAME_LEN);
+      ch.oscilador = doc["oscilador"] | MEM_OSC_KEEP;
+      channels[canal] = ch;
+      markDirty();
+      channelToJson(canal, responseDoc.createNestedObject("datos"));
+    }
+  }
+  else if (strcmp(sub_accion, "recuperar") == 0) {
+    const MemoryChannel& ch = channels[canal];
+    if (ch.generador == MEM_GEN_FREE || !applyChannel(ch)) {
+      responseDoc["status"] = "error";
+      responseDoc["mensaje"] = "Canal vacio o preset fuera de rango.";
+    } else {
+      channelToJson(canal, responseDoc.createNestedObject("datos"));
+      display_mark_dirty();
+    }
+  }
+  else if (strcmp(sub_accion, "borrar") == 0) {
+    memset(&channels[canal], 0, sizeof(MemoryChannel));
+    channels[canal].generador = MEM_GEN_FREE;
+    markDirty();
+  }
+  else {
+    responseDoc["status"] = "error";
+    responseDoc["mensaje"] = "Sub-accion de memoria no reconocida.";
+  }
+
+  if (clientNum != CLOUD_CLIENT_ID) {
+    String output; serializeJson(responseDoc, output);
+    enviarRespuesta(clientNum, output);
+    // Tras recuperar, el panel del generador recibe su estado habitual
+    if (strcmp(sub_accion, "recuperar") == 0 && responseDoc["status"] == "ok") {
+      replyGeneratorStatus(clientNum, channels[canal].generador);
+    }
+  }
+}
@@ -0,0 +1,45 @@
+#ifndef MEMORY_CHANNELS_H
+#define MEMORY_CHANNELS_H
+
+#include <Arduino.h>
+#include <ArduinoJson.h>
+
+// ==========================================================
+// CANALES DE MEMORIA (TODOS LOS GENERADORES)
+// ==========================================================
+// Tabla fija de MEM_CHANNEL_COUNT canales en RAM, respaldada en NVS como
+// un único blob. La recuperación es un acceso directo por número de canal
+// y aplica el preset con un solo commit de hardware por chip.
+// Las escrituras a flash se agrupan: guardar/borrar solo marca la tabla
+// y memory_channels_service() la graba tras MEM_SAVE_DEBOUNCE_MS sin cambios.
+
+#define MEM_NAME_LEN     12
+#define MEM_GEN_FREE     0xFF
+#define MEM_OSC_KEEP     0xFF   // No tocar el switch de osciladores
+
+struct MemoryChannel {
+  char nombre[MEM_NAME_LEN];
+  uint8_t generador;      // 0: VFO, 1: AD9850, 2: ADF4351, MEM_GEN_FREE: libre
+  uint8_t potencia;       // Solo ADF4351 (0..3)
+  uint8_t habilitado;     // Salida ON (AD9850/ADF4351) o TX (VFO)
+  uint8_t oscilador;      // Ruta del switch 2, o MEM_OSC_KEEP
+  uint64_t frecuencia_hz;
+  uint32_t paso_hz;
+};
+
+/**
+ * @brief Carga la tabla desde NVS. Llamar en setup() tras inicializar los generadores.
+ */
+void memory_channels_setup();
+
+/**
+ * @brief Graba la tabla en NVS si hubo cambios y pasó el tiempo de agrupación.
+ */
+void memory_channels_service();
+
+/**
+ * @brief Comandos "memory_command": guardar, recuperar, borrar, listar.
+ */
+void handle_memory_command(uint8_t clientNum, JsonDocument& doc);
+
+#endif // MEMORY_CHANNELS_H
@@ -1,7 +1,7 @@
 #include <WiFi.h>
-#include <WebServer.h>
 #include <EEPROM.h>
 #include "portal_config.h"
+#include "http_server.h"
 
 // ==========================================================
 // DECLARACIÓN DE OBJETOS Y FUNCIONES EXTERNAS
@@ -9,7 +9,6 @@
 // Estos objetos y variables están definidos en el archivo principal.
 // Se declaran aquí como 'extern' para que este archivo sepa de su existencia.
 
-extern WebServer server;
 extern const char* ap_ssid;
 extern const char* ap_pass;
 
@@ -49,8 +48,28 @@ const char page_root[] PROGMEM =
 "</form></body></html>";
 
 // Esta función ahora solo envía el HTML desde PROGMEM (sin ocupar RAM)
-void handleRoot() {
-  server.send_P(200, "text/html", page_root);
+static esp_err_t handleRoot(httpd_req_t* req) {
+  httpd_resp_set_type(req, "text/html; charset=utf-8");
+  return httpd_resp_send(req, page_root, HTTPD_RESP_USE_STRLEN);
+}
+
+/**
+ * @brief Decodifica en el lugar un campo de formulario (application/x-www-form-urlencoded).
+ */
+static void urlDecode(char* s) {
+  char* out = s;
+  for (; *s; s++) {
+    if (*s == '+') {
+      *out++ = ' ';
+    } else if (*s == '%' && isxdigit((unsigned char)s[1]) && isxdigit((unsigned char)s[2])) {
+      char hex[3] = {s[1], s[2], '\0'};
+      *out++ = (char)strtol(hex, nullptr, 16);
+      s += 2;
+    } else {
+      *out++ = *s;
+    }
+  }
+  *out = '\0';
 }
 
 
@@ -58,22 +77,31 @@ void handleRoot() {
  * @brief Maneja el envío del formulario desde "/save". Guarda las
  * credenciales en la EEPROM y reinicia el dispositivo.
  */
-void handleSave() {
-  if (server.hasArg("ssid") && server.hasArg("pass")) {
-    String ssidInput = server.arg("ssid");
-    String passInput = server.arg("pass");
+static esp_err_t handleSave(httpd_req_t* req) {
+  char body[256];
+  int len = (req->content_len < sizeof(body)) ? httpd_req_recv(req, body, req->content_len) : -1;
+  char ssidInput[96], passInput[128];
+  if (len > 0) body[len] = '\0';
+  if (len > 0 &&
+      httpd_query_key_value(body, "ssid", ssidInput, sizeof(ssidInput)) == ESP_OK &&
+      httpd_query_key_value(body, "pass", passInput, sizeof(passInput)) == ESP_OK) {
+    urlDecode(ssidInput);
+    urlDecode(passInput);
     EEPROM.begin(512);
     EEPROM.writeString(0, ssidInput);
     EEPROM.writeString(100, passInput);
     EEPROM.commit();
     EEPROM.end();
     printToAll("Datos guardados!\nReiniciando...");
-    server.send(200, "text/html", "<h1>Datos guardados! Reiniciando ESP32...</h1>");
+    httpd_resp_set_type(req, "text/html");
+    httpd_resp_send(req, "<h1>Datos guardados! Reiniciando ESP32...</h1>", HTTPD_RESP_USE_STRLEN);
     delay(2000);
     ESP.restart();
-  } else {
-    server.send(400, "text/plain", "Faltan datos");
+    return ESP_OK;
   }
+  httpd_resp_set_status(req, "400 Bad Request");
+  httpd_resp_set_type(req, "text/plain");
+  return httpd_resp_send(req, "Faltan datos", HTTPD_RESP_USE_STRLEN);
 }
 
 /**
@@ -86,7 +114,10 @@ void startAP() {
   msg += "Red: " + String(ap_ssid) + "\n";
   msg += "IP: " + WiFi.softAPIP().toString();
   printToAll(msg);
-  server.on("/", handleRoot);
-  server.on("/save", HTTP_POST, handleSave);
-  server.begin();
+  httpd_handle_t server = http_server_start();
+  if (!server) return;
+  httpd_uri_t root_uri = {"/", HTTP_GET, handleRoot, nullptr};
+  httpd_uri_t save_uri = {"/save", HTTP_POST, handleSave, nullptr};
+  httpd_register_uri_handler(server, &root_uri);
+  httpd_register_uri_handler(server, &save_uri);
 }
\ No newline at end of file
@@ -1,32 +1,104 @@
+#include <soc/gpio_struct.h>
 #include "rf_switch_handler.h"
 #include "config.h"
 
-static void set_pins_binary(uint8_t pin1, uint8_t pin2, uint8_t pin3, uint8_t value) {
-    digitalWrite(pin1, (value >> 0) & 1);
-    digitalWrite(pin2, (value >> 1) & 1);
-    digitalWrite(pin3, (value >> 2) & 1);
+// ==========================================================
+// ESCRITURA ATÓMICA DE LAS LÍNEAS DE CONTROL
+// ==========================================================
+// Las seis líneas están en los GPIO 0..31 (registro GPIO.out), así que el
+// código nuevo de un switch entra en un único store. La posición lógica
+// (generador u oscilador) es directamente el código binario de las líneas.
+static_assert(RF_SWITCH_1_PIN_1 < 32 && RF_SWITCH_1_PIN_2 < 32 && RF_SWITCH_1_PIN_3 < 32 &&
+              RF_SWITCH_2_PIN_1 < 32 && RF_SWITCH_2_PIN_2 < 32 && RF_SWITCH_2_PIN_3 < 32,
+              "Las líneas de los switches deben estar en GPIO.out (GPIO < 32)");
+
+struct RfSwitch {
+  uint8_t pins[3];
+  uint32_t mask;        // Bits en GPIO.out
+  uint32_t settled_at_us;
+  RfSwitchStats stats;
+};
+
+static RfSwitch switch_gen = {{RF_SWITCH_1_PIN_1, RF_SWITCH_1_PIN_2, RF_SWITCH_1_PIN_3}, 0, 0, {RF_ROUTE_UNKNOWN, 0, 0, 0}};
+static RfSwitch switch_osc = {{RF_SWITCH_2_PIN_1, RF_SWITCH_2_PIN_2, RF_SWITCH_2_PIN_3}, 0, 0, {RF_ROUTE_UNKNOWN, 0, 0, 0}};
+static portMUX_TYPE rf_mux = portMUX_INITIALIZER_UNLOCKED;
+
+static void prepareMask(RfSwitch& sw) {
+  for (uint8_t i = 0; i < 3; i++) sw.mask |= (1UL << sw.pins[i]);
+}
+
+static void writeRoute(RfSwitch& sw, uint8_t id) {
+  uint32_t bits = 0;
+  for (uint8_t i = 0; i < 3; i++) {
+    if ((id >> i) & 1) bits |= (1UL << sw.pins[i]);
+  }
+
+  portENTER_CRITICAL(&rf_mux);
+  GPIO.out = (GPIO.out & ~sw.mask) | bits;
+  portEXIT_CRITICAL(&rf_mux);
+  sw.settled_at_us = micros() + RF_SWITCH_SETTLE_US;
+  sw.stats.current = id;
+  sw.stats.changes++;
+  sw.stats.last_change_ms = millis();
+}
+
+static void waitSettled(const RfSwitch& sw) {
+  int32_t left = (int32_t)(sw.settled_at_us - micros());
+  if (left <= 0) return;
+  if (left >= 1000) delay(left / 1000);
+  delayMicroseconds(left % 1000);
 }
 
-void rf_switch_setup() {
+void rf_switch_setup(RestoreSource restore) {
     pinMode(RF_SWITCH_1_PIN_1, OUTPUT);
     pinMode(RF_SWITCH_1_PIN_2, OUTPUT);
     pinMode(RF_SWITCH_1_PIN_3, OUTPUT);
     pinMode(RF_SWITCH_2_PIN_1, OUTPUT);
     pinMode(RF_SWITCH_2_PIN_2, OUTPUT);
     pinMode(RF_SWITCH_2_PIN_3, OUTPUT);
-    select_generator(0);
-    select_oscillator(0);
+    prepareMask(switch_gen);
+    prepareMask(switch_osc);
+    if (restore == RESTORE_NONE) {
+        select_generator(0);
+        select_oscillator(0);
+    }
     Serial.println("RF Switch Handler (simplificado) inicializado.");
 }
 
 void select_generator(uint8_t generator_id) {
     if (generator_id > 7) return;
+    if (generator_id == switch_gen.stats.current) {
+        switch_gen.stats.skipped++;
+        waitSettled(switch_gen);   // Por si el cambio anterior todavía se asienta
+        return;
+    }
     Serial.printf("[Switch] Seleccionando Generador: %d\n", generator_id);
-    set_pins_binary(RF_SWITCH_1_PIN_1, RF_SWITCH_1_PIN_2, RF_SWITCH_1_PIN_3, generator_id);
+    writeRoute(switch_gen, generator_id);
+    waitSettled(switch_gen);
 }
 
 void select_oscillator(uint8_t oscillator_id) {
     if (oscillator_id > 7) return;
+    if (oscillator_id == switch_osc.stats.current) {
+        switch_osc.stats.skipped++;
+        waitSettled(switch_osc);
+        return;
+    }
     Serial.printf("[Switch] Seleccionando Oscilador: %d\n", oscillator_id);
-    set_pins_binary(RF_SWITCH_2_PIN_1, RF_SWITCH_2_PIN_2, RF_SWITCH_2_PIN_3, oscillator_id);
-}
\ No newline at end of file
+    writeRoute(switch_osc, oscillator_id);
+    waitSettled(switch_osc);
+}
+
+bool rf_switch_is_settled() {
+    uint32_t now = micros();
+    return (int32_t)(switch_gen.settled_at_us - now) <= 0 &&
+           (int32_t)(switch_osc.settled_at_us - now) <= 0;
+}
+
+const RfSwitchStats& rf_switch_generator_stats() {
+    return switch_gen.stats;
+}
+
+const RfSwitchStats& rf_switch_oscillator_stats() {
+    return switch_osc.stats;
+}
@@ -2,9 +2,36 @@
 #define RF_SWITCH_HANDLER_H
 
 #include <Arduino.h>
+#include "instrument_state.h"
 
-void rf_switch_setup();
+// Cada switch se controla con 3 líneas que se escriben juntas en el
+// registro de salida del GPIO, así nunca pasa por un código intermedio.
+// select_generator() / select_oscillator() vuelven cuando la ruta ya
+// está asentada (RF_SWITCH_SETTLE_US). Si la ruta pedida ya es la
+// actual no se toca el hardware ni se registra nada.
+
+#define RF_ROUTE_UNKNOWN  0xFF
+
+/**
+ * @brief Historial de un switch, para correlacionar glitches con cambios de ruta.
+ */
+struct RfSwitchStats {
+  uint8_t current;          // Posición actual (RF_ROUTE_UNKNOWN antes de la primera)
+  uint32_t changes;         // Cambios reales de ruta
+  uint32_t skipped;         // Pedidos que ya coincidían con la ruta actual
+  uint32_t last_change_ms;  // millis() del último cambio
+};
+
+void rf_switch_setup(RestoreSource restore);
 void select_generator(uint8_t generator_id);
 void select_oscillator(uint8_t oscillator_id);
 
+/**
+ * @brief true si ambos switches terminaron de asentarse.
+ */
+bool rf_switch_is_settled();
+
+const RfSwitchStats& rf_switch_generator_stats();
+const RfSwitchStats& rf_switch_oscillator_stats();
+
 #endif // RF_SWITCH_HANDLER_H
\ No newline at end of file
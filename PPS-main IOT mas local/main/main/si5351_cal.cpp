@@ -0,0 +1,98 @@
+#include <Preferences.h>
+#include <driver/pcnt.h>
+#include <esp_timer.h>
+#include "si5351_cal.h"
+#include "config.h"
+
+#define CAL_NVS_NAMESPACE  "si5351"
+#define CAL_NVS_KEY        "corr_ppb"
+#define CAL_PCNT_UNIT      PCNT_UNIT_0
+#define CAL_PCNT_LIMIT     30000
+
+static volatile uint32_t pcnt_overflows = 0;
+static bool pcnt_isr_ready = false;
+
+// ==========================================================
+// PERSISTENCIA (NVS)
+// ==========================================================
+
+int32_t si5351_cal_load() {
+  Preferences prefs;
+  prefs.begin(CAL_NVS_NAMESPACE, true);
+  int32_t ppb = prefs.getInt(CAL_NVS_KEY, SI5351_CORRECTION);
+  prefs.end();
+  return ppb;
+}
+
+bool si5351_cal_save(int32_t correction_ppb) {
+  Preferences prefs;
+  prefs.begin(CAL_NVS_NAMESPACE, false);
+  bool ok = prefs.putInt(CAL_NVS_KEY, correction_ppb) == sizeof(int32_t);
+  prefs.end();
+  return ok;
+}
+
+// ==========================================================
+// MEDICIÓN CON EL CONTADOR DE PULSOS
+// ==========================================================
+
+// El servicio de ISR del driver limpia el estado; aquí solo se cuentan desbordes
+static void IRAM_ATTR pcnt_overflow_isr(void*) {
+  pcnt_overflows++;
+}
+
+double si5351_cal_measure(uint32_t gate_ms) {
+  pcnt_config_t cfg = {};
+  cfg.pulse_gpio_num = SI5351_CAL_PIN;
+  cfg.ctrl_gpio_num = PCNT_PIN_NOT_USED;
+  cfg.channel = PCNT_CHANNEL_0;
+  cfg.unit = CAL_PCNT_UNIT;
+  cfg.pos_mode = PCNT_COUNT_INC;
+  cfg.neg_mode = PCNT_COUNT_DIS;
+  cfg.lctrl_mode = PCNT_MODE_KEEP;
+  cfg.hctrl_mode = PCNT_MODE_KEEP;
+  cfg.counter_h_lim = CAL_PCNT_LIMIT;
+  cfg.counter_l_lim = 0;
+  pcnt_unit_config(&cfg);
+  pcnt_filter_disable(CAL_PCNT_UNIT);   // El filtro limitaría a unos pocos MHz
+
+  pcnt_event_enable(CAL_PCNT_UNIT, PCNT_EVT_H_LIM);
+  if (!pcnt_isr_ready) {
+    pcnt_isr_service_install(0);
+    pcnt_isr_handler_add(CAL_PCNT_UNIT, pcnt_overflow_isr, NULL);
+    pcnt_isr_ready = true;
+  }
+  pcnt_intr_enable(CAL_PCNT_UNIT);
+
+  pcnt_counter_pause(CAL_PCNT_UNIT);
+  pcnt_counter_clear(CAL_PCNT_UNIT);
+  pcnt_overflows = 0;
+
+  int64_t t0 = esp_timer_get_time();
+  pcnt_counter_resume(CAL_PCNT_UNIT);
+  delay(gate_ms);
+  pcnt_counter_pause(CAL_PCNT_UNIT);
+  int64_t t1 = esp_timer_get_time();
+
+  int16_t count = 0;
+  pcnt_get_counter_value(CAL_PCNT_UNIT, &count);
+  pcnt_intr_disable(CAL_PCNT_UNIT);
+
+  uint64_t pulses = (uint64_t)pcnt_overflows * CAL_PCNT_LIMIT + count;
+  Serial.printf("[CAL] %llu pulsos en %lld us\n", (unsigned long long)pulses, (long long)(t1 - t0));
+  if (t1 <= t0) return 0.0;
+  return (double)pulses * 1e6 / (double)(t1 - t0);
+}
+
+// ==========================================================
+// CÁLCULO DE LA CORRECCIÓN
+// ==========================================================
+
+bool si5351_cal_compute(int32_t current_ppb, double expected_hz, double measured_hz, int32_t* new_ppb) {
+  if (expected_hz <= 0.0 || measured_hz <= 0.0) return false;
+  // La salida escala con el cristal real: real = supuesto * medido / esperado
+  double ppb = ((1.0 + current_ppb * 1e-9) * (measured_hz / expected_hz) - 1.0) * 1e9;
+  if (ppb > SI5351_CAL_MAX_PPB || ppb < -SI5351_CAL_MAX_PPB) return false;
+  *new_ppb = (int32_t)lround(ppb);
+  return true;
+}
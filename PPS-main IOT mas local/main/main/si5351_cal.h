@@ -0,0 +1,41 @@
+#ifndef SI5351_CAL_H
+#define SI5351_CAL_H
+
+#include <Arduino.h>
+
+// ==========================================================
+// CALIBRACIÓN DEL CRISTAL DEL Si5351
+// ==========================================================
+// La corrección se expresa en partes por billón (ppb) con el mismo signo
+// que usa la librería: positivo = el cristal oscila por encima de 25 MHz.
+// Se guarda en NVS y se aplica en si5351.init() y en si5351_tuner_begin().
+//
+// Dos formas de medir:
+//   - Contador de pulsos (PCNT): CLK2 cableado a SI5351_CAL_PIN, contado
+//     durante una ventana del timer del ESP32 (exactitud del cristal del ESP32).
+//   - Lectura del usuario: frecuencia medida con un instrumento de referencia.
+
+/**
+ * @brief Lee la corrección guardada. Si no hay, devuelve SI5351_CORRECTION.
+ */
+int32_t si5351_cal_load();
+
+/**
+ * @brief Guarda la corrección en NVS.
+ */
+bool si5351_cal_save(int32_t correction_ppb);
+
+/**
+ * @brief Cuenta flancos de subida en SI5351_CAL_PIN durante 'gate_ms'.
+ * @return Frecuencia medida en Hz (0 si no hubo señal).
+ */
+double si5351_cal_measure(uint32_t gate_ms);
+
+/**
+ * @brief Calcula la nueva corrección a partir de una salida que debería
+ * valer 'expected_hz' y se midió en 'measured_hz' con la corrección actual.
+ * @return false si el error resultante es absurdo (> SI5351_CAL_MAX_PPB).
+ */
+bool si5351_cal_compute(int32_t current_ppb, double expected_hz, double measured_hz, int32_t* new_ppb);
+
+#endif // SI5351_CAL_H
@@ -0,0 +1,143 @@
+#ifndef SI5351_PLAN_H
+#define SI5351_PLAN_H
+
+#include <stdint.h>
+
+// ==========================================================
+// PLANIFICACIÓN DE REGISTROS DEL Si5351
+// ==========================================================
+// Traduce una frecuencia de salida a las imágenes de 8 registros del PLL y
+// del Multisynth (AN619). No depende de Arduino ni del bus: igual que
+// adf4351_plan.h, se puede compilar en el PC para verificar o medir la
+// planificación. Qué bytes se escriben y cuándo se resetea el PLL lo
+// decide si5351_tuner.cpp comparando la forma (Si5351PlanShape) del plan.
+//
+// El cristal se expresa en mHz para que la corrección en ppb no se pierda
+// en el redondeo.
+
+#define SI5351_PLAN_FRAC_DENOM       1048575ULL
+#define SI5351_PLAN_FIXED_MULT       32            // 25 MHz * 32 = 800 MHz
+#define SI5351_PLAN_FIXED_PLL_MAX_HZ 100000000ULL  // Por encima el MS no puede dividir >= 8
+#define SI5351_PLAN_DIV6_MAX_HZ      150000000ULL  // Por encima se usa el modo DIVBY4
+#define SI5351_PLAN_MS_MAX_DIV       2047ULL
+#define SI5351_PLAN_VCO_MIN_HZ       600000000ULL
+#define SI5351_PLAN_VCO_MAX_HZ       900000000ULL
+#define SI5351_PLAN_IQ_MAX_DIV       126           // El registro de fase tiene 7 bits
+
+enum Si5351PlanMode : uint8_t {
+  SI5351_PLAN_NONE,
+  SI5351_PLAN_FIXED_PLL,   // PLL fijo en 800 MHz, MS fraccional
+  SI5351_PLAN_INT_MS,      // MS entero (6 o DIVBY4), PLL fraccional
+  SI5351_PLAN_IQ           // MS entero par compartido por CLK0/CLK1, PLL fraccional
+};
+
+/**
+ * @brief Estructura del plan: si cambia entre dos retunes hay que resetear el PLL.
+ */
+struct Si5351PlanShape {
+  uint8_t mode;      // Si5351PlanMode
+  uint8_t int_div;   // Divisor entero del MS en SI5351_PLAN_INT_MS / SI5351_PLAN_IQ
+  uint8_t r_div;     // Exponente del divisor R (0..7)
+};
+
+/**
+ * @brief num/den = a + b/SI5351_PLAN_FRAC_DENOM, redondeando b al entero más cercano.
+ */
+inline void si5351_ratio(uint64_t num, uint64_t den, uint32_t& a, uint32_t& b) {
+  a = num / den;
+  uint64_t rem = num % den;
+  b = (rem * SI5351_PLAN_FRAC_DENOM + den / 2) / den;
+  if (b >= SI5351_PLAN_FRAC_DENOM) { a++; b = 0; }
+}
+
+/**
+ * @brief Bloque de 8 registros común a PLL y Multisynth (P1, P2, P3, R_DIV, DIVBY4).
+ */
+inline void si5351_encode_params(uint8_t* out, uint32_t a, uint32_t b, uint8_t r_div, bool divby4) {
+  uint32_t p1, p2, p3;
+  if (divby4) {
+    p1 = 0; p2 = 0; p3 = 1;
+  } else {
+    uint32_t t = (uint32_t)((128ULL * b) / SI5351_PLAN_FRAC_DENOM);
+    p1 = 128 * a + t - 512;
+    p2 = 128 * b - SI5351_PLAN_FRAC_DENOM * t;
+    p3 = SI5351_PLAN_FRAC_DENOM;
+  }
+  out[0] = (p3 >> 8) & 0xFF;
+  out[1] = p3 & 0xFF;
+  out[2] = ((r_div & 0x07) << 4) | (divby4 ? 0x0C : 0x00) | ((p1 >> 16) & 0x03);
+  out[3] = (p1 >> 8) & 0xFF;
+  out[4] = p1 & 0xFF;
+  out[5] = (((p3 >> 16) & 0x0F) << 4) | ((p2 >> 16) & 0x0F);
+  out[6] = (p2 >> 8) & 0xFF;
+  out[7] = p2 & 0xFF;
+}
+
+/**
+ * @brief Imágenes de PLL y MS para una salida simple.
+ * @param xtal_mhz Cristal corregido, en mHz.
+ * @return true si el MS quedó entero y par (el chip admite MS_INT).
+ */
+inline bool si5351_plan_clock(uint64_t freq_hz, uint64_t xtal_mhz, Si5351PlanShape& shape,
+                              uint8_t* pll_img, uint8_t* ms_img) {
+  uint64_t f_mhz = freq_hz * 1000ULL;
+  uint32_t a, b;
+
+  if (freq_hz > SI5351_PLAN_FIXED_PLL_MAX_HZ) {
+    // MS entero fijo, el PLL fraccional sigue a la frecuencia
+    shape.mode = SI5351_PLAN_INT_MS;
+    shape.int_div = (freq_hz > SI5351_PLAN_DIV6_MAX_HZ) ? 4 : 6;
+    shape.r_div = 0;
+    si5351_ratio(f_mhz * shape.int_div, xtal_mhz, a, b);
+    si5351_encode_params(pll_img, a, b, 0, false);
+    if (shape.int_div == 4) si5351_encode_params(ms_img, 0, 0, 0, true);
+    else si5351_encode_params(ms_img, 6, 0, 0, false);
+    return true;
+  }
+
+  // PLL fijo a 800 MHz, el MS fraccional sigue a la frecuencia
+  uint64_t vco_mhz = xtal_mhz * SI5351_PLAN_FIXED_MULT;
+  shape.mode = SI5351_PLAN_FIXED_PLL;
+  shape.int_div = 0;
+  shape.r_div = 0;
+  while (shape.r_div < 7 && (f_mhz << shape.r_div) * SI5351_PLAN_MS_MAX_DIV < vco_mhz) shape.r_div++;
+
+  si5351_encode_params(pll_img, SI5351_PLAN_FIXED_MULT, 0, 0, false);
+  si5351_ratio(vco_mhz, f_mhz << shape.r_div, a, b);
+  si5351_encode_params(ms_img, a, b, shape.r_div, false);
+  return (b == 0) && ((a & 1) == 0);
+}
+
+inline bool si5351_iq_divider_fits(uint64_t freq_hz, uint8_t d) {
+  return d >= 6 && d <= SI5351_PLAN_IQ_MAX_DIV &&
+         freq_hz * d >= SI5351_PLAN_VCO_MIN_HZ && freq_hz * d <= SI5351_PLAN_VCO_MAX_HZ;
+}
+
+/**
+ * @brief Plan de cuadratura: MS entero par compartido por CLK0/CLK1, PLL fraccional.
+ * Se reutiliza el divisor de 'current' si sigue siendo válido, para no resetear el PLL.
+ * @return false si ningún divisor par deja el VCO en rango.
+ */
+inline bool si5351_plan_iq(uint64_t freq_hz, uint64_t xtal_mhz, const Si5351PlanShape& current,
+                           Si5351PlanShape& shape, uint8_t* pll_img, uint8_t* ms_img) {
+  uint8_t d = 0;
+  if (current.mode == SI5351_PLAN_IQ && si5351_iq_divider_fits(freq_hz, current.int_div)) {
+    d = current.int_div;
+  } else {
+    uint64_t max_d = SI5351_PLAN_VCO_MAX_HZ / freq_hz;
+    if (max_d > SI5351_PLAN_IQ_MAX_DIV) max_d = SI5351_PLAN_IQ_MAX_DIV;
+    d = max_d & ~1ULL;
+    if (!si5351_iq_divider_fits(freq_hz, d)) return false;
+  }
+
+  uint32_t a, b;
+  shape.mode = SI5351_PLAN_IQ;
+  shape.int_div = d;
+  shape.r_div = 0;
+  si5351_ratio(freq_hz * 1000ULL * d, xtal_mhz, a, b);
+  si5351_encode_params(pll_img, a, b, 0, false);
+  si5351_encode_params(ms_img, d, 0, 0, false);
+  return true;
+}
+
+#endif // SI5351_PLAN_H
@@ -0,0 +1,293 @@
+#include "si5351_tuner.h"
+#include "si5351_plan.h"
+#include "i2c_bus.h"
+#include "config.h"
+#include "latency_metrics.h"
+
+// ==========================================================
+// MAPA DE REGISTROS (AN619)
+// ==========================================================
+#define REG_OUTPUT_EN     3
+#define REG_CLK0_CTRL     16
+#define REG_CLK1_CTRL     17
+#define REG_CLK2_CTRL     18
+#define REG_PLLA_BASE     26
+#define REG_PLLB_BASE     34
+#define REG_MS0_BASE      42
+#define REG_MS1_BASE      50
+#define REG_MS2_BASE      58
+#define REG_CLK0_PHASE    165
+#define REG_PLL_RESET     177
+#define PLL_RESET_A       0x20
+#define PLL_RESET_B       0x80
+
+#define SHADOW_FIRST      16
+#define SHADOW_LAST       65
+#define SHADOW_SIZE       (SHADOW_LAST - SHADOW_FIRST + 1)
+
+// Bits del registro de control de salida (CLKx_CTRL)
+#define CTRL_PDN          0x80
+#define CTRL_MS_INT       0x40
+#define CTRL_MS_SRC_PLLB  0x20
+#define CTRL_SRC_MS       0x0C
+#define CTRL_KEEP_MASK    0x13  // Conservamos CLK_INV y la corriente de salida
+#define CTRL_DRIVE_MASK   0x03
+
+// Dos bytes sin cambios entre escrituras cuestan lo mismo que abrir otra
+// transacción (dirección + registro), así que se fusionan en una ráfaga.
+#define MERGE_GAP         2
+
+// ==========================================================
+// ESTADO INTERNO
+// ==========================================================
+static uint8_t shadow[SHADOW_SIZE];
+static uint8_t pending[SHADOW_SIZE];
+static uint8_t oeb_shadow = 0xFF;          // Registro 3 (1 = salida deshabilitada)
+static uint8_t phase_shadow[2] = {0, 0};   // Registros 165 y 166
+static uint64_t xtal_mhz = SI5351_CRYSTAL_FREQ * 1000ULL; // Cristal corregido, en mHz
+static Si5351PlanShape shape_a = {SI5351_PLAN_NONE, 0, 0};
+static Si5351PlanShape shape_b = {SI5351_PLAN_NONE, 0, 0};
+static Si5351OutputMode out_mode = SI5351_MODE_SINGLE;
+static uint64_t lo_hz = 0;
+static uint64_t clk2_hz = 0;
+static Si5351TunerStats last_stats;
+
+static inline uint8_t& reg(uint8_t* img, uint8_t r) { return img[r - SHADOW_FIRST]; }
+
+static_assert(SHADOW_SIZE == SI5351_TUNER_IMAGE_REGS, "La imagen debe cubrir toda la shadow");
+static_assert(SI5351_TUNER_MAX_HZ * 4 <= SI5351_PLAN_VCO_MAX_HZ, "DIVBY4 dejaría el VCO fuera de rango");
+static_assert(sizeof(Si5351PlanShape) * 2 == sizeof(((Si5351TunerImage*)0)->plan), "Forma del plan");
+
+// ==========================================================
+// CÁLCULO DEL PLAN (ver si5351_plan.h)
+// ==========================================================
+
+static bool planIq(uint64_t freq_hz, Si5351PlanShape& shape, uint8_t* pll_img, uint8_t* ms_img) {
+  if (freq_hz < SI5351_TUNER_IQ_MIN_HZ || freq_hz > SI5351_TUNER_IQ_MAX_HZ) return false;
+  return si5351_plan_iq(freq_hz, xtal_mhz, shape_a, shape, pll_img, ms_img);
+}
+
+// ==========================================================
+// ESCRITURA AL BUS
+// ==========================================================
+
+static bool writeBurst(uint8_t first_reg, const uint8_t* data, uint8_t len) {
+  uint8_t buf[SHADOW_SIZE + 1];
+  buf[0] = first_reg;
+  memcpy(&buf[1], data, len);
+  bool ok = (i2c_bus_write(SI5351_ADDR, buf, len + 1, I2C_CLIENT_SYNTH) == 0);
+  last_stats.bytes += len + 2;
+  last_stats.transactions++;
+  return ok;
+}
+
+// Escribe solo los bytes de 'pending' que difieren de la shadow
+static bool commitPending() {
+  bool ok = true;
+  int i = 0;
+  while (i < SHADOW_SIZE) {
+    if (pending[i] == shadow[i]) { i++; continue; }
+    int start = i, end = i;
+    for (int j = i + 1; j < SHADOW_SIZE && j - end <= MERGE_GAP + 1; j++) {
+      if (pending[j] != shadow[j]) end = j;
+    }
+    uint8_t len = end - start + 1;
+    if (writeBurst(SHADOW_FIRST + start, &pending[start], len)) {
+      memcpy(&shadow[start], &pending[start], len);
+    } else {
+      ok = false;  // La shadow conserva el valor viejo: se reintenta en el próximo commit
+    }
+    i = end + 1;
+  }
+  return ok;
+}
+
+static bool writeReg(uint8_t r, uint8_t value, uint8_t& cache) {
+  if (cache == value) return true;
+  bool ok = writeBurst(r, &value, 1);
+  if (ok) cache = value;
+  return ok;
+}
+
+static inline bool sameShape(const Si5351PlanShape& x, const Si5351PlanShape& y) {
+  return x.mode == y.mode && x.int_div == y.int_div && x.r_div == y.r_div;
+}
+
+// Planifica las tres salidas y escribe todo lo que cambió.
+// Si alguna salida no es alcanzable no se toca el chip.
+static bool retune() {
+  memset(&last_stats, 0, sizeof(last_stats));
+  uint32_t t0 = micros();
+  uint32_t plan_start = metrics_cycles();
+
+  Si5351PlanShape new_a = {SI5351_PLAN_NONE, 0, 0}, new_b = {SI5351_PLAN_NONE, 0, 0};
+  uint8_t pll[8], ms[8];
+  uint8_t drive = reg(shadow, REG_CLK0_CTRL) & CTRL_KEEP_MASK;
+  uint8_t phase1 = phase_shadow[1];
+  uint8_t oeb = 0xFF;
+
+  memcpy(pending, shadow, SHADOW_SIZE);
+  reg(pending, REG_CLK0_CTRL) = drive | CTRL_PDN;
+  reg(pending, REG_CLK1_CTRL) = drive | CTRL_PDN;
+  reg(pending, REG_CLK2_CTRL) = (drive & CTRL_DRIVE_MASK) | CTRL_PDN;
+
+  // --- Grupo PLLA: CLK0 (+ CLK1 en IQ) ---
+  if (lo_hz > 0) {
+    if (out_mode == SI5351_MODE_IQ) {
+      if (!planIq(lo_hz, new_a, pll, ms)) return false;
+      memcpy(&reg(pending, REG_MS1_BASE), ms, 8);
+      reg(pending, REG_CLK0_CTRL) = drive | CTRL_SRC_MS | CTRL_MS_INT;
+      reg(pending, REG_CLK1_CTRL) = drive | CTRL_SRC_MS | CTRL_MS_INT;
+      phase1 = new_a.int_div;
+      oeb &= ~0x03;
+    } else {
+      bool ms_int = si5351_plan_clock(lo_hz, xtal_mhz, new_a, pll, ms);
+      reg(pending, REG_CLK0_CTRL) = drive | CTRL_SRC_MS | (ms_int ? CTRL_MS_INT : 0);
+      oeb &= ~0x01;
+    }
+    memcpy(&reg(pending, REG_PLLA_BASE), pll, 8);
+    memcpy(&reg(pending, REG_MS0_BASE), ms, 8);
+  }
+
+  // --- Grupo PLLB: CLK2 ---
+  if (clk2_hz > 0) {
+    bool ms_int = si5351_plan_clock(clk2_hz, xtal_mhz, new_b, pll, ms);
+    memcpy(&reg(pending, REG_PLLB_BASE), pll, 8);
+    memcpy(&reg(pending, REG_MS2_BASE), ms, 8);
+    reg(pending, REG_CLK2_CTRL) = (drive & CTRL_DRIVE_MASK) | CTRL_SRC_MS | CTRL_MS_SRC_PLLB |
+                                  (ms_int ? CTRL_MS_INT : 0);
+    oeb &= ~0x04;
+  }
+
+  uint32_t bus_start = metrics_cycles();
+  metrics_record(METRIC_PLAN, bus_start - plan_start);
+  bool ok = commitPending();
+  bool phase_changed = (out_mode == SI5351_MODE_IQ) &&
+                       (phase_shadow[0] != 0 || phase_shadow[1] != phase1);
+  ok &= writeReg(REG_CLK0_PHASE, 0, phase_shadow[0]);
+  ok &= writeReg(REG_CLK0_PHASE + 1, phase1, phase_shadow[1]);
+
+  // Reset de PLL solo si cambió la estructura del plan (o la fase en IQ)
+  uint8_t rst = 0;
+  if (new_a.mode != SI5351_PLAN_NONE && (!sameShape(new_a, shape_a) || phase_changed)) rst |= PLL_RESET_A;
+  if (new_b.mode != SI5351_PLAN_NONE && !sameShape(new_b, shape_b)) rst |= PLL_RESET_B;
+  if (rst) {
+    ok &= writeBurst(REG_PLL_RESET, &rst, 1);
+    last_stats.pll_reset = true;
+  }
+  if (ok) {
+    shape_a = new_a;
+    shape_b = new_b;
+  } else {
+    // No se sabe qué parte del plan llegó al chip: el próximo retune resetea los PLL
+    shape_a.mode = SI5351_PLAN_NONE;
+    shape_b.mode = SI5351_PLAN_NONE;
+  }
+
+  ok &= writeReg(REG_OUTPUT_EN, oeb, oeb_shadow);
+  metrics_record(METRIC_BUS, metrics_cycles() - bus_start);
+
+  last_stats.us = micros() - t0;
+  return ok;
+}
+
+// ==========================================================
+// FUNCIONES PÚBLICAS
+// ==========================================================
+
+static void applyCorrection(int32_t correction_ppb) {
+  xtal_mhz = SI5351_CRYSTAL_FREQ * 1000ULL + ((int64_t)SI5351_CRYSTAL_FREQ * correction_ppb) / 1000000LL;
+}
+
+bool si5351_tuner_begin(int32_t correction_ppb) {
+  applyCorrection(correction_ppb);
+  shape_a.mode = SI5351_PLAN_NONE;
+  shape_b.mode = SI5351_PLAN_NONE;
+
+  // Por el bus compartido: cuenta en las estadísticas y respeta la recuperación.
+  // Tras un reinicio en caliente el chip sigue andando: lo leído es su plan vigente.
+  const uint8_t first = SHADOW_FIRST, oeb = REG_OUTPUT_EN, phase = REG_CLK0_PHASE;
+  return i2c_bus_read(SI5351_ADDR, &first, 1, shadow, SHADOW_SIZE, I2C_CLIENT_SYNTH) == 0 &&
+         i2c_bus_read(SI5351_ADDR, &oeb, 1, &oeb_shadow, 1, I2C_CLIENT_SYNTH) == 0 &&
+         i2c_bus_read(SI5351_ADDR, &phase, 1, phase_shadow, 2, I2C_CLIENT_SYNTH) == 0;
+}
+
+bool si5351_tuner_set_freq(uint64_t freq_hz) {
+  if (freq_hz < SI5351_TUNER_MIN_HZ || freq_hz > SI5351_TUNER_MAX_HZ) return false;
+  uint64_t prev = lo_hz;
+  lo_hz = freq_hz;
+  if (!retune()) { lo_hz = prev; return false; }
+  return true;
+}
+
+bool si5351_tuner_set_mode(Si5351OutputMode mode) {
+  Si5351OutputMode prev = out_mode;
+  out_mode = mode;
+  if (!retune()) { out_mode = prev; return false; }
+  return true;
+}
+
+bool si5351_tuner_set_clk2(uint64_t freq_hz) {
+  if (freq_hz != 0 && (freq_hz < SI5351_TUNER_MIN_HZ || freq_hz > SI5351_TUNER_MAX_HZ)) return false;
+  uint64_t prev = clk2_hz;
+  clk2_hz = freq_hz;
+  if (!retune()) { clk2_hz = prev; return false; }
+  return true;
+}
+
+bool si5351_tuner_set_correction(int32_t correction_ppb) {
+  applyCorrection(correction_ppb);
+  return retune();
+}
+
+void si5351_tuner_export(Si5351TunerImage* img) {
+  memcpy(img->regs, shadow, SHADOW_SIZE);
+  img->oeb = oeb_shadow;
+  img->phase1 = phase_shadow[1];
+  img->mode = out_mode;
+  memcpy(&img->plan[0], &shape_a, sizeof(Si5351PlanShape));
+  memcpy(&img->plan[3], &shape_b, sizeof(Si5351PlanShape));
+  img->xtal_mhz = xtal_mhz;
+  img->lo_hz = lo_hz;
+  img->clk2_hz = clk2_hz;
+}
+
+bool si5351_tuner_import(const Si5351TunerImage& img) {
+  if (img.xtal_mhz != xtal_mhz) return false;
+  memset(&last_stats, 0, sizeof(last_stats));
+  uint32_t t0 = micros();
+
+  memcpy(pending, img.regs, SHADOW_SIZE);
+  bool ok = commitPending();
+  ok &= writeReg(REG_CLK0_PHASE, 0, phase_shadow[0]);
+  ok &= writeReg(REG_CLK0_PHASE + 1, img.phase1, phase_shadow[1]);
+  memcpy(&shape_a, &img.plan[0], sizeof(Si5351PlanShape));
+  memcpy(&shape_b, &img.plan[3], sizeof(Si5351PlanShape));
+
+  // Si el chip ya tenía la imagen (reinicio en caliente) no se escribió
+  // nada y los PLL siguen enganchados: resetearlos sería un glitch
+  uint8_t rst = 0;
+  if (last_stats.transactions > 0) {
+    if (shape_a.mode != SI5351_PLAN_NONE) rst |= PLL_RESET_A;
+    if (shape_b.mode != SI5351_PLAN_NONE) rst |= PLL_RESET_B;
+  }
+  if (rst) {
+    ok &= writeBurst(REG_PLL_RESET, &rst, 1);
+    last_stats.pll_reset = true;
+  }
+  if (!ok) {
+    shape_a.mode = SI5351_PLAN_NONE;
+    shape_b.mode = SI5351_PLAN_NONE;
+  }
+  ok &= writeReg(REG_OUTPUT_EN, img.oeb, oeb_shadow);
+
+  out_mode = (Si5351OutputMode)img.mode;
+  lo_hz = img.lo_hz;
+  clk2_hz = img.clk2_hz;
+  last_stats.us = micros() - t0;
+  return ok;
+}
+
+const Si5351TunerStats& si5351_tuner_last_stats() {
+  return last_stats;
+}
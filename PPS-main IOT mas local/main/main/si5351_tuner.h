@@ -0,0 +1,108 @@
+#ifndef SI5351_TUNER_H
+#define SI5351_TUNER_H
+
+#include <Arduino.h>
+
+// ==========================================================
+// CAPA DE SINTONÍA INCREMENTAL DEL Si5351 (NIVEL REGISTRO)
+// ==========================================================
+// Mantiene una copia (shadow) de los registros 16..65 del chip y el plan
+// PLL/Multisynth vigente. Cada retune calcula la nueva imagen de registros
+// y escribe por I2C solo los bytes que cambiaron, agrupados en ráfagas.
+// El PLL solo se resetea cuando cambia la estructura del plan (modo,
+// divisor entero o R_DIV), nunca en pasos pequeños.
+//
+// Salidas:
+//   CLK0 (+CLK1 en modo IQ) -> PLLA, planificadas juntas.
+//   CLK2 (BFO / referencia) -> PLLB, independiente.
+// En modo IQ, CLK1 lleva un desfase de 90° usando el registro de fase del
+// multisynth (fase = divisor entero par). Mientras el divisor no cambie,
+// los pasos solo mueven el PLL fraccional y la cuadratura se conserva.
+
+#define SI5351_TUNER_MIN_HZ      4000ULL
+#define SI5351_TUNER_MAX_HZ      225000000ULL  // 900 MHz / 4 (modo DIVBY4)
+#define SI5351_TUNER_IQ_MIN_HZ   4800000ULL    // 600 MHz / 126 (máx. del registro de fase)
+#define SI5351_TUNER_IQ_MAX_HZ   150000000ULL  // 900 MHz / 6
+
+enum Si5351OutputMode : uint8_t {
+  SI5351_MODE_SINGLE,   // Solo CLK0
+  SI5351_MODE_IQ        // CLK0 = I, CLK1 = Q (+90°)
+};
+
+/**
+ * @brief Estadísticas de la última operación de escritura al chip.
+ */
+struct Si5351TunerStats {
+  uint16_t bytes;          // Bytes en el bus (dirección + registro + datos)
+  uint16_t transactions;   // Transacciones I2C (START..STOP)
+  uint32_t us;             // Tiempo total de la operación
+  bool pll_reset;          // Si hubo reset de PLL
+};
+
+#define SI5351_TUNER_IMAGE_REGS  50   // Registros 16..65
+
+/**
+ * @brief Plan completo ya calculado (registros + forma de los PLL), para
+ * reprogramar el chip sin re-planificar tras un reinicio en caliente.
+ */
+struct Si5351TunerImage {
+  uint8_t regs[SI5351_TUNER_IMAGE_REGS];
+  uint8_t oeb;          // Registro 3
+  uint8_t phase1;       // Registro 166 (fase de CLK1 en IQ)
+  uint8_t mode;         // Si5351OutputMode
+  uint8_t plan[6];      // Forma de los planes PLLA y PLLB
+  uint64_t xtal_mhz;    // Cristal corregido con el que se calculó
+  uint64_t lo_hz;
+  uint64_t clk2_hz;
+};
+
+/**
+ * @brief Lee el estado actual del chip en la shadow. Llamar tras si5351.init(),
+ * o sin él tras un reinicio en caliente (el chip conserva su plan).
+ * @param correction_ppb Corrección del cristal en partes por billón.
+ * @return true si el chip respondió.
+ */
+bool si5351_tuner_begin(int32_t correction_ppb);
+
+/**
+ * @brief Sintoniza el LO (CLK0, y CLK1 en modo IQ) a la frecuencia indicada en Hz.
+ * @return true si la frecuencia es alcanzable en el modo actual y se escribió sin error.
+ *         Si no es alcanzable, el chip y el estado interno no cambian.
+ */
+bool si5351_tuner_set_freq(uint64_t freq_hz);
+
+/**
+ * @brief Cambia entre salida simple y cuadratura I/Q, re-planificando PLLA.
+ * @return false si la frecuencia actual del LO no admite el modo pedido.
+ */
+bool si5351_tuner_set_mode(Si5351OutputMode mode);
+
+/**
+ * @brief Programa CLK2 (PLLB) de forma independiente. 0 apaga la salida.
+ */
+bool si5351_tuner_set_clk2(uint64_t freq_hz);
+
+/**
+ * @brief Cambia la corrección del cristal y re-escribe las salidas activas.
+ */
+bool si5351_tuner_set_correction(int32_t correction_ppb);
+
+/**
+ * @brief Copia el plan vigente.
+ */
+void si5351_tuner_export(Si5351TunerImage* img);
+
+/**
+ * @brief Escribe un plan exportado (solo los bytes que difieren de la shadow)
+ * y, si hubo que escribir algo, resetea los PLL en uso. Llamar tras
+ * si5351_tuner_begin(): si el chip ya tenía ese plan no se toca.
+ * @return false si la imagen se calculó con otra corrección del cristal.
+ */
+bool si5351_tuner_import(const Si5351TunerImage& img);
+
+/**
+ * @brief Estadísticas de la última operación (set_freq, set_mode, set_clk2 o set_correction).
+ */
+const Si5351TunerStats& si5351_tuner_last_stats();
+
+#endif // SI5351_TUNER_H
@@ -0,0 +1,78 @@
+#!/usr/bin/env python3
+"""Mide pedidos por segundo del servidor HTTP del instrumento.
+
+Abre N clientes simultáneos (una conexión keep-alive por cliente) y cada
+uno repite el pedido M veces. Informa pedidos/s y latencias p50/p95/máx.
+
+Ejemplos:
+    python3 tools/bench_http.py 192.168.1.50 --clientes 4 --pedidos 50
+    python3 tools/bench_http.py 192.168.1.50 --ruta /api/estadisticas_i2c
+    python3 tools/bench_http.py 192.168.1.50 --ruta /api/vfo_command \\
+        --cuerpo '{"sub_accion":"get_status"}'
+"""
+import argparse
+import http.client
+import threading
+import time
+
+
+def worker(host, port, path, body, count, latencies, errors, lock):
+    conn = http.client.HTTPConnection(host, port, timeout=10)
+    method = "POST" if body is not None else "GET"
+    headers = {"Content-Type": "application/json"} if body is not None else {}
+    local = []
+    failed = 0
+    for _ in range(count):
+        t0 = time.perf_counter()
+        try:
+            conn.request(method, path, body=body, headers=headers)
+            resp = conn.getresponse()
+            resp.read()
+            if resp.status >= 400:
+                failed += 1
+        except (OSError, http.client.HTTPException):
+            failed += 1
+            conn.close()
+            conn = http.client.HTTPConnection(host, port, timeout=10)
+            continue
+        local.append(time.perf_counter() - t0)
+    conn.close()
+    with lock:
+        latencies.extend(local)
+        errors[0] += failed
+
+
+def main():
+    ap = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    ap.add_argument("host")
+    ap.add_argument("--puerto", type=int, default=80)
+    ap.add_argument("--ruta", default="/")
+    ap.add_argument("--cuerpo", default=None, help="JSON a enviar por POST")
+    ap.add_argument("--clientes", type=int, default=4)
+    ap.add_argument("--pedidos", type=int, default=50, help="pedidos por cliente")
+    args = ap.parse_args()
+
+    latencies, errors, lock = [], [0], threading.Lock()
+    threads = [threading.Thread(target=worker, args=(args.host, args.puerto, args.ruta, args.cuerpo,
+                                                     args.pedidos, latencies, errors, lock))
+               for _ in range(args.clientes)]
+    t0 = time.perf_counter()
+    for t in threads:
+        t.start()
+    for t in threads:
+        t.join()
+    elapsed = time.perf_counter() - t0
+
+    latencies.sort()
+    ok = len(latencies)
+    print(f"{args.clientes} clientes x {args.pedidos} pedidos a {args.ruta}")
+    print(f"  completados {ok}, errores {errors[0]}, {elapsed:.2f} s")
+    if ok:
+        print(f"  {ok / elapsed:.1f} pedidos/s")
+        print(f"  latencia p50 {latencies[ok // 2] * 1000:.1f} ms, "
+              f"p95 {latencies[int(ok * 0.95) - 1] * 1000:.1f} ms, "
+              f"max {latencies[-1] * 1000:.1f} ms")
+
+
+if __name__ == "__main__":
+    main()
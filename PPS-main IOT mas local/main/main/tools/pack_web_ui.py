@@ -0,0 +1,92 @@
+#!/usr/bin/env python3
+"""Empaqueta la interfaz web ("Nueva pagina") en web_ui_assets.h.
+
+Cada archivo se comprime con gzip y se guarda como un arreglo PROGMEM junto
+con su tipo MIME y un ETag (hash del contenido comprimido). El firmware lo
+sirve tal cual con Content-Encoding: gzip (ver web_ui.cpp).
+
+Uso (desde la carpeta del sketch):
+    python3 tools/pack_web_ui.py
+
+Volver a ejecutarlo cada vez que cambie la página. Imprime los bytes de la
+primera carga (comprimida vs. sin comprimir) para comparar.
+"""
+import gzip
+import hashlib
+import os
+import sys
+
+SKETCH_DIR = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+SOURCE_DIR = os.path.join(SKETCH_DIR, "Nueva pagina")
+OUTPUT = os.path.join(SKETCH_DIR, "web_ui_assets.h")
+
+# (archivo, ruta HTTP, tipo MIME)
+ASSETS = [
+    ("index.html", "/", "text/html; charset=utf-8"),
+    ("script.js", "/script.js", "application/javascript; charset=utf-8"),
+    ("style.css", "/style.css", "text/css; charset=utf-8"),
+]
+
+
+def symbol(name):
+    return "ui_" + name.replace(".", "_").replace("-", "_")
+
+
+def main():
+    out = [
+        "// ARCHIVO GENERADO por tools/pack_web_ui.py - no editar a mano.",
+        "#ifndef WEB_UI_ASSETS_H",
+        "#define WEB_UI_ASSETS_H",
+        "",
+        "#include <Arduino.h>",
+        "",
+    ]
+    entries = []
+    total_raw = total_gz = 0
+    for name, path, mime in ASSETS:
+        raw = open(os.path.join(SOURCE_DIR, name), "rb").read()
+        # mtime=0: la misma página produce siempre los mismos bytes y ETag
+        gz = gzip.compress(raw, compresslevel=9, mtime=0)
+        etag = '"' + hashlib.sha1(gz).hexdigest()[:16] + '"'
+        total_raw += len(raw)
+        total_gz += len(gz)
+        print(f"{name:12s} {len(raw):7d} B -> {len(gz):6d} B gzip  ETag {etag}")
+
+        sym = symbol(name)
+        out.append(f"// {name}: {len(raw)} bytes sin comprimir")
+        out.append(f"static const uint8_t {sym}[] PROGMEM = {{")
+        for i in range(0, len(gz), 16):
+            out.append("  " + ", ".join(f"0x{b:02x}" for b in gz[i:i + 16]) + ",")
+        out.append("};")
+        out.append("")
+        etag_c = etag.replace('"', '\\"')
+        entries.append(f'  {{"{path}", "{mime}", "{etag_c}", {sym}, sizeof({sym}), {len(raw)}}},')
+
+    out += [
+        "struct WebUiAsset {",
+        "  const char* path;",
+        "  const char* mime;",
+        "  const char* etag;",
+        "  const uint8_t* gz;",
+        "  size_t gz_len;",
+        "  size_t raw_len;",
+        "};",
+        "",
+        "static const WebUiAsset WEB_UI_ASSETS[] = {",
+        *entries,
+        "};",
+        "",
+        "#define WEB_UI_ASSET_COUNT (sizeof(WEB_UI_ASSETS) / sizeof(WEB_UI_ASSETS[0]))",
+        "",
+        "#endif // WEB_UI_ASSETS_H",
+        "",
+    ]
+    with open(OUTPUT, "w", newline="\n") as f:
+        f.write("\n".join(out))
+    print(f"Primera carga: {total_gz} B gzip (sin comprimir {total_raw} B)")
+    print(f"Escrito {os.path.relpath(OUTPUT, SKETCH_DIR)}")
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -4,7 +4,12 @@
 #include <ArduinoJson.h>
 #include "vfo_handler.h"
 #include "config.h"
+#include "main_interface.h"
 #include "display_handler.h"
+#include "si5351_tuner.h"
+#include "si5351_cal.h"
+#include "freq_format.h"
+#include "i2c_bus.h"
 
 // ==========================================================
 // DECLARACIÓN DE OBJETOS Y VARIABLES EXTERNAS
@@ -19,7 +24,57 @@ extern bool si5351_present;
 // ==========================================================
 #define IF_FREQ_KHZ   455     // Frecuencia Intermedia en kHz
 #define BAND_INIT     7       // Banda inicial al arrancar (1-21)
-#define XT_CAL_F      0       // Factor de calibración
+#define VFO_MIN_FREQ  10000UL
+#define VFO_MAX_FREQ  225000000UL
+
+// ==========================================================
+// TABLA DE BANDAS (ordenada por frecuencia inicial)
+// ==========================================================
+// Cada banda cubre [desde_hz, hasta_hz). 'preset_hz' es la frecuencia a la
+// que salta set_band. Las frecuencias fuera de toda banda se muestran como "GEN".
+struct VfoBand {
+  uint32_t desde_hz;
+  uint32_t hasta_hz;
+  uint32_t preset_hz;
+  const char* nombre;
+};
+
+static constexpr VfoBand VFO_BANDS[] = {
+  {    10000,    520000,    100000, "GEN"  },
+  {   520000,   1710000,    800000, "MW"   },
+  {  1800000,   2000000,   1800000, "160m" },
+  {  3500000,   4000000,   3650000, "80m"  },
+  {  4750000,   5060000,   4985000, "60m"  },
+  {  5900000,   6200000,   6180000, "49m"  },
+  {  7000000,   7300000,   7200000, "40m"  },
+  {  9400000,  10100000,  10000000, "31m"  },
+  { 11600000,  12100000,  11780000, "25m"  },
+  { 13570000,  13870000,  13630000, "22m"  },
+  { 14000000,  14350000,  14100000, "20m"  },
+  { 14990000,  15800000,  15000000, "19m"  },
+  { 17480000,  17900000,  17655000, "16m"  },
+  { 21000000,  21850000,  21525000, "13m"  },
+  { 26965000,  27405000,  27015000, "11m"  },
+  { 28000000,  29700000,  28400000, "10m"  },
+  { 50000000,  54000000,  50000000, "6m"   },
+  { 87500000, 108000000, 100000000, "WFM"  },
+  {108000000, 137000000, 130000000, "AIR"  },
+  {144000000, 148000000, 144000000, "2m"   },
+  {220000000, 225000001, 220000000, "1m"   },
+};
+
+static constexpr uint8_t VFO_NUM_BANDS = sizeof(VFO_BANDS) / sizeof(VFO_BANDS[0]);
+
+// Verificación en compilación: la búsqueda binaria exige la tabla ordenada
+static constexpr bool bandsSorted(uint8_t i) {
+  return (i + 1 >= VFO_NUM_BANDS) ||
+         (VFO_BANDS[i].hasta_hz <= VFO_BANDS[i + 1].desde_hz && bandsSorted(i + 1));
+}
+static_assert(bandsSorted(0), "VFO_BANDS debe estar ordenada y sin solapamientos");
+
+// Pasos disponibles (set_step cicla por esta lista)
+static const unsigned long VFO_STEPS[] = {1, 10, 1000, 5000, 10000, 1000000};
+#define VFO_NUM_STEPS (sizeof(VFO_STEPS) / sizeof(VFO_STEPS[0]))
 
 // Variables de estado del VFO
 static unsigned long vfo_freq = 0;
@@ -28,40 +83,138 @@ static long vfo_interfreq_khz = IF_FREQ_KHZ;
 static byte vfo_stp = 4;
 static byte vfo_band_count = BAND_INIT;
 static bool vfo_is_tx = false;
-static String vfo_band_name = "";
+static const char* vfo_band_name = "";
+static bool vfo_iq_mode = false;          // CLK0/CLK1 en cuadratura
+static unsigned long vfo_clk2_hz = 0;     // BFO / referencia en CLK2 (0 = apagado)
+static int32_t vfo_correction_ppb = SI5351_CORRECTION;  // Corrección del cristal (NVS)
 
 // Prototipos de funciones internas
-void applyFrequency();
+unsigned long long currentLoHz();
+bool applyFrequency();
 void setNextStep();
 void setNextBand();
+void updateBandFromFrequency();
 void updateDisplayVfoState();
 
 // ==========================================================
 // IMPLEMENTACIÓN DE FUNCIONES PÚBLICAS
 // ==========================================================
 
-void vfo_setup() {
-  if (si5351.init(SI5351_CRYSTAL_LOAD_8PF, SI5351_CRYSTAL_FREQ, SI5351_CORRECTION)) {
+// El Si5351 ignora la configuración hasta terminar su inicialización
+// interna (SYS_INIT, bit 7 del registro 0): se consulta en vez de dormir.
+static bool waitSi5351Ready() {
+  uint32_t t0 = millis();
+  const uint8_t reg = 0;
+  do {
+    uint8_t status;
+    if (i2c_bus_read(SI5351_ADDR, &reg, 1, &status, 1, I2C_CLIENT_SYNTH) == 0 && !(status & 0x80)) {
+      return true;
+    }
+    delay(1);
+  } while (millis() - t0 < SI5351_READY_TIMEOUT_MS);
+  return false;
+}
+
+void vfo_setup(RestoreSource restore) {
+  // La corrección calibrada se aplica desde el primer retune
+  vfo_correction_ppb = si5351_cal_load();
+  si5351_present = false;
+  if (restore == RESTORE_RTC) {
+      // Reinicio en caliente: el chip sigue generando el plan del checkpoint.
+      // si5351.init() lo resetearía (salidas apagadas, PLL por defecto).
+      si5351_present = waitSi5351Ready() && si5351_tuner_begin(vfo_correction_ppb);
+  } else if (waitSi5351Ready() && si5351.init(SI5351_CRYSTAL_LOAD_8PF, SI5351_CRYSTAL_FREQ, vfo_correction_ppb)) {
       si5351.drive_strength(SI5351_CLK0, SI5351_DRIVE_8MA);
       si5351.output_enable(SI5351_CLK0, 1);
-      si5351_present = true;
-      printToAll("Si5351 iniciado OK.");
+      // Si no se puede leer la shadow, el tuner no puede escribir al chip
+      si5351_present = si5351_tuner_begin(vfo_correction_ppb);
+  }
+
+  if (si5351_present) {
+      printToAll("Si5351 iniciado OK.\nCal: " + String(vfo_correction_ppb) + " ppb");
       
       setNextBand();
       vfo_band_count = BAND_INIT;
       setNextBand();
       
-      applyFrequency();
+      if (restore == RESTORE_NONE) applyFrequency();
       updateDisplayVfoState();
-      delay(1500);
 
   } else {
-      si5351_present = false;
       printToAll("Error Si5351.");
-      delay(1500);
   }
 }
 
+void vfo_get_state(uint32_t* freq_hz, uint32_t* step_hz, bool* is_tx) {
+  *freq_hz = vfo_freq;
+  *step_hz = vfo_fstep;
+  *is_tx = vfo_is_tx;
+}
+
+bool vfo_apply_state(uint32_t freq_hz, uint32_t step_hz, bool is_tx) {
+  if (!si5351_present || freq_hz < VFO_MIN_FREQ || freq_hz > VFO_MAX_FREQ) return false;
+  unsigned long prev_freq = vfo_freq;
+  unsigned long prev_fstep = vfo_fstep;
+  byte prev_stp = vfo_stp;
+  byte prev_band_count = vfo_band_count;
+  const char* prev_band_name = vfo_band_name;
+  bool prev_is_tx = vfo_is_tx;
+
+  for (uint8_t i = 0; i < VFO_NUM_STEPS; i++) {
+    if (VFO_STEPS[i] == step_hz) { vfo_stp = i + 1; vfo_fstep = step_hz; }
+  }
+  vfo_freq = freq_hz;
+  vfo_is_tx = is_tx;
+  updateBandFromFrequency();
+  bool ok = applyFrequency();   // Un único commit al Si5351
+  if (!ok) {
+    // Igual que handleVfoCommand: el chip y el estado vuelven a lo anterior
+    vfo_freq = prev_freq;
+    vfo_fstep = prev_fstep;
+    vfo_stp = prev_stp;
+    vfo_band_count = prev_band_count;
+    vfo_band_name = prev_band_name;
+    vfo_is_tx = prev_is_tx;
+    applyFrequency();
+  }
+  updateDisplayVfoState();
+  return ok;
+}
+
+void vfo_get_outputs(bool* iq_mode, uint32_t* clk2_hz) {
+  *iq_mode = vfo_iq_mode;
+  *clk2_hz = vfo_clk2_hz;
+}
+
+bool vfo_apply_outputs(bool iq_mode, uint32_t clk2_hz) {
+  if (!si5351_present) return false;
+  bool ok = true;
+  if (iq_mode != vfo_iq_mode) {
+    if (si5351_tuner_set_mode(iq_mode ? SI5351_MODE_IQ : SI5351_MODE_SINGLE)) vfo_iq_mode = iq_mode;
+    else ok = false;
+  }
+  if (clk2_hz != vfo_clk2_hz) {
+    if (si5351_tuner_set_clk2(clk2_hz)) vfo_clk2_hz = clk2_hz;
+    else ok = false;
+  }
+  return ok;
+}
+
+bool vfo_load_image(const Si5351TunerImage& img, uint32_t freq_hz, uint32_t step_hz, bool is_tx) {
+  if (!si5351_present || freq_hz < VFO_MIN_FREQ || freq_hz > VFO_MAX_FREQ) return false;
+  if (!si5351_tuner_import(img)) return false;   // Otra calibración: hay que re-planificar
+  for (uint8_t i = 0; i < VFO_NUM_STEPS; i++) {
+    if (VFO_STEPS[i] == step_hz) { vfo_stp = i + 1; vfo_fstep = step_hz; }
+  }
+  vfo_freq = freq_hz;
+  vfo_is_tx = is_tx;
+  vfo_iq_mode = (img.mode == SI5351_MODE_IQ);
+  vfo_clk2_hz = (unsigned long)img.clk2_hz;
+  updateBandFromFrequency();
+  updateDisplayVfoState();
+  return true;
+}
+
 void handleVfoCommand(uint8_t clientNum, JsonDocument& doc) {
   if (!si5351_present) {
     StaticJsonDocument<200> errorDoc;
@@ -69,7 +222,7 @@ void handleVfoCommand(uint8_t clientNum, JsonDocument& doc) {
     errorDoc["mensaje"] = "Si5351 no encontrado. No se pueden procesar comandos de VFO.";
     String output;
     serializeJson(errorDoc, output);
-    webSocket.sendTXT(clientNum, output);
+    enviarRespuesta(clientNum, output);
     return;
   }
     
@@ -77,6 +230,11 @@ void handleVfoCommand(uint8_t clientNum, JsonDocument& doc) {
   // == INICIO DE LA CORRECCIÓN ==
   // ==========================================================
   const char* sub_accion = doc["sub_accion"];
+  unsigned long prev_freq = vfo_freq;
+  bool prev_is_tx = vfo_is_tx;
+  bool retune = true;
+  const char* mensaje_error = nullptr;
+  char error_buf[80];
 
   // Esta comprobación es crucial. Solo se procesan los comandos si 'sub_accion' existe.
   // Si es nulo (como ocurre en el evento de conexión), este bloque se salta,
@@ -86,10 +244,28 @@ void handleVfoCommand(uint8_t clientNum, JsonDocument& doc) {
       String direccion = doc["direccion"];
       if (direccion == "up") {
         vfo_freq += vfo_fstep;
-        if (vfo_freq >= 225000000) vfo_freq = 225000000;
+        if (vfo_freq >= VFO_MAX_FREQ) vfo_freq = VFO_MAX_FREQ;
       } else if (direccion == "down") {
-        vfo_freq -= vfo_fstep;
-        if (vfo_freq < 10000) vfo_freq = 10000;
+        // Evitamos el desborde del unsigned cuando el paso supera la frecuencia
+        if (vfo_freq >= VFO_MIN_FREQ + vfo_fstep) vfo_freq -= vfo_fstep;
+        else vfo_freq = VFO_MIN_FREQ;
+      }
+      updateBandFromFrequency();
+    } else if (strcmp(sub_accion, "set_freq") == 0) {
+      JsonVariant f = doc["frecuencia_hz"];
+      // Negativos, decimales y valores enormes caen en el mismo rechazo de rango
+      uint64_t new_freq = f.is<uint64_t>() ? f.as<uint64_t>() : 0;
+      if (f.isNull()) {
+        mensaje_error = "Falta 'frecuencia_hz'.";
+        retune = false;
+      } else if (new_freq < VFO_MIN_FREQ || new_freq > VFO_MAX_FREQ) {
+        snprintf(error_buf, sizeof(error_buf), "Frecuencia fuera de rango (%lu..%lu Hz).",
+                 (unsigned long)VFO_MIN_FREQ, (unsigned long)VFO_MAX_FREQ);
+        mensaje_error = error_buf;
+        retune = false;
+      } else {
+        vfo_freq = (unsigned long)new_freq;
+        updateBandFromFrequency();
       }
     } else if (strcmp(sub_accion, "set_step") == 0) {
       setNextStep();
@@ -98,20 +274,71 @@ void handleVfoCommand(uint8_t clientNum, JsonDocument& doc) {
     } else if (strcmp(sub_accion, "set_rxtx") == 0) {
       String modo = doc["modo"];
       vfo_is_tx = (modo == "tx");
+    } else if (strcmp(sub_accion, "set_output_mode") == 0) {
+      String modo = doc["modo_salida"];
+      bool want_iq = (modo == "iq");
+      if (si5351_tuner_set_mode(want_iq ? SI5351_MODE_IQ : SI5351_MODE_SINGLE)) {
+        vfo_iq_mode = want_iq;
+      } else {
+        mensaje_error = "Modo IQ disponible solo entre 4.8 y 150 MHz.";
+      }
+      retune = false;
+    } else if (strcmp(sub_accion, "set_clk2") == 0) {
+      uint32_t f = doc["frecuencia_hz"] | 0;
+      if (si5351_tuner_set_clk2(f)) {
+        vfo_clk2_hz = f;
+      } else {
+        mensaje_error = "Frecuencia de CLK2 fuera de rango.";
+      }
+      retune = false;
+    } else if (strcmp(sub_accion, "calibrar") == 0) {
+      // metodo: "pcnt" (CLK2 -> SI5351_CAL_PIN), "lectura" (CLK0 medido por el usuario) o "borrar"
+      String metodo = doc["metodo"];
+      int32_t new_ppb = vfo_correction_ppb;
+      bool ok = false;
+      if (metodo == "borrar") {
+        new_ppb = SI5351_CORRECTION;
+        ok = true;
+      } else if (metodo == "lectura") {
+        double medida = doc["frecuencia_medida_hz"] | 0.0;
+        ok = si5351_cal_compute(vfo_correction_ppb, (double)currentLoHz(), medida, &new_ppb);
+      } else if (metodo == "pcnt") {
+        updateOledStatus("CALIBRANDO");
+        si5351_tuner_set_clk2(SI5351_CAL_FREQ_HZ);
+        double medida = si5351_cal_measure(SI5351_CAL_GATE_MS);
+        si5351_tuner_set_clk2(vfo_clk2_hz);
+        ok = si5351_cal_compute(vfo_correction_ppb, SI5351_CAL_FREQ_HZ, medida, &new_ppb);
+      }
+      if (ok) {
+        vfo_correction_ppb = new_ppb;
+        si5351_cal_save(new_ppb);
+        si5351_tuner_set_correction(new_ppb);
+      } else {
+        mensaje_error = "Calibracion fallida: medicion invalida o fuera de rango.";
+      }
+      retune = false;
     }
   }
   // ==========================================================
   // == FIN DE LA CORRECCIÓN ==
   // ==========================================================
 
-  // Aplicar cambios y actualizar estado
-  applyFrequency();
+  // Aplicar cambios y actualizar estado.
+  // Si el LO no es alcanzable (p. ej. fuera del rango IQ) se vuelve al estado previo.
+  if (retune && !applyFrequency()) {
+    vfo_freq = prev_freq;
+    vfo_is_tx = prev_is_tx;
+    updateBandFromFrequency();
+    applyFrequency();
+    mensaje_error = "Frecuencia fuera de rango para el modo de salida actual.";
+  }
   updateDisplayVfoState();
-  showMainScreen(); // Actualizar la pantalla física
+  display_mark_dirty(); // La pantalla se redibuja en display_service()
 
   // Preparar y enviar respuesta con el estado actual
   StaticJsonDocument<512> responseDoc;
-  responseDoc["status"] = "ok";
+  responseDoc["status"] = mensaje_error ? "error" : "ok";
+  if (mensaje_error) responseDoc["mensaje"] = mensaje_error;
   responseDoc["accion"] = "respuesta_vfo";
   JsonObject data = responseDoc.createNestedObject("datos");
   data["frecuencia_hz"] = vfo_freq;
@@ -119,76 +346,81 @@ void handleVfoCommand(uint8_t clientNum, JsonDocument& doc) {
   data["banda_nombre"] = vfo_band_name;
   data["modo"] = vfo_is_tx ? "TX" : "RX";
   data["if_khz"] = vfo_interfreq_khz;
+  data["salida"] = vfo_iq_mode ? "IQ" : "NORMAL";
+  data["clk2_hz"] = vfo_clk2_hz;
+  data["correccion_ppb"] = vfo_correction_ppb;
+
+  // Costo en el bus del último retune (ver si5351_tuner.h)
+  const Si5351TunerStats& stats = si5351_tuner_last_stats();
+  data["i2c_bytes"] = stats.bytes;
+  data["i2c_us"] = stats.us;
+  data["pll_reset"] = stats.pll_reset;
 
   String output;
   serializeJson(responseDoc, output);
-  webSocket.sendTXT(clientNum, output);
+  enviarRespuesta(clientNum, output);
 }
 
 // ==========================================================
 // IMPLEMENTACIÓN DE FUNCIONES PRIVADAS (Lógica del VFO)
 // ==========================================================
 
-void applyFrequency() {
+// Frecuencia real del LO en CLK0: en RX se suma la FI
+unsigned long long currentLoHz() {
   long current_if_khz = vfo_is_tx ? 0 : vfo_interfreq_khz;
-  unsigned long long freq_if_hz = (unsigned long long)vfo_freq + (current_if_khz * 1000ULL);
-  si5351.set_freq(freq_if_hz * 100ULL, SI5351_CLK0);
+  return (unsigned long long)vfo_freq + (current_if_khz * 1000ULL);
+}
+
+bool applyFrequency() {
+  return si5351_tuner_set_freq(currentLoHz());
 }
 
 void setNextStep() {
   vfo_stp++;
-  if (vfo_stp > 6) vfo_stp = 1;
-  
-  switch (vfo_stp) {
-    case 1: vfo_fstep = 1; break;
-    case 2: vfo_fstep = 10; break;
-    case 3: vfo_fstep = 1000; break;
-    case 4: vfo_fstep = 5000; break;
-    case 5: vfo_fstep = 10000; break;
-    case 6: vfo_fstep = 1000000; break;
-  }
+  if (vfo_stp > VFO_NUM_STEPS) vfo_stp = 1;
+  vfo_fstep = VFO_STEPS[vfo_stp - 1];
 }
 
 void setNextBand() {
   vfo_band_count++;
-  if (vfo_band_count > 21) vfo_band_count = 1;
-
-  switch (vfo_band_count) {
-    case 1: vfo_freq = 100000; vfo_band_name = "GEN"; break;
-    case 2: vfo_freq = 800000; vfo_band_name = "MW"; break;
-    case 3: vfo_freq = 1800000; vfo_band_name = "160m"; break;
-    case 4: vfo_freq = 3650000; vfo_band_name = "80m"; break;
-    case 5: vfo_freq = 4985000; vfo_band_name = "60m"; break;
-    case 6: vfo_freq = 6180000; vfo_band_name = "49m"; break;
-    case 7: vfo_freq = 7200000; vfo_band_name = "40m"; break;
-    case 8: vfo_freq = 10000000; vfo_band_name = "31m"; break;
-    case 9: vfo_freq = 11780000; vfo_band_name = "25m"; break;
-    case 10: vfo_freq = 13630000; vfo_band_name = "22m"; break;
-    case 11: vfo_freq = 14100000; vfo_band_name = "20m"; break;
-    case 12: vfo_freq = 15000000; vfo_band_name = "19m"; break;
-    case 13: vfo_freq = 17655000; vfo_band_name = "16m"; break;
-    case 14: vfo_freq = 21525000; vfo_band_name = "13m"; break;
-    case 15: vfo_freq = 27015000; vfo_band_name = "11m"; break;
-    case 16: vfo_freq = 28400000; vfo_band_name = "10m"; break;
-    case 17: vfo_freq = 50000000; vfo_band_name = "6m"; break;
-    case 18: vfo_freq = 100000000; vfo_band_name = "WFM"; break;
-    case 19: vfo_freq = 130000000; vfo_band_name = "AIR"; break;
-    case 20: vfo_freq = 144000000; vfo_band_name = "2m"; break;
-    case 21: vfo_freq = 220000000; vfo_band_name = "1m"; break;
+  if (vfo_band_count > VFO_NUM_BANDS) vfo_band_count = 1;
+
+  const VfoBand& band = VFO_BANDS[vfo_band_count - 1];
+  vfo_freq = band.preset_hz;
+  vfo_band_name = band.nombre;
+  // El reset de PLL lo decide si5351_tuner solo si cambia el plan
+}
+
+// Búsqueda binaria: última banda cuyo 'desde_hz' <= freq.
+// Devuelve el índice (0..N-1) o -1 si la frecuencia está por debajo de la tabla.
+static int findBandIndex(uint32_t freq) {
+  int lo = 0, hi = VFO_NUM_BANDS - 1, found = -1;
+  while (lo <= hi) {
+    int mid = (lo + hi) / 2;
+    if (VFO_BANDS[mid].desde_hz <= freq) { found = mid; lo = mid + 1; }
+    else hi = mid - 1;
+  }
+  return found;
+}
+
+void updateBandFromFrequency() {
+  int idx = findBandIndex(vfo_freq);
+  if (idx >= 0) {
+    // set_band continúa desde la banda actual
+    vfo_band_count = idx + 1;
+    vfo_band_name = (vfo_freq < VFO_BANDS[idx].hasta_hz) ? VFO_BANDS[idx].nombre : "GEN";
+  } else {
+    vfo_band_name = "GEN";
   }
-  si5351.pll_reset(SI5351_PLLA);
 }
 
 void updateDisplayVfoState() {
-    currentDisplayState.moduleName = "Si5351  (" + String(vfo_is_tx ? "TX" : "RX") + ")";
-    
-    double freqMHz = vfo_freq / 1000000.0;
-    currentDisplayState.primaryDisplay = String(freqMHz, 3) + " MHz";
+    snprintf(currentDisplayState.moduleName, DISPLAY_TEXT_LEN, "Si5351  (%s)", vfo_is_tx ? "TX" : "RX");
 
-    String stepStr;
-    if(vfo_fstep < 1000) stepStr = String(vfo_fstep) + "Hz";
-    else stepStr = String(vfo_fstep / 1000) + "kHz";
-    currentDisplayState.secondaryDisplay = "Banda: " + vfo_band_name;
-    
-    currentDisplayState.tertiaryDisplay = "Paso: " + stepStr;
+    format_frequency(currentDisplayState.primaryDisplay, DISPLAY_TEXT_LEN, vfo_freq, FREQ_UNIT_MHZ, 3);
+
+    snprintf(currentDisplayState.secondaryDisplay, DISPLAY_TEXT_LEN, "Banda: %s", vfo_band_name);
+
+    if (vfo_fstep < 1000) snprintf(currentDisplayState.tertiaryDisplay, DISPLAY_TEXT_LEN, "Paso: %uHz", (unsigned)vfo_fstep);
+    else snprintf(currentDisplayState.tertiaryDisplay, DISPLAY_TEXT_LEN, "Paso: %ukHz", (unsigned)(vfo_fstep / 1000));
 }
\ No newline at end of file
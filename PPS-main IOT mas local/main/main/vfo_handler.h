@@ -3,9 +3,22 @@
 
 #include <Arduino.h>
 #include <ArduinoJson.h>
+#include "instrument_state.h"
 
-void vfo_setup();
+void vfo_setup(RestoreSource restore);
 
 void handleVfoCommand(uint8_t clientNum, JsonDocument& doc);
 
+// Estado completo (memorias / persistencia). apply_state hace un solo retune.
+void vfo_get_state(uint32_t* freq_hz, uint32_t* step_hz, bool* is_tx);
+bool vfo_apply_state(uint32_t freq_hz, uint32_t step_hz, bool is_tx);
+
+// Salidas auxiliares (persistencia): cuadratura I/Q y CLK2. Solo se escribe lo que cambia.
+void vfo_get_outputs(bool* iq_mode, uint32_t* clk2_hz);
+bool vfo_apply_outputs(bool iq_mode, uint32_t clk2_hz);
+
+// Reinicio en caliente: recarga el plan exportado del Si5351 sin re-planificar.
+struct Si5351TunerImage;
+bool vfo_load_image(const Si5351TunerImage& img, uint32_t freq_hz, uint32_t step_hz, bool is_tx);
+
 #endif // VFO_HANDLER_H
\ No newline at end of file
@@ -0,0 +1,175 @@
+#include <stddef.h>
+#include <esp_system.h>
+#include <esp_attr.h>
+#include <esp32/rom/crc.h>
+#include "warm_restart.h"
+#include "instrument_state.h"
+#include "si5351_tuner.h"
+#include "vfo_handler.h"
+#include "ad9850_handler.h"
+#include "adf4351_handler.h"
+#include "rf_switch_handler.h"
+#include "display_handler.h"
+#include "config.h"
+
+struct WarmCheckpoint {
+  uint32_t magic;                  // WARM_MAGIC: marca + huella del formato
+  uint32_t size;
+  InstrumentSnapshot state;
+  uint32_t adf4351_regs[6];
+  uint32_t ad9850_word;
+  Si5351TunerImage si5351;
+  uint32_t crc;                    // CRC32 de todo lo anterior
+};
+
+// Huella del formato: tamaño y posición de cada campo guardado. Si otra
+// versión del firmware (p. ej. tras una OTA) mueve, agrega o cambia el
+// tamaño de un campo, su checkpoint no valida aunque mida lo mismo.
+static constexpr uint32_t WARM_LAYOUT[] = {
+  sizeof(WarmCheckpoint),
+  offsetof(WarmCheckpoint, state), offsetof(WarmCheckpoint, adf4351_regs),
+  offsetof(WarmCheckpoint, ad9850_word), offsetof(WarmCheckpoint, si5351),
+  offsetof(WarmCheckpoint, crc),
+  sizeof(InstrumentSnapshot),
+  offsetof(InstrumentSnapshot, version), offsetof(InstrumentSnapshot, generador),
+  offsetof(InstrumentSnapshot, oscilador), offsetof(InstrumentSnapshot, vfo_tx),
+  offsetof(InstrumentSnapshot, vfo_iq), offsetof(InstrumentSnapshot, ad9850_on),
+  offsetof(InstrumentSnapshot, adf4351_potencia), offsetof(InstrumentSnapshot, adf4351_on),
+  offsetof(InstrumentSnapshot, vfo_freq_hz), offsetof(InstrumentSnapshot, vfo_paso_hz),
+  offsetof(InstrumentSnapshot, vfo_clk2_hz), offsetof(InstrumentSnapshot, ad9850_freq_hz),
+  offsetof(InstrumentSnapshot, ad9850_paso_hz), offsetof(InstrumentSnapshot, adf4351_paso_hz),
+  offsetof(InstrumentSnapshot, adf4351_freq_hz),
+  sizeof(Si5351TunerImage),
+  offsetof(Si5351TunerImage, regs), offsetof(Si5351TunerImage, oeb),
+  offsetof(Si5351TunerImage, phase1), offsetof(Si5351TunerImage, mode),
+  offsetof(Si5351TunerImage, plan), offsetof(Si5351TunerImage, xtal_mhz),
+  offsetof(Si5351TunerImage, lo_hz), offsetof(Si5351TunerImage, clk2_hz),
+};
+
+// FNV-1a sobre la tabla (recursivo: constexpr de C++11)
+static constexpr uint32_t layoutHash(size_t i, uint32_t h) {
+  return i == sizeof(WARM_LAYOUT) / sizeof(WARM_LAYOUT[0])
+             ? h : layoutHash(i + 1, (h ^ WARM_LAYOUT[i]) * 16777619UL);
+}
+
+#define WARM_MAGIC  (0x57524D31UL ^ layoutHash(0, 2166136261UL))   // "WRM1" ^ huella
+
+// Fuera de .bss: el arranque no la pone a cero
+RTC_NOINIT_ATTR static WarmCheckpoint rtc_checkpoint;
+
+static WarmCheckpoint staging;
+static esp_reset_reason_t reset_reason = ESP_RST_UNKNOWN;
+static bool restored = false;
+static uint32_t restore_us = 0;
+static uint32_t updates = 0;
+static uint32_t last_check_ms = 0;
+
+static uint32_t checkpointCrc(const WarmCheckpoint& cp) {
+  return crc32_le(0, (const uint8_t*)&cp, offsetof(WarmCheckpoint, crc));
+}
+
+static bool checkpointValid(const WarmCheckpoint& cp) {
+  return cp.magic == WARM_MAGIC && cp.size == sizeof(WarmCheckpoint) && cp.crc == checkpointCrc(cp);
+}
+
+// Reinicios que no cortan la alimentación de los chips ni borran la RTC
+static bool isWarmReset(esp_reset_reason_t r) {
+  switch (r) {
+    case ESP_RST_SW:
+    case ESP_RST_PANIC:
+    case ESP_RST_INT_WDT:
+    case ESP_RST_TASK_WDT:
+    case ESP_RST_WDT:
+      return true;
+    default:
+      return false;
+  }
+}
+
+static void build(WarmCheckpoint& cp) {
+  memset(&cp, 0, sizeof(cp));   // Relleno en cero: el CRC y memcmp dependen de él
+  cp.magic = WARM_MAGIC;
+  cp.size = sizeof(WarmCheckpoint);
+  instrument_state_capture(cp.state);
+  adf4351_get_registers(cp.adf4351_regs);
+  cp.ad9850_word = ad9850_get_word();
+  si5351_tuner_export(&cp.si5351);
+}
+
+// ==========================================================
+// RESTAURACIÓN Y SERVICIO
+// ==========================================================
+
+bool warm_restart_begin() {
+  reset_reason = esp_reset_reason();
+  if (!isWarmReset(reset_reason) || !checkpointValid(rtc_checkpoint)) return false;
+  staging = rtc_checkpoint;
+  restored = true;
+  return true;
+}
+
+void warm_restart_apply() {
+  if (!restored) return;
+
+  uint32_t t0 = micros();
+  const InstrumentSnapshot& s = staging.state;
+  InstrumentSnapshot defaults;
+  instrument_state_capture(defaults);
+
+  select_generator(s.generador);
+  select_oscillator(s.oscilador);
+  // Si la calibración cambió la imagen del Si5351 no sirve: se re-planifica
+  if (!vfo_load_image(staging.si5351, s.vfo_freq_hz, s.vfo_paso_hz, s.vfo_tx)) {
+    vfo_apply_state(s.vfo_freq_hz, s.vfo_paso_hz, s.vfo_tx);
+    vfo_apply_outputs(s.vfo_iq, s.vfo_clk2_hz);
+  }
+  // Un valor fuera de los rangos de este firmware: valores por defecto
+  if (!ad9850_load_word(staging.ad9850_word, s.ad9850_freq_hz, s.ad9850_paso_hz, s.ad9850_on)) {
+    ad9850_apply_state(defaults.ad9850_freq_hz, defaults.ad9850_paso_hz, defaults.ad9850_on);
+  }
+  if (!adf4351_load_registers(staging.adf4351_regs, s.adf4351_freq_hz, s.adf4351_paso_hz,
+                              s.adf4351_potencia, s.adf4351_on)) {
+    adf4351_apply_state(defaults.adf4351_freq_hz, defaults.adf4351_paso_hz,
+                        defaults.adf4351_potencia, defaults.adf4351_on);
+  }
+  restore_us = micros() - t0;
+  display_mark_dirty();
+  Serial.printf("[Reinicio] Estado restaurado desde la RTC en %lu us.\n", (unsigned long)restore_us);
+}
+
+void warm_restart_service() {
+  uint32_t now = millis();
+  if (now - last_check_ms < WARM_CHECKPOINT_MS) return;
+  last_check_ms = now;
+
+  build(staging);
+  if (memcmp(&staging, &rtc_checkpoint, offsetof(WarmCheckpoint, crc)) == 0 &&
+      checkpointValid(rtc_checkpoint)) return;
+
+  // Si el reinicio cae a mitad de la copia el CRC no coincide y se usa la NVS
+  staging.crc = checkpointCrc(staging);
+  rtc_checkpoint = staging;
+  updates++;
+}
+
+static const char* resetReasonName(esp_reset_reason_t r) {
+  switch (r) {
+    case ESP_RST_POWERON:  return "encendido";
+    case ESP_RST_EXT:      return "externo";
+    case ESP_RST_SW:       return "software";
+    case ESP_RST_PANIC:    return "panico";
+    case ESP_RST_INT_WDT:  return "wdt_interrupcion";
+    case ESP_RST_TASK_WDT: return "wdt_tarea";
+    case ESP_RST_WDT:      return "wdt";
+    case ESP_RST_BROWNOUT: return "brownout";
+    case ESP_RST_DEEPSLEEP: return "deep_sleep";
+    default:               return "desconocido";
+  }
+}
+
+void warm_restart_report(JsonObject obj) {
+  obj["motivo"] = resetReasonName(reset_reason);
+  obj["desde_rtc"] = restored;
+  if (restored) obj["restauracion_us"] = restore_us;
+  obj["checkpoints"] = updates;
+}
@@ -0,0 +1,44 @@
+#ifndef WARM_RESTART_H
+#define WARM_RESTART_H
+
+#include <Arduino.h>
+#include <ArduinoJson.h>
+
+// ==========================================================
+// CHECKPOINT DE REINICIO EN CALIENTE (MEMORIA RTC)
+// ==========================================================
+// Copia compacta del estado del instrumento y de las imágenes de registros
+// ya calculadas (ADF4351 registers[6], palabra del AD9850, plan del Si5351)
+// en la RAM lenta del RTC, protegida con CRC32. Esa RAM sobrevive a un
+// esp_restart(), a una actualización OTA y a los watchdogs, pero no a un
+// corte de energía. Tras un reinicio en caliente los chips se reprograman
+// con las imágenes tal cual, sin re-planificar ni leer la NVS.
+// Escribir en la RTC no gasta flash, así que el checkpoint se refresca
+// apenas cambia algo (revisado cada WARM_CHECKPOINT_MS).
+
+/**
+ * @brief Decide si el arranque sale del checkpoint: reinicio en caliente y
+ * checkpoint válido (CRC y formato de este firmware). Llamar en setup()
+ * antes de los *_setup(), que con RESTORE_RTC no reinician los chips.
+ * @return true si se restaurará desde la RTC (no hace falta aplicar la NVS).
+ */
+bool warm_restart_begin();
+
+/**
+ * @brief Aplica el checkpoint aceptado por warm_restart_begin(): rutas de
+ * los switches y un commit por chip desde las imágenes. Llamar en setup()
+ * tras inicializar generadores y switches.
+ */
+void warm_restart_apply();
+
+/**
+ * @brief Refresca el checkpoint si cambió el estado. Llamar en loop().
+ */
+void warm_restart_service();
+
+/**
+ * @brief Agrega al JSON el motivo del reinicio y si se usó el checkpoint.
+ */
+void warm_restart_report(JsonObject obj);
+
+#endif // WARM_RESTART_H
@@ -0,0 +1,56 @@
+#include "web_ui.h"
+#include "web_ui_assets.h"
+
+// Los handlers corren todos en la tarea del servidor HTTP
+static WebUiStats ui_stats = {0, 0, 0};
+
+static esp_err_t serveAsset(httpd_req_t* req) {
+  const WebUiAsset* asset = (const WebUiAsset*)req->user_ctx;
+  ui_stats.requests++;
+  httpd_resp_set_hdr(req, "ETag", asset->etag);
+  httpd_resp_set_hdr(req, "Cache-Control", "no-cache");
+
+  char if_none_match[40];
+  if (httpd_req_get_hdr_value_str(req, "If-None-Match", if_none_match, sizeof(if_none_match)) == ESP_OK &&
+      strcmp(if_none_match, asset->etag) == 0) {
+    ui_stats.not_modified++;
+    httpd_resp_set_status(req, "304 Not Modified");
+    return httpd_resp_send(req, nullptr, 0);
+  }
+  httpd_resp_set_type(req, asset->mime);
+  httpd_resp_set_hdr(req, "Content-Encoding", "gzip");
+  ui_stats.bytes_sent += asset->gz_len;
+  return httpd_resp_send(req, (const char*)asset->gz, asset->gz_len);
+}
+
+static esp_err_t handleStats(httpd_req_t* req) {
+  size_t gz_total = 0, raw_total = 0;
+  for (size_t i = 0; i < WEB_UI_ASSET_COUNT; i++) {
+    gz_total += WEB_UI_ASSETS[i].gz_len;
+    raw_total += WEB_UI_ASSETS[i].raw_len;
+  }
+  char json[192];
+  snprintf(json, sizeof(json),
+           "{\"solicitudes\":%lu,\"no_modificado\":%lu,\"bytes_enviados\":%lu,"
+           "\"primera_carga_bytes\":%u,\"sin_comprimir_bytes\":%u}",
+           (unsigned long)ui_stats.requests, (unsigned long)ui_stats.not_modified,
+           (unsigned long)ui_stats.bytes_sent, (unsigned)gz_total, (unsigned)raw_total);
+  httpd_resp_set_type(req, "application/json");
+  return httpd_resp_send(req, json, HTTPD_RESP_USE_STRLEN);
+}
+
+void web_ui_register(httpd_handle_t server) {
+  if (!server) return;
+  for (size_t i = 0; i < WEB_UI_ASSET_COUNT; i++) {
+    httpd_uri_t uri = {WEB_UI_ASSETS[i].path, HTTP_GET, serveAsset, (void*)&WEB_UI_ASSETS[i]};
+    httpd_register_uri_handler(server, &uri);
+  }
+  httpd_uri_t index_uri = {"/index.html", HTTP_GET, serveAsset, (void*)&WEB_UI_ASSETS[0]};
+  httpd_uri_t stats_uri = {"/estadisticas_web", HTTP_GET, handleStats, nullptr};
+  httpd_register_uri_handler(server, &index_uri);
+  httpd_register_uri_handler(server, &stats_uri);
+}
+
+const WebUiStats& web_ui_stats() {
+  return ui_stats;
+}
@@ -0,0 +1,29 @@
+#ifndef WEB_UI_H
+#define WEB_UI_H
+
+#include <Arduino.h>
+#include <esp_http_server.h>
+
+// ==========================================================
+// INTERFAZ WEB SERVIDA DESDE LA FLASH
+// ==========================================================
+// Sirve el panel ("Nueva pagina") empaquetado por tools/pack_web_ui.py en
+// web_ui_assets.h: cada archivo va comprimido con gzip y con su ETag.
+// Cache-Control: no-cache hace que el navegador guarde la copia pero la
+// revalide; si no cambió, la recarga cuesta un 304 sin cuerpo.
+
+struct WebUiStats {
+  uint32_t requests;
+  uint32_t not_modified;   // Respuestas 304
+  uint32_t bytes_sent;     // Cuerpos enviados (comprimidos)
+};
+
+/**
+ * @brief Registra las rutas del panel en el servidor HTTP ("/", "/index.html",
+ * "/script.js", "/style.css" y "/estadisticas_web").
+ */
+void web_ui_register(httpd_handle_t server);
+
+const WebUiStats& web_ui_stats();
+
+#endif // WEB_UI_H
@@ -0,0 +1,535 @@
+// ARCHIVO GENERADO por tools/pack_web_ui.py - no editar a mano.
+#ifndef WEB_UI_ASSETS_H
+#define WEB_UI_ASSETS_H
+
+#include <Arduino.h>
+
+// index.html: 8834 bytes sin comprimir
+static const uint8_t ui_index_html[] PROGMEM = {
+  0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xbd, 0x5a, 0xdd, 0x6e, 0xdb, 0x36,
+  0x14, 0xbe, 0xcf, 0x53, 0xb0, 0xba, 0x28, 0x12, 0x6c, 0xf2, 0x6f, 0x32, 0xb4, 0x89, 0x2d, 0x20,
+  0xbf, 0x4d, 0x80, 0x64, 0x09, 0xea, 0xae, 0xd8, 0x2e, 0x69, 0x89, 0xb6, 0xd9, 0xd2, 0xa4, 0x42,
+  0x52, 0x4e, 0xdc, 0xab, 0x3d, 0xc5, 0x76, 0xbd, 0x07, 0xd8, 0xc5, 0x50, 0x60, 0x2f, 0x90, 0x37,
+  0xe9, 0x93, 0xec, 0x50, 0x3f, 0xb6, 0xa4, 0x48, 0xb2, 0xec, 0x78, 0x2d, 0x10, 0x34, 0x96, 0x78,
+  0x3e, 0x9e, 0xf3, 0x9d, 0x5f, 0xd2, 0xd9, 0xe9, 0xbd, 0x3a, 0xbb, 0x3d, 0xfd, 0xf0, 0xdb, 0xdd,
+  0x39, 0x9a, 0xe8, 0x29, 0x73, 0x76, 0x7a, 0xe6, 0x3f, 0xc4, 0x30, 0x1f, 0xf7, 0x2d, 0xa2, 0x2c,
+  0xf3, 0x80, 0x60, 0xcf, 0xd9, 0x41, 0xf0, 0xaf, 0x37, 0x25, 0x1a, 0x23, 0x77, 0x82, 0xa5, 0x22,
+  0xba, 0x6f, 0xfd, 0xf2, 0xe1, 0xc2, 0x7e, 0x63, 0xa5, 0x5f, 0x71, 0x3c, 0x25, 0x7d, 0x6b, 0x46,
+  0xc9, 0x83, 0x2f, 0xa4, 0xb6, 0x90, 0x2b, 0xb8, 0x26, 0x1c, 0x96, 0x3e, 0x50, 0x4f, 0x4f, 0xfa,
+  0x1e, 0x99, 0x51, 0x97, 0xd8, 0xe1, 0x87, 0x1f, 0x11, 0xe5, 0x54, 0x53, 0xcc, 0x6c, 0xe5, 0x62,
+  0x46, 0xfa, 0xed, 0x46, 0x2b, 0x81, 0xd2, 0x54, 0x33, 0xe2, 0x5c, 0x71, 0xa5, 0x65, 0x30, 0x05,
+  0x71, 0x81, 0x3e, 0x52, 0xa9, 0x03, 0xcc, 0xd0, 0xf9, 0xe0, 0xae, 0xdb, 0x41, 0x36, 0xba, 0xc3,
+  0x9c, 0x30, 0xe4, 0x11, 0x74, 0x0a, 0x1b, 0x48, 0xc1, 0x7a, 0xcd, 0x48, 0x26, 0x92, 0x67, 0x94,
+  0x7f, 0x46, 0x92, 0xb0, 0xbe, 0xa5, 0xf4, 0x9c, 0x11, 0x35, 0x21, 0x04, 0x74, 0x99, 0x48, 0x32,
+  0x8a, 0x9f, 0x34, 0x5c, 0x15, 0x5a, 0xd6, 0x8c, 0x4c, 0xeb, 0x0d, 0x85, 0x37, 0x8f, 0x65, 0x3d,
+  0x3a, 0x43, 0x2e, 0xc3, 0x4a, 0xf5, 0x2d, 0xa3, 0x3c, 0xa6, 0x9c, 0xc8, 0x58, 0xaf, 0xf0, 0xfd,
+  0x2b, 0xdb, 0x46, 0x97, 0x20, 0x45, 0x24, 0x9a, 0xa3, 0x01, 0x71, 0x5d, 0xfa, 0xf4, 0x95, 0xc7,
+  0x9a, 0x90, 0xc7, 0xf0, 0x83, 0x6d, 0xa7, 0xd6, 0x4f, 0xc2, 0xb5, 0xcb, 0x07, 0xd1, 0xc3, 0xb6,
+  0xf3, 0xdc, 0x02, 0x78, 0x98, 0x5d, 0xe5, 0xa3, 0x50, 0xd9, 0xbe, 0x35, 0xc5, 0x72, 0x4c, 0xb9,
+  0xad, 0x85, 0x7f, 0x68, 0xb7, 0x5b, 0xfe, 0xe3, 0x11, 0xf0, 0xca, 0x84, 0x3c, 0x44, 0x33, 0x2c,
+  0x77, 0x6d, 0x3b, 0xfc, 0x60, 0x7b, 0x58, 0x7e, 0xb6, 0xc7, 0x12, 0xcf, 0xf7, 0x8e, 0xac, 0x42,
+  0xee, 0x6e, 0x84, 0x17, 0x30, 0x2c, 0xd1, 0x10, 0x2b, 0xec, 0x09, 0x44, 0x78, 0xc4, 0x66, 0xaf,
+  0xe9, 0xe7, 0xf6, 0xcd, 0x51, 0x00, 0xca, 0x01, 0xae, 0x08, 0x7c, 0x2b, 0xbb, 0x2e, 0xa2, 0x1a,
+  0x0f, 0xc1, 0x8c, 0x91, 0x90, 0x26, 0x58, 0xfc, 0x6e, 0xc7, 0xa6, 0xb0, 0xec, 0x8c, 0xca, 0x84,
+  0x98, 0xab, 0x3b, 0xb0, 0x91, 0xa1, 0x33, 0xaa, 0x7c, 0xa1, 0xc0, 0xdd, 0x33, 0x71, 0xd8, 0x6b,
+  0x86, 0x42, 0x05, 0x60, 0x94, 0xfb, 0x81, 0x46, 0x7a, 0xee, 0x83, 0xcd, 0x9a, 0x3c, 0x82, 0xcf,
+  0xa8, 0x97, 0xc2, 0x45, 0x3e, 0xc3, 0x2e, 0x99, 0x08, 0x06, 0x84, 0xf6, 0xad, 0xf3, 0x4f, 0x87,
+  0xa8, 0xfd, 0xb6, 0xd3, 0x68, 0xff, 0xf4, 0xa6, 0xd1, 0x6e, 0xb4, 0x5b, 0xad, 0x22, 0xf5, 0x86,
+  0x81, 0xd6, 0x82, 0x87, 0x30, 0x60, 0x0a, 0x27, 0xae, 0xb6, 0x87, 0x9a, 0x5b, 0x05, 0xc4, 0x86,
+  0xbc, 0x5a, 0x8e, 0xf1, 0xa2, 0xab, 0xb1, 0xec, 0x35, 0x23, 0xd1, 0x1c, 0x35, 0x4d, 0xe0, 0x26,
+  0xe5, 0xdc, 0x66, 0xde, 0xbb, 0xbd, 0x29, 0x04, 0x4c, 0x4e, 0x46, 0x01, 0x20, 0xcd, 0x23, 0x45,
+  0x61, 0xd0, 0x71, 0xce, 0x95, 0x36, 0xce, 0x48, 0xc7, 0x0f, 0xa0, 0x76, 0x0a, 0x16, 0x1b, 0xaf,
+  0x18, 0x3b, 0x40, 0x40, 0x07, 0xca, 0x1e, 0x62, 0x69, 0x25, 0x5e, 0x8a, 0x1f, 0x79, 0x54, 0xc5,
+  0x46, 0x12, 0x0f, 0x9c, 0x40, 0xcc, 0x27, 0x63, 0x8c, 0x27, 0x72, 0x7a, 0x47, 0xba, 0x17, 0xea,
+  0x95, 0x5d, 0x63, 0x82, 0x3d, 0x1d, 0xe3, 0xef, 0x08, 0x64, 0x03, 0xe0, 0x49, 0xa2, 0x32, 0x51,
+  0x9e, 0xb6, 0x33, 0x54, 0x72, 0x1c, 0x2e, 0xd4, 0x42, 0x2a, 0x3b, 0x7e, 0x6c, 0x15, 0xdb, 0x9f,
+  0x46, 0x84, 0x0d, 0x06, 0xe4, 0xe9, 0x1f, 0x28, 0x06, 0xaa, 0x98, 0x83, 0x4c, 0x68, 0x42, 0x70,
+  0x07, 0x76, 0x1c, 0x9f, 0xaa, 0x00, 0x3d, 0xef, 0x7f, 0x50, 0xc9, 0xf6, 0x25, 0x99, 0x85, 0x01,
+  0xe0, 0x7c, 0xfb, 0xf3, 0x77, 0x74, 0x0c, 0xb5, 0x49, 0x52, 0x51, 0xe2, 0xeb, 0xa5, 0x5d, 0x3e,
+  0x5e, 0x22, 0x98, 0x02, 0x67, 0x88, 0x86, 0x50, 0x9c, 0x2f, 0xf8, 0x9f, 0x9a, 0xcc, 0x22, 0xe1,
+  0x3b, 0xcb, 0xf9, 0x78, 0x71, 0x8b, 0x06, 0xf4, 0xa0, 0x7b, 0xd0, 0x06, 0x8a, 0x41, 0xb4, 0x9e,
+  0x66, 0xe0, 0xfb, 0x28, 0x34, 0x9d, 0x01, 0x1d, 0x07, 0x14, 0x12, 0x97, 0xa0, 0x6f, 0x7f, 0xfc,
+  0x5b, 0xae, 0x5a, 0x81, 0x4b, 0x9f, 0xf9, 0x6f, 0xe1, 0xc3, 0x9b, 0xa7, 0xaf, 0xa0, 0x21, 0x94,
+  0x82, 0x85, 0x6e, 0xcf, 0xdc, 0x97, 0x89, 0xb1, 0xd9, 0x48, 0xd8, 0x91, 0x51, 0x0b, 0x1b, 0xe9,
+  0xa2, 0xa2, 0x2c, 0xde, 0x78, 0x58, 0x63, 0x3b, 0xaa, 0xf8, 0x4b, 0xe0, 0x32, 0x4f, 0xa4, 0x3c,
+  0x97, 0x82, 0x4a, 0x98, 0x2c, 0x16, 0x8a, 0xaa, 0xa0, 0xd3, 0x83, 0xe5, 0x82, 0x8f, 0x9d, 0x0b,
+  0xa8, 0x2a, 0x01, 0xe1, 0x2e, 0xc5, 0x50, 0x43, 0xe2, 0x67, 0x29, 0xf7, 0x18, 0xa5, 0x47, 0x92,
+  0xdc, 0x5b, 0x8e, 0x6d, 0xc7, 0xd4, 0xa3, 0x9b, 0xcb, 0x2f, 0xcf, 0xea, 0x5b, 0x09, 0xfa, 0x09,
+  0xe6, 0x5e, 0x39, 0xf0, 0x10, 0xde, 0xa6, 0x80, 0xeb, 0x82, 0xde, 0x61, 0x25, 0x4a, 0x31, 0x95,
+  0x26, 0xfe, 0x06, 0x98, 0x50, 0xc7, 0xcb, 0x31, 0xc1, 0x37, 0xa4, 0x0e, 0x66, 0x49, 0xf8, 0xe4,
+  0x5d, 0x05, 0x6c, 0x03, 0xa0, 0x5c, 0x95, 0x67, 0xf9, 0x88, 0x4e, 0x5c, 0x61, 0x7b, 0xe2, 0x81,
+  0x47, 0x61, 0xfd, 0x9a, 0xe9, 0x23, 0xf3, 0x83, 0xc0, 0x8b, 0xf7, 0xd5, 0x19, 0x57, 0x8a, 0x16,
+  0xf8, 0x11, 0x96, 0x81, 0x40, 0xaf, 0xc7, 0x00, 0x08, 0x3f, 0xeb, 0x63, 0x19, 0x5f, 0x46, 0x40,
+  0xa7, 0x78, 0x3a, 0xa4, 0xd0, 0x12, 0x43, 0xdf, 0xaf, 0x0f, 0x64, 0x1c, 0x98, 0x05, 0x32, 0xfe,
+  0x5e, 0x51, 0x4e, 0xea, 0x11, 0xbf, 0xaa, 0xf1, 0x16, 0xf6, 0x4c, 0x1e, 0x4c, 0x87, 0x30, 0xad,
+  0x64, 0x49, 0x0b, 0x17, 0xe4, 0x7a, 0xe7, 0x32, 0x93, 0xcc, 0x18, 0x70, 0xf9, 0x05, 0xed, 0xb6,
+  0x5b, 0x9f, 0x61, 0xac, 0xea, 0x74, 0x0e, 0x6e, 0xf6, 0xd6, 0xf0, 0x31, 0x4c, 0x81, 0xd1, 0x26,
+  0x21, 0x09, 0xa6, 0x97, 0x0d, 0x19, 0x71, 0x89, 0xdc, 0x9c, 0x82, 0xdc, 0x06, 0xf2, 0x51, 0x3f,
+  0x46, 0x1d, 0x3b, 0xe6, 0x65, 0x14, 0x30, 0x16, 0xcd, 0x8f, 0x45, 0x4d, 0x1c, 0x25, 0x5d, 0x3c,
+  0x76, 0x07, 0x46, 0x1f, 0x7e, 0xdd, 0x72, 0x09, 0x3d, 0x3e, 0x7b, 0xfb, 0xe6, 0xa0, 0x55, 0x5c,
+  0x3e, 0x4b, 0xd6, 0x2d, 0xca, 0x2a, 0xf6, 0xcc, 0xb3, 0xf5, 0x2a, 0x2b, 0x34, 0xc8, 0x18, 0x6b,
+  0x61, 0x70, 0x5c, 0x34, 0x0f, 0x11, 0x87, 0xfe, 0x7e, 0x64, 0x3d, 0x1f, 0x5c, 0x2b, 0x0b, 0x6c,
+  0xfd, 0x82, 0x1a, 0xab, 0x1b, 0x25, 0x72, 0x82, 0x63, 0x17, 0xd7, 0x96, 0x5c, 0xcd, 0x43, 0xc7,
+  0xae, 0x99, 0x39, 0xab, 0x60, 0xc3, 0xe4, 0x59, 0x03, 0x36, 0x9a, 0x94, 0xaa, 0x11, 0x93, 0x31,
+  0x28, 0xd3, 0x9d, 0xe3, 0xc7, 0x62, 0x34, 0x2a, 0xdc, 0x26, 0x15, 0x05, 0x3b, 0x0b, 0x2f, 0xc6,
+  0x43, 0x79, 0x34, 0x94, 0x8c, 0x96, 0xd9, 0x02, 0x69, 0x89, 0x7c, 0xb0, 0x4f, 0xa1, 0x5d, 0x68,
+  0xd3, 0x30, 0x54, 0xdf, 0x07, 0x04, 0xdc, 0x73, 0xb1, 0x0f, 0x9d, 0x6f, 0x6f, 0x11, 0x14, 0x35,
+  0x2b, 0x68, 0x3a, 0xd8, 0x33, 0x5c, 0xd7, 0x2d, 0x9a, 0x65, 0x00, 0x35, 0xeb, 0x64, 0x81, 0x78,
+  0x9d, 0x8a, 0x16, 0x13, 0xf6, 0x8c, 0xac, 0x1c, 0x55, 0x53, 0xcc, 0x0d, 0x41, 0x45, 0x9c, 0x94,
+  0x15, 0xb7, 0xd2, 0x62, 0x96, 0x36, 0xae, 0x5e, 0x3d, 0x83, 0xcc, 0x43, 0xfb, 0xad, 0x4c, 0x31,
+  0x2b, 0x32, 0xb7, 0x56, 0xfd, 0x2a, 0x8c, 0x90, 0x13, 0x01, 0xef, 0xa3, 0xf8, 0xc0, 0x30, 0xe0,
+  0xce, 0xb0, 0x9b, 0x39, 0xfb, 0xd5, 0x32, 0xf7, 0xb9, 0x42, 0x84, 0x1b, 0x0d, 0x32, 0x15, 0x0f,
+  0x7e, 0xb7, 0xcd, 0xf8, 0x7c, 0x89, 0x87, 0x94, 0x51, 0x38, 0x9a, 0xa0, 0x01, 0x66, 0xb4, 0xa8,
+  0x5d, 0x15, 0xe0, 0x41, 0x2e, 0x14, 0x03, 0x9a, 0x64, 0x80, 0x13, 0xc2, 0xa4, 0x12, 0x34, 0x36,
+  0xbc, 0xa4, 0x4e, 0x66, 0xca, 0xdd, 0x60, 0xce, 0xf5, 0x24, 0xc9, 0x04, 0xb4, 0x3b, 0xb8, 0xba,
+  0xb9, 0xbb, 0xbe, 0xba, 0xb8, 0x3a, 0x3d, 0x3e, 0xbb, 0x85, 0xa4, 0x99, 0x86, 0xa3, 0xe7, 0x5e,
+  0xf5, 0xd0, 0x89, 0xbd, 0x91, 0x11, 0x5e, 0xaf, 0x3c, 0x66, 0xf6, 0xad, 0xae, 0x90, 0x85, 0xfa,
+  0xc3, 0x31, 0x5c, 0x63, 0xc6, 0xb0, 0xf1, 0x23, 0x49, 0xce, 0x62, 0x0c, 0x4d, 0x63, 0xb3, 0x8a,
+  0x14, 0xfe, 0x4e, 0xe3, 0x6c, 0x42, 0x47, 0xad, 0xf2, 0x5b, 0x35, 0x82, 0x0a, 0xbd, 0x7a, 0x13,
+  0x5f, 0x3c, 0x40, 0x8d, 0x7a, 0xc9, 0x2e, 0x2b, 0x8b, 0x7e, 0xb4, 0x51, 0xad, 0xaa, 0x5f, 0xb1,
+  0x4f, 0x7c, 0x5e, 0x7e, 0x7f, 0xb1, 0x62, 0x97, 0x95, 0x9d, 0xe0, 0xd8, 0xc7, 0xe3, 0xf0, 0x64,
+  0x5c, 0x6b, 0x4e, 0x2e, 0x0f, 0xa0, 0xb2, 0x4e, 0xa1, 0xe8, 0xd4, 0x67, 0x74, 0x44, 0x5d, 0xd8,
+  0x44, 0x2d, 0x52, 0xa0, 0x56, 0x40, 0x6d, 0x38, 0x74, 0x67, 0x03, 0x66, 0x1b, 0x83, 0x77, 0x06,
+  0x71, 0x0b, 0xc3, 0x77, 0x26, 0x08, 0xd6, 0x9c, 0x9b, 0xf3, 0x58, 0xa6, 0x8a, 0x69, 0x31, 0x1e,
+  0x43, 0x71, 0x93, 0xe0, 0xce, 0xf7, 0x17, 0xe8, 0x96, 0x37, 0x6f, 0x47, 0xa3, 0x5a, 0xa3, 0x67,
+  0x4d, 0x77, 0xfa, 0x71, 0xea, 0xd4, 0xf2, 0x5a, 0xed, 0x89, 0x3d, 0x75, 0x65, 0x96, 0x4d, 0x3f,
+  0x45, 0xa0, 0xf9, 0x68, 0xcb, 0xf9, 0x99, 0xce, 0xa2, 0xab, 0xc1, 0x54, 0xea, 0x96, 0x5c, 0x99,
+  0xa5, 0x2e, 0x5f, 0x8c, 0x6c, 0x41, 0x4e, 0x27, 0xa0, 0xa5, 0xa2, 0xa1, 0xb8, 0xf0, 0xc3, 0xab,
+  0x9b, 0x19, 0x66, 0x01, 0x94, 0xcf, 0x16, 0x64, 0xe6, 0x3e, 0xf2, 0x4e, 0xa6, 0xbd, 0x66, 0xf4,
+  0x62, 0x2d, 0xe9, 0x36, 0x48, 0xb7, 0x37, 0x96, 0xee, 0x58, 0xce, 0x0f, 0x9d, 0x8d, 0xa5, 0xbb,
+  0x20, 0x7d, 0x50, 0x4f, 0xda, 0x5c, 0x80, 0x19, 0x6a, 0x5e, 0x16, 0x28, 0xd5, 0x43, 0xcf, 0xff,
+  0x7a, 0xc2, 0xcb, 0x64, 0x67, 0xbd, 0xa9, 0xa8, 0x7b, 0x70, 0x63, 0xe6, 0xa2, 0xc6, 0xfe, 0xbb,
+  0xbd, 0x35, 0x8b, 0x4a, 0xd9, 0xa4, 0x84, 0x96, 0x9b, 0xbc, 0x30, 0xf3, 0x56, 0x0c, 0x54, 0x5b,
+  0xa1, 0xb2, 0xc0, 0xb0, 0x3a, 0x13, 0xd7, 0x66, 0x55, 0xae, 0xf6, 0xec, 0xb5, 0xd1, 0x69, 0xb9,
+  0xfa, 0x4a, 0xb7, 0xfa, 0x1a, 0xf7, 0x56, 0xb9, 0x94, 0xc5, 0x97, 0xae, 0xd7, 0xc2, 0x7c, 0xfb,
+  0xb2, 0xe2, 0x3a, 0x57, 0x18, 0x01, 0x56, 0xe7, 0x3e, 0xb7, 0x00, 0xba, 0xe2, 0x3e, 0x7b, 0xc3,
+  0xab, 0x5c, 0x50, 0xe7, 0x85, 0x57, 0xb9, 0x06, 0x61, 0xf5, 0x55, 0xee, 0xc2, 0x18, 0x54, 0xfb,
+  0x2e, 0x37, 0x04, 0xde, 0xf0, 0x2e, 0xb7, 0x7a, 0xc2, 0x4e, 0x29, 0x53, 0x3e, 0x47, 0xd7, 0x9a,
+  0x99, 0xd3, 0x48, 0xbb, 0x77, 0xd7, 0xd7, 0xe8, 0x78, 0x6f, 0x05, 0xe9, 0xc9, 0xfc, 0x14, 0x16,
+  0x4c, 0xdb, 0xd8, 0x08, 0xe6, 0xa1, 0xf4, 0x5d, 0x4c, 0x08, 0x6f, 0x5e, 0x18, 0x12, 0xa0, 0x7f,
+  0x0c, 0xcc, 0x52, 0x17, 0xe2, 0x04, 0x9a, 0x3b, 0xcc, 0xd5, 0xa9, 0x98, 0xdb, 0x1a, 0x0d, 0x9d,
+  0xad, 0xd1, 0xd0, 0x89, 0x68, 0x38, 0xd9, 0x5b, 0xf3, 0x00, 0xb1, 0x19, 0x3b, 0xed, 0x17, 0xb1,
+  0xb3, 0xde, 0x6d, 0xd5, 0xd2, 0xc6, 0xee, 0xd6, 0xd8, 0xea, 0xa2, 0xdd, 0xb3, 0xb3, 0xc1, 0xf7,
+  0xe1, 0xaa, 0xf3, 0x5d, 0x22, 0x69, 0x7f, 0x6b, 0xdc, 0xec, 0xa3, 0xdd, 0xd3, 0x40, 0x69, 0x31,
+  0xfd, 0x3e, 0xf4, 0x74, 0xb7, 0x16, 0x4a, 0xab, 0x7b, 0x47, 0xd2, 0x9c, 0xcf, 0x28, 0x1e, 0xf3,
+  0xa7, 0xaf, 0x4a, 0x53, 0x57, 0xa0, 0x39, 0x14, 0xf9, 0x71, 0x79, 0xef, 0x48, 0xcc, 0x71, 0x31,
+  0xe7, 0x30, 0x8b, 0xc6, 0xd4, 0x15, 0x77, 0x8e, 0x0c, 0xae, 0x39, 0x83, 0x9f, 0x04, 0x65, 0xad,
+  0x23, 0x55, 0x6f, 0x0d, 0xb4, 0x4d, 0x3b, 0x6e, 0x32, 0x97, 0xc0, 0x47, 0x62, 0x2e, 0xf4, 0x03,
+  0x85, 0xae, 0x3a, 0xa7, 0x15, 0x14, 0x2c, 0xbe, 0x4e, 0x35, 0x00, 0xd0, 0xad, 0x02, 0xa6, 0x4b,
+  0x5b, 0x8f, 0xef, 0x5c, 0xc3, 0x19, 0x2e, 0x5a, 0x14, 0x1e, 0xe7, 0x8c, 0x7a, 0x24, 0xdc, 0x4b,
+  0x20, 0xec, 0x63, 0x69, 0x26, 0xa1, 0xa7, 0xbf, 0x38, 0xc2, 0xf7, 0xc1, 0xd3, 0xdf, 0x8d, 0x46,
+  0xa3, 0xf0, 0x38, 0xb9, 0xe9, 0x97, 0xb0, 0x39, 0x32, 0x99, 0x18, 0x57, 0x13, 0xf9, 0x9e, 0x8c,
+  0xa9, 0x39, 0x1a, 0x1b, 0x67, 0x9d, 0xcf, 0xcc, 0x9f, 0x00, 0xa8, 0x15, 0x5f, 0x29, 0x83, 0x65,
+  0xbe, 0xe0, 0x8a, 0xd8, 0x80, 0x6d, 0x39, 0xf5, 0xf4, 0xec, 0x35, 0x97, 0x5f, 0x75, 0xa7, 0x24,
+  0x7a, 0xca, 0x95, 0xd4, 0xd7, 0x48, 0x49, 0xd7, 0x70, 0x6b, 0x7e, 0x6f, 0x7c, 0x52, 0x06, 0x34,
+  0xfa, 0x60, 0x6e, 0x93, 0xa2, 0xbf, 0xb6, 0x00, 0x9d, 0xc2, 0xbf, 0x37, 0xd9, 0xf9, 0x0f, 0xc3,
+  0x06, 0xba, 0x3b, 0x82, 0x22, 0x00, 0x00,
+};
+
+// script.js: 19277 bytes sin comprimir
+static const uint8_t ui_script_js[] PROGMEM = {
+  0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xd5, 0x1c, 0xcb, 0x72, 0x1b, 0xc7,
+  0xf1, 0xce, 0xaf, 0x18, 0xa3, 0x14, 0x03, 0xb0, 0x04, 0x10, 0x24, 0xa5, 0x94, 0x43, 0x90, 0x72,
+  0x81, 0x24, 0x28, 0x42, 0x45, 0x82, 0x2c, 0x82, 0x62, 0xec, 0x28, 0x2e, 0x72, 0x89, 0x1d, 0x80,
+  0x2b, 0x2d, 0x76, 0xe1, 0x7d, 0xf0, 0x25, 0xe3, 0x98, 0x4b, 0xca, 0xa9, 0x1c, 0xe4, 0x53, 0x2a,
+  0x89, 0xe3, 0x53, 0x92, 0xb3, 0x2f, 0xb9, 0xeb, 0x4f, 0xfc, 0x03, 0xf1, 0x27, 0xa4, 0x7b, 0x66,
+  0x76, 0x77, 0x66, 0x76, 0x17, 0x58, 0xf0, 0xe1, 0x72, 0x74, 0x48, 0x88, 0x9d, 0x9e, 0x9e, 0x9e,
+  0x7e, 0x77, 0xcf, 0x8c, 0x17, 0x3f, 0x59, 0x58, 0xbf, 0xf7, 0x7f, 0x0b, 0x04, 0xfe, 0xf5, 0x36,
+  0x0f, 0x3b, 0x07, 0x47, 0xf5, 0x97, 0x3d, 0x52, 0x23, 0x1d, 0xc7, 0x0f, 0xbc, 0x70, 0x44, 0x9d,
+  0xc0, 0x25, 0xc7, 0x96, 0x17, 0x84, 0x86, 0x4d, 0xda, 0xbd, 0x83, 0x95, 0x65, 0x18, 0x3b, 0xa6,
+  0x9e, 0x6f, 0x7d, 0xf8, 0xc1, 0x21, 0x7d, 0xd7, 0x21, 0x07, 0x86, 0xef, 0xfa, 0xa4, 0xb5, 0xb5,
+  0xfd, 0x74, 0xe5, 0xd9, 0x12, 0xb9, 0x86, 0xbf, 0x7e, 0xf3, 0xe9, 0xb3, 0xc6, 0x43, 0x90, 0xf8,
+  0xc9, 0xe2, 0xc2, 0xc2, 0xe2, 0x22, 0xb9, 0x03, 0x06, 0x98, 0x7d, 0xdc, 0x3a, 0xec, 0xb4, 0x36,
+  0x76, 0xdb, 0x3d, 0xf2, 0x62, 0x77, 0x7f, 0xa3, 0x85, 0x7f, 0x7c, 0x41, 0xda, 0xbb, 0xed, 0xbd,
+  0x76, 0xf7, 0x68, 0xbf, 0x47, 0xb6, 0xda, 0xbb, 0x64, 0x6b, 0x7f, 0xef, 0x8e, 0xeb, 0xd8, 0x34,
+  0x20, 0x97, 0xf4, 0xcc, 0x77, 0xfb, 0x6f, 0xe1, 0xaf, 0x75, 0xe2, 0x84, 0xb6, 0xdd, 0x64, 0x5f,
+  0x2d, 0x7f, 0xd3, 0x75, 0x1c, 0xda, 0x0f, 0xa8, 0x09, 0xdf, 0x07, 0x86, 0xed, 0x53, 0x3e, 0xd0,
+  0x0f, 0x3d, 0x0f, 0x98, 0x7d, 0x3c, 0x70, 0xf7, 0x5c, 0x93, 0xc2, 0x58, 0xf9, 0xf0, 0xf3, 0x72,
+  0x93, 0x6d, 0x98, 0x73, 0x78, 0xec, 0x51, 0x93, 0x0e, 0x2c, 0xc7, 0x32, 0xf1, 0x87, 0xe1, 0x19,
+  0x31, 0xcf, 0x2b, 0xd4, 0x21, 0x3b, 0x37, 0xd5, 0x05, 0x90, 0x86, 0x1f, 0x44, 0x5f, 0x4f, 0x7a,
+  0x47, 0xed, 0x83, 0x1e, 0xe0, 0x79, 0xcd, 0x44, 0xbb, 0xd4, 0x78, 0x42, 0xc4, 0x3f, 0xc0, 0xb8,
+  0xd4, 0x80, 0x09, 0xe2, 0x7b, 0x3c, 0xc0, 0xbe, 0xe3, 0x00, 0x21, 0xd1, 0x50, 0x34, 0x86, 0x43,
+  0xe4, 0x6d, 0x32, 0x25, 0x1a, 0xe0, 0xa8, 0x94, 0x01, 0x3e, 0x22, 0x70, 0xa9, 0x23, 0x6c, 0x88,
+  0xa1, 0xda, 0x53, 0xbf, 0x37, 0x62, 0x54, 0x38, 0xf0, 0xa5, 0xc2, 0x90, 0x96, 0x39, 0xc0, 0xed,
+  0xf4, 0x02, 0x3a, 0xee, 0x38, 0x26, 0xbd, 0x82, 0x1d, 0x2d, 0x37, 0x11, 0xba, 0x3d, 0x1a, 0xd3,
+  0x1b, 0xc3, 0x23, 0xb0, 0x79, 0x4e, 0xdb, 0x74, 0x56, 0xa1, 0x52, 0xa6, 0x38, 0x85, 0x1f, 0x75,
+  0x46, 0xc5, 0x7c, 0xe2, 0xa4, 0xc6, 0x94, 0xfe, 0x02, 0xf8, 0x47, 0x64, 0xfe, 0xe9, 0x6c, 0xc2,
+  0xbd, 0xc8, 0x5c, 0x5a, 0xc9, 0xe7, 0x52, 0xad, 0x56, 0x23, 0xbb, 0x1f, 0x7e, 0x18, 0x5a, 0x7d,
+  0x83, 0x80, 0xae, 0x75, 0x8d, 0x0b, 0x3a, 0x34, 0xfa, 0x68, 0xd1, 0xab, 0xe4, 0x05, 0x75, 0xa8,
+  0x67, 0x98, 0xae, 0x47, 0x7d, 0x84, 0x13, 0xac, 0x1a, 0xb2, 0xaf, 0x81, 0xeb, 0xf5, 0x40, 0x75,
+  0x2d, 0xb0, 0xfa, 0x75, 0x62, 0xba, 0x7d, 0xe6, 0x1e, 0xea, 0x43, 0x1a, 0xb4, 0x6d, 0x8a, 0x7f,
+  0x6e, 0x5c, 0x77, 0xcc, 0x4a, 0x39, 0x86, 0xf5, 0x6b, 0x3e, 0x87, 0x2e, 0x57, 0x9b, 0x3a, 0x1e,
+  0x50, 0xf2, 0xd0, 0x86, 0x25, 0xd6, 0x53, 0xa8, 0xeb, 0x5f, 0x85, 0xd4, 0xbb, 0xee, 0x51, 0x1b,
+  0x7e, 0xba, 0x5e, 0xcb, 0xb6, 0x2b, 0xe5, 0xba, 0x15, 0x3b, 0xa3, 0xda, 0x88, 0x4d, 0x54, 0x30,
+  0x76, 0x8d, 0x11, 0xdd, 0xb2, 0xfc, 0xb1, 0x6d, 0x5c, 0xcf, 0xa0, 0xab, 0xe6, 0x00, 0x68, 0xcd,
+  0xe4, 0xb0, 0x0a, 0x8e, 0x03, 0x8f, 0x5e, 0x6c, 0x04, 0xb3, 0xf6, 0x55, 0x03, 0xcd, 0xba, 0xa8,
+  0x9d, 0x05, 0xea, 0x8e, 0xba, 0xf4, 0x2a, 0x28, 0x30, 0xd7, 0x01, 0xb0, 0x68, 0xae, 0x24, 0xb9,
+  0x17, 0xd1, 0xfe, 0x23, 0xc1, 0x35, 0x9a, 0x33, 0x85, 0xb4, 0xef, 0xf7, 0x2d, 0x3b, 0x25, 0x24,
+  0x17, 0xbf, 0xda, 0x05, 0xa5, 0x94, 0x00, 0x67, 0x88, 0x29, 0x19, 0x4c, 0xe4, 0x94, 0xc2, 0x3e,
+  0xa7, 0xa0, 0x60, 0x7e, 0x41, 0x41, 0x01, 0x64, 0x8e, 0xa0, 0x60, 0xa4, 0x80, 0xa0, 0x70, 0x7e,
+  0x5a, 0x50, 0xb8, 0xfe, 0x6c, 0x41, 0xb1, 0xb5, 0xb3, 0x05, 0xb5, 0x1f, 0x33, 0x20, 0x43, 0x52,
+  0x1d, 0x27, 0xa0, 0xde, 0xc0, 0xb8, 0x11, 0xf6, 0x63, 0x43, 0x20, 0xdc, 0xfb, 0xf0, 0x03, 0x70,
+  0xc0, 0x95, 0x25, 0xd4, 0xe7, 0xbe, 0x7f, 0x06, 0x0d, 0x02, 0x4a, 0x90, 0x40, 0xc4, 0x5c, 0x3f,
+  0x30, 0x82, 0xd0, 0xdf, 0x00, 0x5b, 0x9e, 0x32, 0x95, 0x03, 0xd5, 0xce, 0x0c, 0x4f, 0x9a, 0x09,
+  0x5a, 0x32, 0x86, 0x3f, 0xe8, 0xae, 0x3b, 0x9c, 0x36, 0x37, 0x02, 0xab, 0xd9, 0xee, 0x50, 0x9a,
+  0x0d, 0x5f, 0x57, 0x96, 0x3b, 0xe0, 0x56, 0xc6, 0x61, 0x30, 0x6d, 0x3a, 0x83, 0xab, 0x59, 0x63,
+  0x99, 0xe4, 0xbe, 0xe1, 0xcc, 0xd8, 0x2b, 0x82, 0xd4, 0xac, 0xe5, 0xbe, 0xbe, 0x59, 0xf8, 0x7c,
+  0x48, 0xfd, 0xd0, 0x0e, 0xfc, 0x2d, 0xeb, 0x62, 0x26, 0x02, 0x8f, 0x83, 0x32, 0x04, 0x28, 0x11,
+  0x01, 0x01, 0xbc, 0x3f, 0xde, 0xde, 0x17, 0x28, 0x2f, 0x06, 0xee, 0xb6, 0x47, 0xbf, 0x2a, 0xa0,
+  0x7f, 0x00, 0x59, 0x1b, 0x00, 0xa8, 0x44, 0x0f, 0x7c, 0xda, 0x30, 0x1c, 0xb3, 0xe0, 0xe4, 0x33,
+  0x00, 0x55, 0x27, 0xa3, 0x63, 0x2e, 0x38, 0xd9, 0x07, 0x50, 0x75, 0x32, 0x26, 0x04, 0x05, 0x27,
+  0x83, 0xd1, 0x51, 0x75, 0xf2, 0xe1, 0xd5, 0xd1, 0xd5, 0x0c, 0x19, 0xe0, 0x44, 0xef, 0x2a, 0xb8,
+  0x8a, 0x65, 0xa0, 0xb2, 0x30, 0x8a, 0x9d, 0x46, 0x1f, 0x93, 0x40, 0xeb, 0x06, 0xfc, 0x8e, 0x1f,
+  0x85, 0x50, 0x83, 0x85, 0x9d, 0x82, 0x7c, 0xe5, 0xc0, 0x8c, 0xb5, 0x92, 0x69, 0x13, 0x05, 0x55,
+  0x41, 0x46, 0x09, 0x54, 0xc8, 0xab, 0xb4, 0x97, 0x88, 0x30, 0xa1, 0x29, 0xcc, 0x83, 0x8b, 0x99,
+  0x4e, 0x1e, 0x61, 0xb8, 0xc7, 0x99, 0x36, 0x20, 0xef, 0xd0, 0x42, 0xe0, 0xf4, 0xfe, 0x68, 0x80,
+  0x98, 0x66, 0x48, 0x24, 0x22, 0x89, 0x06, 0x1c, 0x97, 0x6a, 0x1c, 0x7c, 0xb4, 0xed, 0x18, 0x67,
+  0x36, 0x2d, 0x86, 0x88, 0x32, 0xd8, 0x4c, 0x34, 0xc0, 0xa0, 0xe2, 0x78, 0x4c, 0x0e, 0x9c, 0x89,
+  0x08, 0xb7, 0xf5, 0x6a, 0x5c, 0x0c, 0x0f, 0xdb, 0x54, 0x38, 0x56, 0x1d, 0xb4, 0xa4, 0x4b, 0xee,
+  0xa5, 0x33, 0x07, 0x22, 0x13, 0xc0, 0xb3, 0x50, 0xa1, 0x2e, 0x15, 0x64, 0x34, 0xea, 0x91, 0xc0,
+  0xa0, 0x2b, 0x3f, 0xcb, 0xa6, 0x63, 0xbc, 0x2c, 0x19, 0x2d, 0xac, 0xef, 0x0c, 0x3a, 0x5f, 0xe1,
+  0xd9, 0xf0, 0x81, 0x7b, 0x49, 0xbd, 0x39, 0xb0, 0x8d, 0x11, 0x3e, 0x1f, 0x5d, 0x61, 0x03, 0xe2,
+  0xd8, 0xf2, 0x2c, 0x48, 0xe0, 0x2a, 0x6c, 0x42, 0x11, 0xb6, 0x5c, 0x1b, 0x8a, 0x19, 0x57, 0xc0,
+  0x88, 0x24, 0xb6, 0xa5, 0xad, 0x88, 0x53, 0x56, 0xd0, 0x8c, 0x04, 0x59, 0x79, 0x76, 0x94, 0x08,
+  0x80, 0xa7, 0x31, 0xc5, 0xf9, 0xef, 0x33, 0xf8, 0x34, 0xb2, 0x82, 0x56, 0xc9, 0x51, 0xe5, 0x98,
+  0x25, 0x1b, 0x2c, 0x6a, 0x97, 0x1c, 0x93, 0x6a, 0x98, 0x69, 0xa6, 0x17, 0x30, 0x4c, 0x89, 0xe9,
+  0x69, 0xcb, 0x4c, 0xd4, 0xbe, 0x88, 0x69, 0xca, 0x6a, 0x9f, 0x61, 0x9b, 0xb1, 0x9e, 0x16, 0x15,
+  0x9f, 0x66, 0x9d, 0x77, 0x6b, 0x00, 0xec, 0x7e, 0x78, 0xff, 0xa2, 0xb3, 0xd9, 0x82, 0x4a, 0x9f,
+  0x6c, 0xee, 0x77, 0xdb, 0x9f, 0x77, 0x3e, 0xbc, 0xef, 0x92, 0x2f, 0x08, 0xd4, 0xff, 0xbd, 0xd6,
+  0xcb, 0xf6, 0xe1, 0x87, 0x3f, 0xb5, 0xee, 0xb8, 0xc6, 0x20, 0x74, 0x78, 0xf6, 0x0d, 0xfb, 0x05,
+  0x1d, 0x31, 0xbc, 0x4a, 0x95, 0xbc, 0xe3, 0x25, 0x21, 0xe7, 0x80, 0x35, 0x86, 0x5d, 0xcb, 0x69,
+  0x55, 0xfd, 0xc2, 0xb0, 0x43, 0x5a, 0x0f, 0x3c, 0x6b, 0x04, 0xb0, 0x5f, 0x7f, 0x4d, 0x2e, 0x2d,
+  0x07, 0x18, 0x57, 0xb7, 0xdd, 0xbe, 0xc1, 0x32, 0xed, 0x73, 0xd7, 0x0f, 0x30, 0x23, 0x6e, 0x72,
+  0x34, 0xd6, 0x80, 0x54, 0x3e, 0xb2, 0xc6, 0x31, 0x5a, 0xfc, 0x67, 0x8c, 0xc7, 0xd4, 0x31, 0x21,
+  0xc5, 0xab, 0x94, 0x7e, 0xfc, 0xcb, 0x3f, 0xfe, 0xfb, 0x9f, 0x3f, 0x93, 0x03, 0xd7, 0x23, 0x03,
+  0xe3, 0xc2, 0xf5, 0x9e, 0x10, 0xcb, 0x19, 0x42, 0x8a, 0x64, 0x90, 0xd0, 0x81, 0x5a, 0xc2, 0xf2,
+  0x68, 0x9f, 0xd5, 0x11, 0xa4, 0x73, 0x50, 0x2f, 0x55, 0x9b, 0x09, 0x0e, 0x8f, 0x06, 0xa1, 0xe7,
+  0x88, 0x0f, 0x13, 0x99, 0xe4, 0xd0, 0xb3, 0x81, 0xe6, 0xd3, 0x4b, 0x7f, 0x75, 0x71, 0xf1, 0xd1,
+  0x3b, 0x6b, 0x3c, 0x59, 0xfd, 0x74, 0x69, 0xf1, 0x54, 0x40, 0x26, 0x4b, 0x9f, 0x62, 0x1a, 0xec,
+  0x04, 0x90, 0xfe, 0xb8, 0xf1, 0xee, 0x89, 0x41, 0x1e, 0xbd, 0x83, 0xf9, 0x93, 0x7a, 0xbd, 0x7e,
+  0x1a, 0xad, 0xa6, 0x34, 0x47, 0xe8, 0x25, 0xf9, 0x2d, 0x3d, 0xeb, 0xb1, 0xdf, 0x15, 0x80, 0x4c,
+  0x01, 0xd5, 0x5d, 0xc7, 0x85, 0x25, 0x00, 0x16, 0xd8, 0xb3, 0xfe, 0x5c, 0xde, 0xb6, 0xda, 0x4f,
+  0x81, 0xda, 0x83, 0x4a, 0xfb, 0x09, 0xc7, 0xa6, 0x11, 0x50, 0x01, 0x00, 0x7c, 0xe4, 0xfe, 0xac,
+  0x22, 0x6f, 0x59, 0x66, 0xdb, 0x5f, 0xff, 0x40, 0x36, 0x39, 0xd1, 0x40, 0x7e, 0xd4, 0xee, 0x4a,
+  0x38, 0x34, 0xc9, 0x20, 0x6b, 0x44, 0x7d, 0xdf, 0x18, 0x62, 0xbb, 0xa6, 0x42, 0x2f, 0x60, 0xe7,
+  0x3a, 0x79, 0x63, 0xcf, 0xed, 0x03, 0xe3, 0xbd, 0x3d, 0xea, 0xf8, 0xc6, 0x1b, 0xca, 0x81, 0xea,
+  0x40, 0x95, 0x31, 0x0d, 0x2b, 0xf5, 0x3c, 0xd7, 0x63, 0x38, 0xf1, 0x0f, 0x1d, 0xa7, 0xc4, 0xee,
+  0x1f, 0xff, 0xf6, 0x0d, 0x69, 0x33, 0x60, 0xe0, 0x8e, 0x6d, 0x30, 0x9e, 0x5f, 0xf1, 0x12, 0xf1,
+  0xd1, 0x3b, 0x36, 0xb9, 0x1e, 0x51, 0x08, 0x5a, 0x55, 0xe6, 0xa0, 0x26, 0xf5, 0x01, 0xce, 0xed,
+  0x5b, 0xa6, 0x5b, 0x9e, 0x9c, 0x4e, 0xa3, 0xa3, 0x0f, 0xd5, 0x0b, 0x9d, 0xcd, 0x75, 0xde, 0xc5,
+  0xba, 0x2d, 0xdb, 0x7f, 0xfa, 0xee, 0xdb, 0x6f, 0xc8, 0x16, 0xa3, 0x49, 0xb0, 0xde, 0xa4, 0x82,
+  0xf7, 0x0a, 0xeb, 0x27, 0x0b, 0x89, 0x65, 0x99, 0x31, 0xb8, 0x64, 0x5c, 0x68, 0x15, 0x31, 0xf5,
+  0x55, 0x69, 0x23, 0x6c, 0x1b, 0x6c, 0x79, 0x19, 0x87, 0x2e, 0x1a, 0x26, 0x94, 0x08, 0x97, 0xc4,
+  0xe3, 0x9f, 0xbe, 0x7b, 0xff, 0x2f, 0x72, 0x48, 0xfb, 0xd6, 0x19, 0x30, 0x0c, 0xf9, 0x8a, 0x80,
+  0x09, 0xdf, 0x02, 0xef, 0x5a, 0xe6, 0x0c, 0x37, 0x97, 0x91, 0x8f, 0x95, 0xd6, 0xcb, 0xde, 0x7e,
+  0xb7, 0x3e, 0x36, 0x3c, 0x5f, 0x20, 0x97, 0xf6, 0xef, 0x5f, 0x5a, 0x41, 0xff, 0x9c, 0x54, 0x00,
+  0xb0, 0x6e, 0x80, 0x35, 0xba, 0x8e, 0x62, 0xcc, 0x0c, 0x93, 0x01, 0xbc, 0x2f, 0x61, 0x51, 0x16,
+  0x52, 0x88, 0xab, 0x27, 0x14, 0x2b, 0x1d, 0xea, 0x95, 0x56, 0x55, 0x30, 0x46, 0x6d, 0x94, 0x99,
+  0x7b, 0x07, 0x06, 0x58, 0x1f, 0x14, 0xa9, 0x6d, 0x0e, 0x8c, 0xf8, 0xe5, 0x65, 0xa3, 0x7f, 0x67,
+  0x1e, 0x35, 0xde, 0x36, 0xa7, 0xaf, 0x07, 0x55, 0x41, 0xb1, 0xb5, 0xa0, 0xc4, 0x62, 0xfb, 0x80,
+  0x3d, 0x42, 0x61, 0x70, 0xcb, 0xd5, 0x78, 0x22, 0x56, 0x6c, 0x41, 0x5e, 0x90, 0xdc, 0xc7, 0x9a,
+  0x2c, 0xbe, 0x14, 0x5d, 0x94, 0x25, 0x82, 0x77, 0x5f, 0xd5, 0xf5, 0xfb, 0x27, 0x3c, 0x7b, 0xc8,
+  0x5c, 0x58, 0x32, 0x6e, 0xee, 0x8f, 0x06, 0x96, 0x37, 0x8a, 0xfa, 0x3e, 0x3d, 0xae, 0x36, 0x87,
+  0xdb, 0x48, 0xa0, 0x75, 0x81, 0xc6, 0xc2, 0xda, 0x9b, 0x71, 0x3f, 0x08, 0xd4, 0x13, 0x09, 0xe4,
+  0xf8, 0xa9, 0x79, 0x62, 0x99, 0x93, 0xc4, 0xe9, 0x4e, 0xa3, 0x74, 0x22, 0x19, 0xf7, 0x80, 0xeb,
+  0x25, 0x4f, 0xe6, 0x30, 0x12, 0x92, 0x12, 0xf3, 0x25, 0xa5, 0x94, 0x8e, 0x66, 0xba, 0x22, 0x30,
+  0x4e, 0x93, 0x72, 0x03, 0x5e, 0x15, 0xf4, 0x8c, 0xb8, 0x8d, 0x4d, 0x14, 0x52, 0x26, 0x51, 0x9c,
+  0x81, 0x20, 0x87, 0xb6, 0x40, 0x67, 0xc4, 0x33, 0x61, 0xa8, 0x10, 0xa5, 0xb8, 0x2d, 0x12, 0xc7,
+  0x85, 0x28, 0xca, 0xac, 0x6c, 0x95, 0x94, 0xc8, 0x63, 0xa2, 0x1b, 0x19, 0xda, 0xa2, 0x6b, 0xd3,
+  0x3a, 0x23, 0xbe, 0x52, 0xe2, 0xd4, 0x81, 0x5f, 0x8f, 0x2c, 0x9f, 0x4f, 0x2d, 0x3d, 0x21, 0xb4,
+  0x9a, 0xc4, 0x3c, 0xd9, 0x45, 0x50, 0xe7, 0xc2, 0x32, 0xbc, 0x4d, 0x77, 0x84, 0x01, 0x4d, 0x75,
+  0x10, 0x8a, 0xb3, 0x21, 0x1f, 0x7f, 0x2c, 0xb9, 0x1b, 0xe0, 0xac, 0x79, 0x8d, 0x3e, 0x8f, 0x32,
+  0xde, 0xc5, 0xa1, 0xad, 0xbe, 0x7f, 0xd0, 0xee, 0x56, 0xd3, 0xce, 0xe2, 0x8d, 0x8f, 0x2e, 0xd2,
+  0x83, 0x18, 0x1d, 0xf9, 0x0c, 0x9f, 0xfd, 0xb2, 0x06, 0xd7, 0x29, 0xbf, 0x91, 0xac, 0xe2, 0x03,
+  0x77, 0x2a, 0xc9, 0xd4, 0x6c, 0xe7, 0x7a, 0xfa, 0xe3, 0xdf, 0xbf, 0x47, 0xd6, 0xb5, 0x71, 0x23,
+  0xdc, 0x7b, 0x25, 0x53, 0x24, 0xdf, 0x4f, 0x28, 0x78, 0xf0, 0xe9, 0xdc, 0xef, 0xc6, 0x11, 0xdd,
+  0x74, 0xeb, 0xf8, 0x0b, 0x26, 0x8c, 0x43, 0x90, 0x02, 0x67, 0x12, 0x60, 0x80, 0x71, 0xc6, 0x28,
+  0x29, 0x62, 0x32, 0x76, 0xde, 0x67, 0xc6, 0xd6, 0x6d, 0x1d, 0xb7, 0x5f, 0xb4, 0x36, 0x45, 0xce,
+  0xf6, 0xaa, 0x73, 0x5f, 0xa9, 0x5a, 0x5e, 0xc8, 0x8a, 0x78, 0x12, 0x37, 0xdf, 0xea, 0x01, 0xbd,
+  0x0a, 0x00, 0x0e, 0xd3, 0x1c, 0x10, 0x97, 0x1c, 0x08, 0x3f, 0x23, 0xa5, 0x38, 0x7d, 0x28, 0x11,
+  0x50, 0x49, 0x39, 0xa8, 0x95, 0x9a, 0x3a, 0xa2, 0xbe, 0x6d, 0xf8, 0x3e, 0x76, 0x44, 0xd3, 0x68,
+  0x44, 0x19, 0xd5, 0x8f, 0xbe, 0x31, 0x6c, 0x49, 0x6d, 0x95, 0x7c, 0x6f, 0xc6, 0x39, 0x9a, 0x68,
+  0x2b, 0x4e, 0x27, 0x2f, 0x21, 0xc8, 0x63, 0x28, 0x37, 0xa3, 0x1f, 0x5a, 0x68, 0x4c, 0xa4, 0x8f,
+  0xf1, 0x23, 0xe2, 0x81, 0xd4, 0x46, 0x54, 0x96, 0x79, 0xbc, 0xce, 0xe2, 0xdd, 0x63, 0x52, 0xfa,
+  0xbd, 0x13, 0x51, 0x24, 0xc3, 0xfa, 0x7d, 0xcf, 0xb5, 0xed, 0x23, 0x17, 0xb3, 0xde, 0xf4, 0xf7,
+  0x1d, 0x6a, 0x0d, 0xcf, 0x03, 0x8d, 0x80, 0x81, 0x0b, 0x3e, 0x8f, 0x55, 0x78, 0x21, 0x75, 0xfa,
+  0xd7, 0x95, 0xf3, 0x1b, 0xc5, 0xf0, 0x3e, 0x3a, 0xbf, 0xc1, 0x7c, 0xc6, 0x02, 0xf6, 0x75, 0x71,
+  0xac, 0x2a, 0x32, 0x57, 0x52, 0xaa, 0xd5, 0x24, 0x9e, 0x80, 0x6d, 0x39, 0xe1, 0x68, 0xe7, 0x06,
+  0xd6, 0xed, 0x86, 0xa3, 0x33, 0x08, 0x87, 0x00, 0x2b, 0xa5, 0xd0, 0x7c, 0xf0, 0xf9, 0x7a, 0x7c,
+  0x0c, 0xd5, 0x68, 0xc4, 0x98, 0xc4, 0xe0, 0xa2, 0x3c, 0x56, 0x0f, 0xdc, 0x6d, 0xeb, 0x8a, 0x9a,
+  0x95, 0xa7, 0x55, 0xd8, 0x6d, 0x99, 0xbc, 0xd8, 0xb9, 0x29, 0x4f, 0x41, 0x97, 0x8b, 0x2b, 0x41,
+  0xb4, 0xc2, 0x11, 0xed, 0x4d, 0x41, 0x94, 0x8d, 0x25, 0x41, 0xb1, 0xcc, 0x51, 0xbc, 0x4d, 0x50,
+  0x08, 0x78, 0x0e, 0x8e, 0x63, 0x7c, 0x28, 0xcd, 0x5f, 0x2c, 0xc1, 0x2a, 0x58, 0x5c, 0xed, 0x20,
+  0x7b, 0x13, 0xee, 0xf2, 0x4f, 0x09, 0x87, 0x05, 0x88, 0xca, 0x65, 0x95, 0xc9, 0x88, 0x2a, 0x61,
+  0xb3, 0x98, 0xd0, 0x94, 0x77, 0xc4, 0x20, 0x72, 0x98, 0xc3, 0xc6, 0x32, 0xd8, 0xd3, 0x90, 0xd8,
+  0x93, 0x87, 0x2b, 0x0f, 0x51, 0x0a, 0xcb, 0xdb, 0x18, 0x4b, 0xc2, 0x20, 0x06, 0x1f, 0xb1, 0x48,
+  0xe1, 0x90, 0x7f, 0xee, 0x5e, 0xbe, 0x50, 0x0f, 0xab, 0x2a, 0x16, 0xb6, 0xfd, 0x93, 0x5a, 0x2e,
+  0xe7, 0xf8, 0x86, 0x41, 0x09, 0x51, 0xe8, 0xc7, 0x5d, 0x75, 0x60, 0x7c, 0xdb, 0xe8, 0x9f, 0x57,
+  0x2a, 0xfc, 0x74, 0x04, 0x2a, 0x33, 0x3d, 0xb5, 0xe6, 0x03, 0x10, 0x02, 0xae, 0xe1, 0x7f, 0xcd,
+  0xb8, 0xf5, 0x52, 0xb1, 0x58, 0x30, 0x11, 0x24, 0x7c, 0x46, 0xca, 0x67, 0x50, 0x1c, 0xbe, 0x2d,
+  0x83, 0x15, 0x97, 0x1d, 0xb0, 0xe2, 0x48, 0xf6, 0x93, 0x6a, 0xb2, 0xb2, 0x74, 0xda, 0xa2, 0xb9,
+  0x05, 0x9d, 0xac, 0xd7, 0x0c, 0xed, 0x97, 0xac, 0x2e, 0xf1, 0x21, 0xb6, 0x60, 0xa9, 0x89, 0xe2,
+  0x3f, 0x8d, 0x0f, 0x03, 0x21, 0x70, 0x30, 0x18, 0x60, 0xd6, 0xd2, 0xe4, 0x54, 0xd3, 0x26, 0xe4,
+  0xd5, 0xbe, 0x76, 0x62, 0x94, 0xcd, 0xac, 0xf4, 0x11, 0x8a, 0xcc, 0xad, 0xd4, 0xa9, 0xd3, 0xcf,
+  0xc7, 0x2e, 0xf5, 0x70, 0x4a, 0x63, 0x57, 0x8a, 0xae, 0x5c, 0x7e, 0xc9, 0x79, 0x58, 0x3e, 0xbf,
+  0xa6, 0xa7, 0xeb, 0xe9, 0x12, 0x04, 0x4a, 0xa4, 0xf7, 0x7f, 0x24, 0x07, 0x3c, 0x6b, 0xc1, 0xd2,
+  0x9a, 0x1f, 0x77, 0x44, 0xa5, 0x12, 0x2f, 0x0c, 0x5c, 0xd2, 0x59, 0xde, 0x84, 0x12, 0xbb, 0x24,
+  0x7b, 0xb8, 0x96, 0xe7, 0xc1, 0x6e, 0x2c, 0x9f, 0xfd, 0x3f, 0x4f, 0x5d, 0x61, 0x87, 0xae, 0x6f,
+  0x41, 0xf2, 0x08, 0x19, 0x2c, 0xe6, 0x2d, 0xfa, 0xc7, 0xba, 0x4d, 0x9d, 0x61, 0x70, 0x4e, 0x9e,
+  0x93, 0x86, 0x92, 0xab, 0xe0, 0x41, 0xd8, 0x79, 0x30, 0xc2, 0x36, 0x40, 0x69, 0x2d, 0xb4, 0x9f,
+  0x97, 0xa4, 0x84, 0x23, 0x85, 0x23, 0x92, 0x9b, 0x61, 0x9a, 0x9e, 0x26, 0xb0, 0xc4, 0x6d, 0x9c,
+  0xd3, 0xab, 0x16, 0x1b, 0x27, 0xa7, 0x8d, 0xab, 0x47, 0xef, 0x10, 0x16, 0x6c, 0x96, 0xe7, 0x26,
+  0x95, 0xa5, 0x5f, 0xa3, 0x01, 0xbf, 0x02, 0x1e, 0x78, 0x9b, 0x06, 0x56, 0x6f, 0x93, 0x53, 0x2d,
+  0x8b, 0x65, 0xc4, 0x40, 0xec, 0x39, 0x5d, 0xb3, 0xad, 0xe7, 0x5b, 0xc9, 0xea, 0x90, 0x90, 0x00,
+  0xfe, 0x00, 0xd5, 0x16, 0xab, 0xe2, 0x35, 0x48, 0xa6, 0x5c, 0x67, 0xf8, 0xfc, 0xd1, 0x3b, 0xb1,
+  0xde, 0x64, 0x6d, 0x51, 0x7c, 0x22, 0x95, 0x2d, 0x48, 0x25, 0x47, 0x86, 0x8d, 0x79, 0x11, 0x2e,
+  0x3f, 0xa9, 0xae, 0x2d, 0x02, 0x32, 0x79, 0xa5, 0x89, 0x9c, 0x58, 0x45, 0x4b, 0x96, 0xd6, 0x16,
+  0x35, 0x0e, 0xa8, 0xe7, 0x55, 0x75, 0x0b, 0x82, 0xae, 0xb7, 0x73, 0xb4, 0xb7, 0x0b, 0x9b, 0xc3,
+  0x49, 0xb9, 0x79, 0xd6, 0x94, 0x79, 0xa5, 0xb5, 0xf1, 0x73, 0x2c, 0x01, 0xda, 0x42, 0xbc, 0x90,
+  0x5d, 0x8d, 0x41, 0x08, 0x71, 0xf2, 0x65, 0xd2, 0x80, 0x05, 0x6f, 0x2c, 0x87, 0x65, 0xde, 0xaf,
+  0x2d, 0x8e, 0x63, 0xd2, 0x26, 0xb3, 0x14, 0x0f, 0x6b, 0x37, 0x5e, 0xcd, 0x28, 0xf1, 0x55, 0x7c,
+  0x52, 0xfa, 0x41, 0xea, 0xf9, 0x99, 0x66, 0x22, 0x1c, 0x49, 0x7d, 0x00, 0xb9, 0x39, 0x46, 0x6c,
+  0xcb, 0x38, 0x39, 0xcf, 0x09, 0x78, 0x09, 0x36, 0xa9, 0x53, 0xad, 0x61, 0xe3, 0xc8, 0xc6, 0x86,
+  0xef, 0x22, 0x9a, 0x35, 0x86, 0x06, 0x8c, 0xf8, 0x94, 0xd5, 0xde, 0xc9, 0xc8, 0x04, 0xdc, 0xf6,
+  0x29, 0x98, 0xb4, 0xfe, 0x5d, 0x2c, 0x3c, 0x41, 0x97, 0x7f, 0x9a, 0xac, 0x27, 0x1d, 0xe0, 0x65,
+  0xae, 0x87, 0xa7, 0x76, 0xc6, 0x89, 0xe3, 0x8e, 0xa0, 0x36, 0x4a, 0x66, 0x49, 0x87, 0x6f, 0x99,
+  0xb3, 0xc0, 0x01, 0xb9, 0x4d, 0xc5, 0xc9, 0x25, 0x57, 0x78, 0x52, 0x10, 0xc9, 0x79, 0x9c, 0xce,
+  0x3f, 0x7d, 0xee, 0x3a, 0xbf, 0x00, 0xc4, 0x7c, 0xd7, 0xa6, 0x31, 0x3a, 0xb3, 0x58, 0x23, 0xed,
+  0xe8, 0x73, 0xe6, 0xc2, 0x92, 0x0f, 0x78, 0x47, 0x68, 0x96, 0x8c, 0x45, 0xb9, 0x5c, 0x50, 0xcc,
+  0xa9, 0x13, 0x3d, 0x8d, 0x52, 0x3d, 0x35, 0xcb, 0x10, 0x7c, 0x55, 0x41, 0xa5, 0x1c, 0x22, 0x64,
+  0xb2, 0xf0, 0xdc, 0x38, 0xb3, 0x6c, 0x8b, 0xf9, 0x33, 0x48, 0x52, 0x77, 0xe2, 0x5f, 0x51, 0x12,
+  0x9d, 0x8c, 0x97, 0xa6, 0x60, 0x96, 0xf3, 0xe9, 0x0c, 0xbc, 0xd1, 0xd1, 0xb8, 0xeb, 0x30, 0x16,
+  0x46, 0xbf, 0x06, 0x83, 0x28, 0x16, 0x2c, 0x88, 0xdb, 0x35, 0xad, 0x98, 0x81, 0x04, 0xf5, 0x49,
+  0x30, 0x94, 0xf8, 0x16, 0xb9, 0xb0, 0x20, 0x1c, 0xb2, 0x4e, 0x9b, 0xeb, 0xf3, 0x25, 0x62, 0x56,
+  0x2a, 0xfa, 0x17, 0x25, 0x53, 0x32, 0xa5, 0x79, 0xaa, 0x2e, 0x65, 0x62, 0x2a, 0x0e, 0x9e, 0xaa,
+  0x4c, 0x66, 0xca, 0x96, 0x77, 0x25, 0x0a, 0x0b, 0x57, 0x3f, 0xbf, 0xba, 0x8b, 0x74, 0xd3, 0x67,
+  0x44, 0xf7, 0x26, 0xde, 0x0c, 0xd4, 0xbf, 0x54, 0xf9, 0xea, 0xa7, 0x6e, 0xf3, 0x0a, 0x38, 0xa6,
+  0x0d, 0x23, 0x2c, 0x3b, 0x5c, 0x3a, 0x02, 0x04, 0x78, 0x01, 0x30, 0xa2, 0x3c, 0x6a, 0x16, 0x8a,
+  0xf9, 0x6e, 0xc0, 0x44, 0xa1, 0x76, 0x12, 0xb0, 0xc9, 0xd4, 0x58, 0x55, 0xe7, 0xd7, 0x9e, 0x12,
+  0x73, 0x63, 0x04, 0x58, 0xf4, 0x66, 0x0f, 0x83, 0x5e, 0xd2, 0xa1, 0x97, 0xa6, 0x41, 0x2f, 0x6b,
+  0xd0, 0x8f, 0x97, 0xa7, 0x41, 0xaf, 0xe8, 0xd0, 0xcf, 0x72, 0xa0, 0x4d, 0x3a, 0x30, 0x20, 0xf8,
+  0x69, 0xe0, 0x5b, 0x52, 0x87, 0x5a, 0x3d, 0x8d, 0xc8, 0x38, 0x33, 0xd5, 0xf8, 0x1d, 0x23, 0x6a,
+  0xa6, 0x67, 0xf0, 0x43, 0x3e, 0x7e, 0xda, 0x92, 0x84, 0x19, 0xc1, 0xcf, 0xe6, 0xfd, 0x34, 0x2b,
+  0xb6, 0x5f, 0x75, 0x37, 0x3b, 0xfb, 0xdd, 0x76, 0x8f, 0x1c, 0xb4, 0x0e, 0x5b, 0x64, 0xaf, 0xd5,
+  0x6d, 0xbf, 0xdc, 0xc7, 0xd6, 0xc5, 0x41, 0xab, 0xb7, 0xdf, 0x8b, 0xcf, 0x93, 0xef, 0xeb, 0x88,
+  0x89, 0x47, 0x02, 0xbc, 0xf6, 0x18, 0xb9, 0x82, 0x48, 0x3b, 0x61, 0x85, 0x38, 0x4e, 0xa0, 0x7a,
+  0x0f, 0x43, 0x50, 0xef, 0x80, 0x32, 0xa5, 0x97, 0xc3, 0x55, 0xc6, 0x05, 0xcb, 0x4a, 0xde, 0x10,
+  0x64, 0xb3, 0x55, 0xf2, 0x2b, 0xf5, 0x8a, 0xa9, 0x48, 0x18, 0xd5, 0x82, 0x90, 0x5e, 0xb8, 0x48,
+  0x13, 0xe0, 0x52, 0x60, 0x5f, 0xe7, 0x20, 0xfe, 0xb2, 0x99, 0x67, 0xa2, 0x51, 0x4a, 0x8f, 0x47,
+  0x61, 0xf6, 0xc2, 0xbc, 0x16, 0x17, 0x13, 0x52, 0x55, 0x17, 0x68, 0xf3, 0x9e, 0x95, 0x68, 0x58,
+  0xc5, 0x67, 0x3d, 0x6c, 0x58, 0x6d, 0xfa, 0xc9, 0x3d, 0x31, 0xd6, 0xa7, 0x07, 0x9f, 0x25, 0x28,
+  0x38, 0x81, 0xe9, 0x08, 0x54, 0x7a, 0x22, 0xe5, 0x73, 0xe1, 0xd9, 0x49, 0x0c, 0x07, 0xa5, 0xc1,
+  0x09, 0x96, 0xc2, 0x32, 0x80, 0xb0, 0xfe, 0x55, 0x89, 0x47, 0x51, 0x25, 0x92, 0x50, 0xa8, 0x9c,
+  0x3e, 0x7c, 0xfb, 0x4f, 0x76, 0xab, 0x35, 0xbe, 0xed, 0xcb, 0x45, 0x8e, 0x54, 0x63, 0xda, 0x9a,
+  0xb9, 0x59, 0xec, 0xec, 0xa9, 0x81, 0xe3, 0x4d, 0x08, 0x0e, 0xd1, 0xdb, 0x8e, 0xfd, 0x78, 0x1c,
+  0x37, 0xf8, 0x61, 0x20, 0x3b, 0x7e, 0x88, 0x98, 0xf3, 0x85, 0x21, 0x3a, 0xab, 0x0e, 0x65, 0x6d,
+  0x52, 0x4b, 0xee, 0xf1, 0x95, 0xc5, 0x06, 0xca, 0x75, 0xd2, 0x8e, 0x2e, 0x84, 0x87, 0x00, 0xf4,
+  0xe1, 0x7b, 0x1c, 0x85, 0xa8, 0x41, 0x02, 0xe6, 0x45, 0x0d, 0x7b, 0x64, 0xf4, 0xa9, 0x83, 0xcd,
+  0xc2, 0x7b, 0xe6, 0x6a, 0xff, 0xdc, 0x70, 0x86, 0xf4, 0x04, 0x4f, 0x97, 0x65, 0x98, 0x78, 0x27,
+  0xab, 0xc9, 0x9f, 0x69, 0xce, 0xc2, 0xf6, 0xf6, 0x0c, 0x54, 0x14, 0x3a, 0x02, 0x1f, 0x0f, 0x14,
+  0xdb, 0xee, 0x90, 0xeb, 0x16, 0x6f, 0xa4, 0xe3, 0x06, 0xe0, 0x6b, 0xe8, 0x87, 0x6c, 0xdf, 0x17,
+  0x14, 0x3f, 0x7d, 0xf8, 0x37, 0x8f, 0x14, 0xe0, 0xd8, 0xa8, 0x1f, 0xc0, 0x4e, 0x43, 0x56, 0x86,
+  0xd5, 0x25, 0x8d, 0xc7, 0x71, 0xae, 0xb5, 0x73, 0xaa, 0xbc, 0x2e, 0xea, 0x16, 0x93, 0x14, 0x2a,
+  0xa5, 0xc0, 0xc2, 0x4e, 0x9c, 0xa2, 0x0d, 0xf1, 0xbc, 0x30, 0x1c, 0x97, 0x31, 0xe0, 0x3d, 0x66,
+  0x81, 0xae, 0x56, 0x9e, 0x28, 0x5a, 0x90, 0x50, 0x12, 0xab, 0xc1, 0xc3, 0xfb, 0x34, 0x76, 0xe3,
+  0xff, 0x21, 0x5c, 0x1a, 0xcb, 0x5c, 0xe7, 0xf7, 0x68, 0xfa, 0x5d, 0xe8, 0x4a, 0xce, 0x48, 0xec,
+  0xcf, 0x92, 0x8b, 0xe0, 0x33, 0xdd, 0x59, 0x02, 0xfa, 0x3a, 0x1b, 0xeb, 0x7c, 0xce, 0xac, 0x70,
+  0x7a, 0xf8, 0x50, 0xbe, 0x8c, 0xed, 0xe7, 0xe7, 0x76, 0x65, 0xec, 0x46, 0xe1, 0x3d, 0x79, 0x32,
+  0x5e, 0xdd, 0x64, 0x38, 0x32, 0x8d, 0x33, 0x50, 0x56, 0xb1, 0xd9, 0x58, 0x3a, 0x93, 0x24, 0xa5,
+  0xbd, 0x5f, 0x46, 0xfd, 0x3f, 0x78, 0xa7, 0xa2, 0x1a, 0x3c, 0xcd, 0x37, 0x21, 0xfc, 0x2f, 0xc1,
+  0x35, 0xb5, 0x8f, 0xdb, 0xdd, 0x23, 0xb2, 0xdb, 0x81, 0xed, 0x74, 0xdb, 0x87, 0xbd, 0x3b, 0x22,
+  0x94, 0x0e, 0x52, 0x0c, 0xd3, 0x6c, 0xe3, 0x65, 0x8d, 0x5d, 0xcb, 0x47, 0x81, 0x78, 0x95, 0x52,
+  0xdf, 0xb6, 0xfa, 0x6f, 0x41, 0xa8, 0xd1, 0x6d, 0x88, 0x8f, 0xd4, 0xd3, 0x15, 0xe9, 0x42, 0xc2,
+  0xaa, 0x7a, 0x41, 0xa1, 0xc9, 0xa4, 0x2c, 0x2e, 0x43, 0x17, 0x40, 0xac, 0x2b, 0x63, 0xac, 0x5c,
+  0xbc, 0xd3, 0x67, 0x78, 0x27, 0xd6, 0x72, 0xbf, 0xc4, 0x5a, 0x53, 0x93, 0x6a, 0x72, 0x05, 0x5d,
+  0x7a, 0x21, 0x00, 0x59, 0xb0, 0x97, 0xdc, 0x3f, 0x07, 0x75, 0xd7, 0x5f, 0x75, 0x24, 0xaf, 0x16,
+  0x0a, 0xd0, 0x23, 0xbb, 0x42, 0x98, 0xa4, 0x3b, 0x55, 0xad, 0x03, 0x2e, 0x7c, 0x6a, 0xaa, 0xf5,
+  0x2d, 0xfc, 0xaa, 0x28, 0x69, 0x32, 0xda, 0xeb, 0x31, 0x6e, 0x76, 0x53, 0x03, 0x36, 0x96, 0x3c,
+  0xcb, 0x98, 0x8f, 0x48, 0xbc, 0xfb, 0x3f, 0x83, 0xc8, 0x1a, 0x59, 0x02, 0x42, 0x73, 0x68, 0xbc,
+  0x1d, 0xf9, 0xf1, 0xaa, 0x11, 0xf9, 0x45, 0xe4, 0xa2, 0x3f, 0xe4, 0x48, 0x1e, 0x29, 0xcc, 0xde,
+  0xf2, 0x0c, 0xb1, 0xe8, 0xbd, 0x76, 0x21, 0x97, 0x74, 0x93, 0x5d, 0x0e, 0x78, 0x99, 0xad, 0x7c,
+  0x49, 0x30, 0x6c, 0x63, 0xc9, 0x2b, 0x8c, 0xb9, 0x88, 0xcc, 0x12, 0x8b, 0x4e, 0x24, 0x97, 0x4b,
+  0x1e, 0x8d, 0xb7, 0xa4, 0x5f, 0x92, 0x8c, 0x22, 0x98, 0x0d, 0x37, 0x00, 0x1b, 0x65, 0x72, 0xe8,
+  0xb5, 0x77, 0xdb, 0x9b, 0xfc, 0x58, 0x59, 0x96, 0x8a, 0xf4, 0x74, 0x83, 0x5f, 0xa9, 0x80, 0x91,
+  0x8d, 0x30, 0x80, 0x69, 0xbe, 0x7c, 0x71, 0x31, 0xe3, 0x21, 0x0c, 0x07, 0xaf, 0xe1, 0x73, 0x12,
+  0x71, 0x73, 0x51, 0x47, 0x10, 0x37, 0xc9, 0xcf, 0xd8, 0xef, 0x84, 0x5b, 0xfc, 0x77, 0x9a, 0xb5,
+  0x65, 0xc6, 0xda, 0xf2, 0x13, 0xe5, 0xaa, 0x99, 0x76, 0x97, 0x00, 0xd6, 0xeb, 0xe0, 0x95, 0x2c,
+  0x76, 0xeb, 0xa8, 0xe3, 0x04, 0xe2, 0xc2, 0x19, 0xb8, 0xa1, 0x21, 0x0d, 0xe2, 0xf3, 0x0a, 0x06,
+  0xf5, 0x84, 0x2c, 0x35, 0x44, 0xf0, 0xc9, 0x88, 0x80, 0xea, 0x35, 0x8f, 0x24, 0x0d, 0xc0, 0x3d,
+  0x9c, 0x24, 0x32, 0x28, 0x3d, 0x51, 0x00, 0x2d, 0x73, 0x95, 0x93, 0x20, 0xf7, 0xcf, 0xe3, 0x38,
+  0x27, 0xf3, 0x3e, 0xda, 0x15, 0xe3, 0x3e, 0xe6, 0x3b, 0x9e, 0x8b, 0xcf, 0x8c, 0x8e, 0xb7, 0xf7,
+  0x19, 0xcf, 0x67, 0xbe, 0xcd, 0x88, 0xef, 0xa8, 0xce, 0x54, 0xc1, 0x5c, 0x6f, 0x0a, 0xa8, 0xa4,
+  0x70, 0x3e, 0x25, 0x8a, 0x4b, 0xc1, 0xbb, 0x14, 0x8e, 0xd1, 0xf1, 0xa2, 0x89, 0xcf, 0x26, 0x31,
+  0xb9, 0xfb, 0xfa, 0x33, 0x13, 0x89, 0x0b, 0x17, 0x22, 0x33, 0xb9, 0x59, 0xfb, 0x20, 0x14, 0xc6,
+  0x59, 0x63, 0x11, 0x5a, 0xb0, 0xfd, 0xfe, 0xc0, 0xb4, 0xe0, 0x12, 0xc5, 0xf8, 0xa2, 0x5c, 0x18,
+  0x9f, 0x2f, 0xfa, 0xe0, 0x3c, 0x76, 0xe7, 0x20, 0xb6, 0xc1, 0xd9, 0x9a, 0x22, 0x6e, 0xb9, 0xf3,
+  0xce, 0x54, 0x55, 0xb9, 0xe5, 0xcb, 0x4e, 0xe0, 0x39, 0x4e, 0x76, 0x5e, 0x27, 0xd0, 0x47, 0x27,
+  0xe9, 0xd2, 0xa7, 0xb5, 0x75, 0xb2, 0xbc, 0xfc, 0x2c, 0x3a, 0x5e, 0x97, 0x72, 0xd8, 0xdb, 0xb2,
+  0x4b, 0x68, 0x96, 0xd2, 0xfd, 0x5d, 0x8d, 0x56, 0x9b, 0x4c, 0xb9, 0x3c, 0x64, 0x53, 0x2f, 0xa8,
+  0x94, 0x92, 0x1c, 0x9d, 0x67, 0xaf, 0x68, 0xdb, 0x26, 0x3d, 0x63, 0x69, 0x2a, 0x7b, 0x91, 0x1a,
+  0x78, 0x14, 0xdf, 0xd5, 0xe2, 0x2e, 0xae, 0x91, 0x74, 0xfc, 0x8b, 0xfd, 0xda, 0xb9, 0x51, 0xef,
+  0x10, 0xe1, 0xdf, 0xd2, 0xd1, 0xc9, 0x7c, 0x19, 0x0b, 0xd6, 0x12, 0x10, 0x08, 0xdc, 0x59, 0xa7,
+  0x2c, 0xc1, 0x15, 0x4b, 0x5a, 0xbd, 0xab, 0xa8, 0xe5, 0x78, 0x5b, 0xb6, 0xe1, 0x53, 0x2a, 0xf8,
+  0x8e, 0xc7, 0x3e, 0xab, 0xd2, 0xf2, 0x13, 0x91, 0x17, 0x90, 0x59, 0x3e, 0x50, 0x54, 0x47, 0x7b,
+  0x50, 0x63, 0x1f, 0xb6, 0xb6, 0xa0, 0xbe, 0x46, 0x87, 0xa8, 0xbf, 0x1e, 0xba, 0xab, 0x4e, 0x6a,
+  0x8f, 0x9a, 0xe6, 0xd3, 0x3c, 0x4d, 0xeb, 0x9e, 0x36, 0xe6, 0x51, 0xba, 0x54, 0x21, 0xf5, 0xd0,
+  0x7a, 0x27, 0xf8, 0x99, 0x52, 0x3d, 0xd4, 0xba, 0xa7, 0x8d, 0xa9, 0x4a, 0xa7, 0xbd, 0xb4, 0xba,
+  0xbd, 0x63, 0x9a, 0xbe, 0x69, 0xfe, 0x0e, 0x24, 0xf2, 0x4c, 0xfa, 0xbb, 0xac, 0x87, 0x5a, 0x55,
+  0xbc, 0x19, 0x89, 0x96, 0x8d, 0xb4, 0x32, 0xa5, 0x88, 0xf8, 0x1f, 0x79, 0x80, 0xf9, 0xf4, 0x0d,
+  0x2b, 0xa1, 0xc7, 0xec, 0x85, 0x7d, 0xa2, 0x92, 0xf1, 0xeb, 0x92, 0x82, 0xb9, 0x60, 0x5e, 0x01,
+  0x8f, 0xa5, 0x63, 0x94, 0x23, 0xa4, 0x5e, 0x82, 0xdd, 0x15, 0x37, 0x06, 0x44, 0x0d, 0xbb, 0x78,
+  0x7f, 0x52, 0x34, 0x83, 0x4d, 0x37, 0xa5, 0x0a, 0xe5, 0x33, 0x51, 0xd3, 0x56, 0x37, 0x66, 0xed,
+  0x11, 0xd3, 0xdd, 0xad, 0x59, 0x7d, 0x5e, 0x35, 0x9f, 0x39, 0xaf, 0x88, 0xa0, 0xa1, 0x59, 0xf5,
+  0xd3, 0xc6, 0x9c, 0x76, 0xad, 0xf7, 0x6f, 0x1f, 0xde, 0xb0, 0x39, 0x73, 0x53, 0x96, 0xbd, 0xf2,
+  0x0c, 0xef, 0x8c, 0xa1, 0x79, 0xc3, 0x1e, 0xf0, 0xcf, 0xb4, 0x65, 0x2f, 0xe8, 0xef, 0xb5, 0xee,
+  0x62, 0x65, 0x53, 0x37, 0xae, 0x1b, 0xb7, 0xf6, 0xba, 0xeb, 0xc1, 0xd6, 0xd5, 0xcd, 0x3b, 0xe3,
+  0x20, 0x2c, 0x63, 0x69, 0x96, 0x53, 0xe6, 0x94, 0xd5, 0x38, 0x73, 0x17, 0x0a, 0x0a, 0x3b, 0x43,
+  0xf5, 0x52, 0xe7, 0x6b, 0xd5, 0x59, 0x51, 0xb4, 0x80, 0xbe, 0xb0, 0x15, 0x61, 0x20, 0x3a, 0xa2,
+  0x5b, 0x95, 0x69, 0x98, 0xe8, 0x75, 0x76, 0xda, 0xea, 0xf2, 0x3d, 0x97, 0xfa, 0x30, 0xee, 0xf6,
+  0xee, 0x85, 0x9f, 0xa2, 0xa8, 0xbe, 0x4b, 0x7f, 0x2b, 0x77, 0x67, 0xec, 0x9a, 0xf7, 0x92, 0x9f,
+  0xcf, 0xdd, 0xc6, 0x7d, 0x89, 0x63, 0xc2, 0xc4, 0x7f, 0x41, 0x1d, 0x8c, 0xbd, 0x89, 0xc0, 0x1d,
+  0x0e, 0x6d, 0x4a, 0x0e, 0xb7, 0xf3, 0x73, 0x63, 0x48, 0x87, 0x6b, 0x1c, 0xac, 0xe6, 0x0d, 0x8a,
+  0x24, 0xc6, 0x77, 0x52, 0x01, 0xbe, 0xd2, 0x89, 0x37, 0x28, 0x29, 0xe5, 0xe3, 0xdd, 0x1a, 0x86,
+  0x9d, 0x6e, 0x67, 0xb3, 0xd3, 0xda, 0xed, 0xfc, 0x8e, 0xdf, 0x22, 0xbf, 0x23, 0xc2, 0x98, 0x53,
+  0x69, 0x4e, 0x6c, 0xed, 0xef, 0x89, 0x3e, 0xfe, 0xae, 0x6b, 0x98, 0xd4, 0xd4, 0x98, 0x92, 0xfb,
+  0x48, 0x2a, 0xb7, 0xc1, 0xd4, 0xa8, 0x4e, 0xe9, 0x71, 0x34, 0xb4, 0x3e, 0x72, 0xc7, 0xb1, 0x40,
+  0x85, 0xd4, 0x63, 0x07, 0xb0, 0x01, 0x9b, 0xfd, 0x07, 0x71, 0x7c, 0x71, 0xb3, 0x61, 0x9e, 0xa3,
+  0xd4, 0x62, 0x87, 0x5a, 0x82, 0x8a, 0x39, 0x8e, 0x35, 0x8a, 0xb4, 0xa3, 0xb3, 0x0f, 0x14, 0x4a,
+  0xf1, 0x7f, 0x73, 0xc3, 0x06, 0xa6, 0x1b, 0x75, 0xd8, 0x33, 0x7f, 0xe5, 0x68, 0x1b, 0xa4, 0x73,
+  0x90, 0xbc, 0x22, 0x83, 0x38, 0x30, 0x86, 0xef, 0xc0, 0x63, 0x23, 0x7a, 0xdf, 0xe7, 0x61, 0x40,
+  0x60, 0x0a, 0xf5, 0x3f, 0x30, 0x94, 0x19, 0x9d, 0x4d, 0x4b, 0x00, 0x00,
+};
+
+// style.css: 6307 bytes sin comprimir
+static const uint8_t ui_style_css[] PROGMEM = {
+  0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xb5, 0x58, 0xeb, 0x6e, 0xdb, 0x36,
+  0x14, 0xfe, 0xef, 0xa7, 0x20, 0x1a, 0x0c, 0x6d, 0x0a, 0xc9, 0x95, 0x64, 0x2b, 0x4e, 0x6c, 0xf4,
+  0x47, 0xdb, 0x75, 0x5d, 0x81, 0xb6, 0x18, 0x96, 0xb6, 0x40, 0x31, 0xec, 0x07, 0x45, 0x51, 0xb6,
+  0x16, 0x89, 0xd4, 0x48, 0x2a, 0x8e, 0x5b, 0xf4, 0xa1, 0x86, 0x3e, 0x42, 0x5f, 0x6c, 0x87, 0x14,
+  0x75, 0xb3, 0xa5, 0xc6, 0x1b, 0x92, 0x04, 0x09, 0x2c, 0xf1, 0xf0, 0x5c, 0xbf, 0x73, 0xf3, 0x93,
+  0xc7, 0xe8, 0xe9, 0x9d, 0xfd, 0x4c, 0x10, 0x42, 0x97, 0xef, 0x3f, 0xbd, 0x79, 0x39, 0x7d, 0x71,
+  0x79, 0x89, 0x5c, 0xf4, 0x73, 0x2a, 0xe9, 0xf7, 0x7f, 0x38, 0x7a, 0xcb, 0x63, 0x2a, 0x18, 0x47,
+  0x05, 0x16, 0x18, 0xd1, 0x0c, 0xbd, 0x66, 0x52, 0x89, 0x32, 0xa7, 0x4c, 0x71, 0xf4, 0x31, 0x15,
+  0xaa, 0xc4, 0x99, 0xbe, 0x7a, 0x77, 0x8a, 0xa0, 0xc7, 0x4f, 0x26, 0x93, 0x27, 0x8f, 0x91, 0x7b,
+  0x67, 0x3f, 0x5a, 0x3f, 0x7f, 0x8a, 0x3e, 0x62, 0x91, 0xe2, 0x28, 0xa3, 0x12, 0xbd, 0xca, 0x78,
+  0x84, 0xf5, 0x87, 0x1d, 0x7a, 0x29, 0x55, 0x9a, 0x71, 0x89, 0x9e, 0x63, 0x49, 0x35, 0xdd, 0xdd,
+  0x49, 0xd5, 0x76, 0x2c, 0x05, 0xe7, 0x0a, 0x7d, 0xd1, 0x8c, 0x81, 0x33, 0xe1, 0x19, 0x17, 0x6e,
+  0x21, 0xd2, 0x1c, 0x8b, 0xdd, 0x12, 0x9d, 0x78, 0xde, 0x22, 0x4a, 0x92, 0xd5, 0xd0, 0xa9, 0x1b,
+  0x63, 0x71, 0x65, 0x48, 0xc2, 0xb3, 0x68, 0xd6, 0x27, 0x91, 0x25, 0x21, 0x54, 0x4a, 0x38, 0x0d,
+  0xce, 0xf1, 0x62, 0x1e, 0x0e, 0x9e, 0xd6, 0x0c, 0x7c, 0xba, 0xa0, 0xb3, 0x79, 0x9f, 0x24, 0xc6,
+  0x6c, 0x4d, 0x05, 0x1c, 0xc6, 0x64, 0x16, 0xee, 0xdf, 0xaf, 0x0e, 0xeb, 0xeb, 0x51, 0xe0, 0x27,
+  0x41, 0xdc, 0xa7, 0xc8, 0xd2, 0xf5, 0x46, 0xb9, 0x6b, 0x81, 0xb5, 0x0d, 0xc9, 0x79, 0x72, 0x91,
+  0xe0, 0x3e, 0x41, 0x4e, 0xe3, 0xb4, 0xcc, 0x6b, 0x0a, 0x7a, 0x41, 0x09, 0x4d, 0xf6, 0x85, 0x88,
+  0xab, 0xfa, 0xfc, 0x8c, 0x2c, 0xc2, 0xc5, 0x9e, 0x08, 0x45, 0x6f, 0x94, 0xb6, 0xcf, 0x0f, 0xc2,
+  0xe0, 0xa2, 0x7f, 0x14, 0xad, 0xb5, 0xd4, 0x79, 0xb2, 0x48, 0xce, 0xf6, 0x78, 0xa6, 0xb2, 0xc8,
+  0xf0, 0xae, 0x22, 0x08, 0xc8, 0x8c, 0x86, 0xde, 0x0a, 0x01, 0x8e, 0x9e, 0x7d, 0x2e, 0x33, 0xc4,
+  0x25, 0x29, 0x45, 0x0b, 0x62, 0x4b, 0xab, 0x43, 0x34, 0xc4, 0xc2, 0x8a, 0xa7, 0x24, 0xf1, 0x12,
+  0xdf, 0x30, 0x79, 0x0f, 0x6f, 0x38, 0x22, 0x19, 0x3e, 0x9e, 0x49, 0x86, 0x23, 0x9a, 0x01, 0x97,
+  0x8b, 0x10, 0x87, 0xf8, 0xcc, 0x70, 0x79, 0x25, 0x52, 0x89, 0x64, 0x89, 0xaf, 0xa9, 0x65, 0xa2,
+  0xd2, 0xbf, 0x4b, 0xaa, 0xb0, 0x44, 0xf1, 0x10, 0x3f, 0xb9, 0xc1, 0x31, 0xdf, 0x2e, 0x91, 0x87,
+  0xe6, 0xc5, 0x0d, 0xf2, 0x03, 0xf8, 0x27, 0xd6, 0x11, 0x7e, 0xe4, 0x39, 0xe6, 0x77, 0xea, 0x9f,
+  0xd6, 0x1e, 0x88, 0xb8, 0x80, 0x2c, 0x75, 0x05, 0x06, 0xc7, 0x03, 0x30, 0xce, 0x8b, 0x9b, 0xd5,
+  0xe4, 0xeb, 0x64, 0x12, 0xf1, 0x78, 0x67, 0xd1, 0x97, 0x70, 0xa6, 0xdc, 0x04, 0xe7, 0x69, 0x06,
+  0x3e, 0x77, 0x71, 0x51, 0x64, 0xd4, 0x95, 0x3b, 0xa9, 0x68, 0xee, 0xa0, 0xe7, 0x59, 0xca, 0xae,
+  0xde, 0x62, 0x72, 0x69, 0x9e, 0x7f, 0x01, 0x4a, 0x07, 0x3d, 0xb8, 0xa4, 0x6b, 0x4e, 0xd1, 0x87,
+  0xd7, 0x0f, 0x1c, 0xf4, 0x3b, 0x8f, 0xb8, 0xe2, 0x0e, 0xfa, 0x95, 0x66, 0xd7, 0xa0, 0x32, 0xc1,
+  0x0e, 0x7a, 0x06, 0xa9, 0x94, 0x39, 0x48, 0x62, 0x26, 0x5d, 0x49, 0x45, 0x6a, 0xe3, 0x0b, 0xd0,
+  0x5d, 0xa7, 0x0c, 0x34, 0xae, 0x1e, 0x0b, 0x1c, 0xc7, 0x29, 0x83, 0x78, 0x04, 0x9e, 0xd6, 0x48,
+  0xbf, 0x8a, 0x30, 0xb9, 0x5a, 0x0b, 0x5e, 0xb2, 0xb8, 0x72, 0xd7, 0x12, 0x5d, 0x63, 0xf1, 0xa8,
+  0x0d, 0xae, 0x35, 0x69, 0xe0, 0x4c, 0x07, 0xc5, 0x9e, 0x82, 0xbe, 0xd4, 0xdd, 0x50, 0x8d, 0xc3,
+  0x25, 0x64, 0xf6, 0x99, 0x31, 0xf6, 0xce, 0x4b, 0x46, 0x30, 0xd5, 0xd5, 0x41, 0x94, 0x44, 0x95,
+  0x10, 0xab, 0x1d, 0x7a, 0x01, 0x8e, 0xa1, 0x8c, 0xc6, 0x5c, 0xa0, 0xdf, 0x44, 0xca, 0x48, 0x5a,
+  0x54, 0xa5, 0xef, 0x6e, 0x4b, 0xc6, 0x94, 0x80, 0x18, 0x0c, 0x06, 0x0a, 0xf4, 0x05, 0xfc, 0x79,
+  0xe3, 0x6e, 0xd3, 0x58, 0x6d, 0x20, 0xa6, 0x9e, 0xf6, 0x61, 0xe3, 0x61, 0xed, 0x51, 0x84, 0x4b,
+  0xc5, 0x57, 0x1d, 0x97, 0x2e, 0xd1, 0x76, 0x93, 0x2a, 0xba, 0x6a, 0x1d, 0x3f, 0x33, 0x97, 0xf6,
+  0xe0, 0x51, 0x79, 0xb5, 0xf7, 0xf2, 0x54, 0x13, 0xdd, 0x34, 0x88, 0xab, 0x28, 0xaa, 0x27, 0x38,
+  0xfa, 0x3a, 0xd9, 0x50, 0x0c, 0xc4, 0x10, 0x70, 0x4a, 0x54, 0xca, 0x99, 0x51, 0x4d, 0x2b, 0x02,
+  0x5c, 0x94, 0xe2, 0x79, 0x2d, 0x08, 0x08, 0x7d, 0x07, 0x6d, 0x02, 0xf8, 0x9b, 0x01, 0xcd, 0x40,
+  0x14, 0xbb, 0xf5, 0xed, 0xb4, 0x36, 0xc7, 0x55, 0xbc, 0xd0, 0xa0, 0xd1, 0xf7, 0x03, 0xb8, 0x67,
+  0x55, 0xab, 0x79, 0x6b, 0xe0, 0x4b, 0x9e, 0xa5, 0x71, 0x8f, 0x53, 0xa7, 0xca, 0x9c, 0x36, 0x16,
+  0x37, 0x77, 0x7c, 0xab, 0xcf, 0xdd, 0xc3, 0x62, 0x36, 0xd5, 0xbd, 0xd1, 0x64, 0x6a, 0x4c, 0x7b,
+  0xed, 0xf0, 0x03, 0x4b, 0x13, 0xc8, 0x8e, 0x98, 0xdf, 0x03, 0x2a, 0xd2, 0x46, 0x4e, 0x5d, 0x60,
+  0x6c, 0x62, 0xff, 0x38, 0xa1, 0xda, 0xa2, 0x38, 0x9e, 0x58, 0xdd, 0xaa, 0x67, 0xa9, 0x8e, 0x01,
+  0xcc, 0x68, 0x86, 0x1b, 0x32, 0x88, 0x40, 0x13, 0xb5, 0x93, 0xd9, 0x7c, 0x7e, 0x11, 0xd2, 0xd5,
+  0x61, 0x21, 0x7a, 0xf8, 0x82, 0x97, 0x22, 0x05, 0xa8, 0xbf, 0xa3, 0xdb, 0x87, 0x0e, 0xb2, 0x4f,
+  0x0e, 0xca, 0x39, 0xe3, 0xb2, 0xc0, 0x84, 0x0e, 0xe6, 0xbb, 0xed, 0x08, 0x5a, 0x5f, 0x17, 0x43,
+  0x37, 0x82, 0x74, 0xc8, 0x68, 0xa2, 0xba, 0x25, 0xa8, 0xc5, 0x8e, 0x57, 0xd5, 0xc2, 0x21, 0x07,
+  0x16, 0x0d, 0x8c, 0x2d, 0xf8, 0x86, 0x88, 0xe0, 0x05, 0x67, 0xeb, 0x61, 0x30, 0xf7, 0x4a, 0xfd,
+  0xe9, 0xfd, 0xc0, 0x6d, 0x3e, 0x35, 0x85, 0x47, 0xf0, 0x6a, 0x5e, 0x79, 0x07, 0xcd, 0x63, 0x8d,
+  0x49, 0xfa, 0xfd, 0x1b, 0xdb, 0x83, 0x9f, 0xbc, 0x5f, 0xd4, 0xe5, 0x3c, 0x2e, 0x33, 0x0a, 0x7e,
+  0xe8, 0x87, 0x7c, 0x20, 0xdc, 0xe3, 0x49, 0x7a, 0x54, 0x1d, 0xea, 0x96, 0x84, 0xc0, 0x66, 0xf1,
+  0x14, 0x54, 0x28, 0x5d, 0x52, 0xf9, 0x41, 0x82, 0x12, 0xd6, 0xf3, 0x4b, 0x94, 0x64, 0x14, 0x28,
+  0xfe, 0x2a, 0x61, 0x8c, 0x4b, 0x76, 0x86, 0x02, 0x94, 0x5d, 0x22, 0x03, 0x1e, 0x37, 0xa2, 0x6a,
+  0x4b, 0x29, 0x5b, 0x21, 0x83, 0x12, 0x17, 0x4a, 0x63, 0x0e, 0x62, 0x09, 0x50, 0x50, 0xb1, 0xda,
+  0x47, 0x8a, 0xdf, 0xc8, 0x32, 0x96, 0xba, 0x0c, 0xe7, 0xda, 0x5c, 0x83, 0xd7, 0xad, 0xc5, 0x5e,
+  0xc4, 0xb3, 0x78, 0x55, 0xbd, 0x92, 0xe9, 0x67, 0xaa, 0xc1, 0x18, 0xd0, 0x7c, 0x35, 0xde, 0xae,
+  0x34, 0x3f, 0x46, 0xa1, 0xad, 0xc6, 0x1d, 0xed, 0xbb, 0x29, 0xd6, 0x48, 0xbf, 0xdd, 0x7d, 0xdd,
+  0x84, 0x6b, 0xef, 0x85, 0x75, 0xde, 0x8d, 0x00, 0xbf, 0x6a, 0x28, 0x20, 0xd8, 0xd5, 0x55, 0xa2,
+  0x38, 0xf4, 0xdd, 0xa0, 0x6f, 0xd6, 0xb8, 0xa8, 0x3d, 0xd2, 0x8d, 0x87, 0x91, 0x06, 0x36, 0x19,
+  0xc0, 0xef, 0x3b, 0xe7, 0xcc, 0xf3, 0x7a, 0xbe, 0xf1, 0xa6, 0x17, 0x23, 0xbe, 0x69, 0xc6, 0xbf,
+  0x2a, 0x67, 0x52, 0x56, 0x94, 0xea, 0x0f, 0xb5, 0x2b, 0xe8, 0xd3, 0x07, 0xda, 0x6d, 0x0f, 0xfe,
+  0x74, 0x50, 0xf7, 0x1d, 0x2b, 0xf3, 0x88, 0x0a, 0xfd, 0x56, 0xd2, 0x0c, 0x1a, 0x50, 0x3d, 0xd2,
+  0x80, 0xfa, 0xda, 0x28, 0xe8, 0x57, 0x7e, 0xa7, 0xe5, 0xf9, 0x23, 0xb0, 0x3c, 0x21, 0x84, 0xac,
+  0x8e, 0xaf, 0x6c, 0x4a, 0xc0, 0x6c, 0x93, 0xea, 0x66, 0xb7, 0xac, 0x2f, 0x19, 0xe5, 0xc1, 0xac,
+  0x40, 0x3a, 0x9d, 0x6e, 0x69, 0x5e, 0x68, 0x4f, 0x1b, 0x95, 0x97, 0x09, 0x27, 0xa5, 0xac, 0x35,
+  0xad, 0x9e, 0xda, 0x8e, 0x36, 0xde, 0x10, 0xf7, 0x1a, 0xb0, 0x67, 0x7e, 0x67, 0xed, 0xc4, 0x07,
+  0xe3, 0xdf, 0xcc, 0x41, 0x41, 0x18, 0x3a, 0x5a, 0x1e, 0x50, 0xf3, 0x52, 0xe9, 0xb2, 0xb8, 0x44,
+  0x8c, 0x33, 0x6a, 0xdc, 0x18, 0x95, 0x10, 0x79, 0x76, 0x54, 0x5b, 0x68, 0x85, 0xda, 0xc3, 0xfd,
+  0xb9, 0x41, 0x3b, 0xd1, 0x46, 0xbb, 0xf6, 0xa4, 0x91, 0x73, 0x74, 0x77, 0x40, 0x30, 0x6f, 0x4b,
+  0xcd, 0xb9, 0xe0, 0x69, 0x05, 0xa9, 0xc3, 0x44, 0x3a, 0xf4, 0xf3, 0x9e, 0xd2, 0xd6, 0xd7, 0x86,
+  0x24, 0xe1, 0x22, 0x87, 0x67, 0xdf, 0xb8, 0xba, 0x32, 0x75, 0xb9, 0xe1, 0xd7, 0x66, 0x4c, 0x3a,
+  0xca, 0xd8, 0x7a, 0xe4, 0x68, 0xb8, 0x2d, 0xab, 0x8f, 0x19, 0x56, 0xf4, 0xd3, 0x23, 0x17, 0x80,
+  0x62, 0xd0, 0x68, 0x59, 0x43, 0x92, 0xe8, 0x5d, 0x31, 0xbe, 0x95, 0x7b, 0xbf, 0xc2, 0xd5, 0x56,
+  0x33, 0xae, 0x5b, 0x53, 0xc6, 0xb7, 0x34, 0xbe, 0x35, 0x03, 0x3a, 0x0a, 0xd5, 0xb1, 0xac, 0x94,
+  0x98, 0x46, 0x8a, 0xb9, 0x66, 0xd8, 0xfa, 0xb1, 0x0a, 0x76, 0xe5, 0x3b, 0x3d, 0xb8, 0x79, 0xa4,
+  0x83, 0xba, 0x2b, 0xe3, 0x01, 0x93, 0x24, 0xb9, 0xf5, 0x7e, 0xb5, 0x32, 0x0e, 0xdc, 0x3c, 0x52,
+  0x7e, 0x67, 0xe5, 0xac, 0x0a, 0xc2, 0x94, 0x32, 0xc2, 0xab, 0x7c, 0x39, 0xac, 0xf8, 0x6b, 0x91,
+  0x82, 0x4f, 0xf5, 0x7f, 0xa8, 0xb1, 0x79, 0xa1, 0xc3, 0xa7, 0xf9, 0x94, 0x39, 0x03, 0x2c, 0xfa,
+  0x89, 0xd0, 0x7f, 0xbd, 0x02, 0x06, 0x25, 0x38, 0x29, 0xb3, 0xac, 0x1a, 0xa4, 0x81, 0x93, 0x1d,
+  0xa8, 0x7d, 0xcf, 0xfb, 0xe9, 0x7e, 0x5a, 0x76, 0x38, 0x45, 0x97, 0x94, 0x10, 0x80, 0x34, 0xd5,
+  0x9b, 0x1d, 0x8c, 0x8b, 0x78, 0xcd, 0xbe, 0x7f, 0x83, 0x16, 0x45, 0x60, 0x8b, 0x82, 0x9d, 0x02,
+  0x72, 0x1c, 0x5a, 0xf9, 0x1b, 0xbe, 0xbe, 0x87, 0x96, 0x2d, 0x09, 0x66, 0xb0, 0x3c, 0xd8, 0x7e,
+  0xed, 0xa0, 0x69, 0xc6, 0xd7, 0x6d, 0xf3, 0xfe, 0x71, 0x20, 0xda, 0xcd, 0xfe, 0x74, 0x35, 0xdc,
+  0xe7, 0x6f, 0x49, 0xfa, 0xaf, 0x93, 0x13, 0xb0, 0x4e, 0x95, 0xd2, 0x8d, 0xb0, 0xe8, 0xce, 0x0a,
+  0x7a, 0x79, 0xdd, 0x6b, 0x25, 0xc7, 0x73, 0xed, 0x0e, 0x7a, 0x75, 0x83, 0x1a, 0x68, 0xcb, 0xdd,
+  0x4a, 0x02, 0xb9, 0x07, 0xc5, 0x62, 0x26, 0x11, 0xc5, 0xd2, 0x64, 0xd4, 0xd4, 0xea, 0x05, 0x88,
+  0x62, 0x50, 0x98, 0x47, 0x12, 0xfb, 0x24, 0x9e, 0xd3, 0x38, 0xc6, 0x4d, 0xca, 0x9e, 0xf8, 0x61,
+  0xb8, 0x08, 0xe6, 0x5d, 0x06, 0x80, 0xc3, 0x5b, 0x78, 0x24, 0xe7, 0xf1, 0xa2, 0xcb, 0x63, 0x11,
+  0xf8, 0xa4, 0xe2, 0xd1, 0x30, 0x31, 0x49, 0x5d, 0x9f, 0x07, 0x80, 0x95, 0x85, 0x3f, 0x68, 0x52,
+  0x2b, 0xb6, 0xca, 0xc3, 0xfa, 0x0a, 0x5d, 0xcc, 0xc9, 0x8c, 0x8c, 0x5c, 0x81, 0x18, 0x00, 0x06,
+  0x5c, 0x41, 0x65, 0x99, 0x29, 0x28, 0x9f, 0x27, 0xf0, 0xa9, 0xe0, 0x4c, 0x52, 0x17, 0xa0, 0xd0,
+  0xf4, 0xa2, 0xe3, 0x26, 0xb6, 0xc1, 0xae, 0xda, 0x84, 0x6b, 0x3e, 0x36, 0x1f, 0xec, 0x89, 0x34,
+  0x85, 0xbe, 0x99, 0xdf, 0x43, 0xc3, 0x4a, 0x57, 0x86, 0x04, 0x0a, 0xa4, 0x0b, 0x29, 0x2d, 0x09,
+  0x24, 0x79, 0xd6, 0xdf, 0x64, 0x61, 0x69, 0x98, 0xe1, 0xb9, 0xd7, 0xba, 0xb1, 0xfb, 0x4d, 0xd3,
+  0x7f, 0x5c, 0x22, 0x06, 0xa6, 0x12, 0xd3, 0xf0, 0x5c, 0x73, 0x0c, 0x3d, 0x4a, 0x50, 0x77, 0x2b,
+  0x70, 0x61, 0xe6, 0xa5, 0x84, 0x73, 0x65, 0x8a, 0xd6, 0x10, 0xec, 0x6e, 0x29, 0xe5, 0x87, 0x72,
+  0xea, 0x79, 0xad, 0x33, 0xce, 0x5a, 0x27, 0x56, 0x0e, 0x3b, 0x22, 0x06, 0x5d, 0x07, 0xcf, 0x35,
+  0x07, 0x40, 0xc5, 0x15, 0xdd, 0x45, 0x1c, 0x8b, 0xc3, 0xa9, 0xb2, 0xe3, 0xc1, 0xb1, 0xcc, 0xee,
+  0x2f, 0x6e, 0xed, 0x00, 0x79, 0xf4, 0x68, 0xb4, 0x3f, 0x38, 0x87, 0xe3, 0xab, 0xdf, 0xf8, 0x30,
+  0xab, 0xb3, 0xe1, 0xd0, 0x0a, 0xfd, 0xb5, 0x41, 0x57, 0x86, 0xfd, 0x62, 0x60, 0x74, 0x75, 0x6d,
+  0x7d, 0xdf, 0xe2, 0xc2, 0x4e, 0xe6, 0xe0, 0xfd, 0x83, 0x35, 0xd1, 0x86, 0x51, 0x0b, 0xbf, 0x8a,
+  0xe2, 0xfb, 0xdf, 0xa0, 0x47, 0xb7, 0xe0, 0x81, 0x44, 0xda, 0xdb, 0xa7, 0xe1, 0xde, 0x59, 0xfd,
+  0xf6, 0xff, 0xec, 0xcc, 0x3d, 0x28, 0x9e, 0x87, 0xb5, 0x37, 0xfa, 0x43, 0xa6, 0x96, 0xe2, 0xf5,
+  0xbf, 0x54, 0x0c, 0xac, 0x01, 0x4d, 0xbf, 0x4d, 0x99, 0x59, 0xbf, 0xa3, 0x8c, 0x93, 0x2b, 0x1b,
+  0x7f, 0x08, 0x8c, 0x6d, 0xa2, 0xed, 0xda, 0x3f, 0xec, 0xe6, 0x7f, 0x01, 0xb0, 0x91, 0x9e, 0x45,
+  0xa3, 0x18, 0x00, 0x00,
+};
+
+struct WebUiAsset {
+  const char* path;
+  const char* mime;
+  const char* etag;
+  const uint8_t* gz;
+  size_t gz_len;
+  size_t raw_len;
+};
+
+static const WebUiAsset WEB_UI_ASSETS[] = {
+  {"/", "text/html; charset=utf-8", "\"c96d3c89d09d3830\"", ui_index_html, sizeof(ui_index_html), 8834},
+  {"/script.js", "application/javascript; charset=utf-8", "\"7385468b6be7b801\"", ui_script_js, sizeof(ui_script_js), 19277},
+  {"/style.css", "text/css; charset=utf-8", "\"7b361a767ccc1dbc\"", ui_style_css, sizeof(ui_style_css), 6307},
+};
+
+#define WEB_UI_ASSET_COUNT (sizeof(WEB_UI_ASSETS) / sizeof(WEB_UI_ASSETS[0]))
+
+#endif // WEB_UI_ASSETS_H
@@ -0,0 +1,173 @@
+#include <WiFi.h>
+#include <Preferences.h>
+#include "wifi_cache.h"
+#include "main_interface.h"
+#include "config.h"
+
+#define WIFI_NVS_NAMESPACE  "wifi"
+#define WIFI_NVS_KEY        "cache"
+#define WIFI_NVS_STATIC     "ip_fija"
+
+struct WifiCacheBlob {
+  uint32_t cred_hash;   // FNV-1a de SSID + clave
+  uint8_t bssid[6];
+  uint8_t channel;
+  uint8_t reserved;
+  uint32_t ip;
+  uint32_t gateway;
+  uint32_t mask;
+  uint32_t dns;
+};
+
+static WifiCacheBlob cache;
+static bool cache_valid = false;
+static bool static_ip = false;
+static String cur_ssid, cur_pass;
+static WifiConnectPath path = WIFI_PATH_NONE;
+static uint32_t begin_ms = 0;
+static uint32_t ip_ms = 0;
+
+static uint32_t credHash(const String& ssid, const String& pass) {
+  uint32_t h = 2166136261UL;
+  for (size_t i = 0; i < ssid.length(); i++) { h ^= (uint8_t)ssid[i]; h *= 16777619UL; }
+  h ^= 0xFF; h *= 16777619UL;   // Separador: "ab"+"c" != "a"+"bc"
+  for (size_t i = 0; i < pass.length(); i++) { h ^= (uint8_t)pass[i]; h *= 16777619UL; }
+  return h;
+}
+
+static void loadCache(uint32_t hash) {
+  Preferences prefs;
+  prefs.begin(WIFI_NVS_NAMESPACE, true);
+  cache_valid = prefs.getBytesLength(WIFI_NVS_KEY) == sizeof(cache) &&
+                prefs.getBytes(WIFI_NVS_KEY, &cache, sizeof(cache)) == sizeof(cache) &&
+                cache.cred_hash == hash && cache.channel >= 1 && cache.channel <= 14;
+  static_ip = prefs.getBool(WIFI_NVS_STATIC, false);
+  prefs.end();
+}
+
+static void saveCache() {
+  Preferences prefs;
+  prefs.begin(WIFI_NVS_NAMESPACE, false);
+  prefs.putBytes(WIFI_NVS_KEY, &cache, sizeof(cache));
+  prefs.end();
+}
+
+// ==========================================================
+// ASOCIACIÓN
+// ==========================================================
+
+void wifi_cache_begin(const String& ssid, const String& pass) {
+  cur_ssid = ssid;
+  cur_pass = pass;
+  loadCache(credHash(ssid, pass));
+  begin_ms = millis();
+
+  if (cache_valid) {
+    if (static_ip && cache.ip != 0) {
+      WiFi.config(IPAddress(cache.ip), IPAddress(cache.gateway),
+                  IPAddress(cache.mask), IPAddress(cache.dns));
+    }
+    WiFi.begin(ssid.c_str(), pass.c_str(), cache.channel, cache.bssid);
+    path = WIFI_PATH_FAST;
+    Serial.printf("[WiFi] Camino rapido: canal %d, BSSID %02X:%02X:%02X:%02X:%02X:%02X%s\n",
+                  cache.channel, cache.bssid[0], cache.bssid[1], cache.bssid[2],
+                  cache.bssid[3], cache.bssid[4], cache.bssid[5],
+                  (static_ip && cache.ip) ? ", IP fija" : "");
+  } else {
+    WiFi.begin(ssid.c_str(), pass.c_str());
+    path = WIFI_PATH_FULL;
+    Serial.println(F("[WiFi] Sin cache: barrido completo."));
+  }
+}
+
+void wifi_cache_service() {
+  if (path != WIFI_PATH_FAST || ip_ms != 0) return;
+  if (WiFi.status() == WL_CONNECTED || millis() - begin_ms < WIFI_FAST_TIMEOUT_MS) return;
+
+  // El AP cambió de canal, se reemplazó o la IP fija ya no es válida
+  Serial.println(F("[WiFi] Camino rapido sin IP: barrido completo."));
+  WiFi.disconnect();
+  WiFi.config(INADDR_NONE, INADDR_NONE, INADDR_NONE);   // Vuelve a DHCP
+  WiFi.begin(cur_ssid.c_str(), cur_pass.c_str());
+  path = WIFI_PATH_FALLBACK;
+}
+
+void wifi_cache_on_connected() {
+  if (ip_ms == 0) {
+    ip_ms = (millis() - begin_ms) | 1;
+    Serial.printf("[WiFi] IP en %lu ms\n", (unsigned long)ip_ms);
+  }
+
+  WifiCacheBlob now = {};
+  now.cred_hash = credHash(cur_ssid, cur_pass);
+  memcpy(now.bssid, WiFi.BSSID(), sizeof(now.bssid));
+  now.channel = (uint8_t)WiFi.channel();
+  now.ip = (uint32_t)WiFi.localIP();
+  now.gateway = (uint32_t)WiFi.gatewayIP();
+  now.mask = (uint32_t)WiFi.subnetMask();
+  now.dns = (uint32_t)WiFi.dnsIP(0);
+
+  // Reconexiones al mismo AP no tocan la flash
+  if (cache_valid && memcmp(&now, &cache, sizeof(cache)) == 0) return;
+  cache = now;
+  cache_valid = true;
+  saveCache();
+  Serial.println(F("[WiFi] Cache de conexion actualizado."));
+}
+
+WifiConnectPath wifi_cache_path() { return path; }
+
+uint32_t wifi_cache_time_to_ip_ms() { return ip_ms; }
+
+// ==========================================================
+// COMANDO
+// ==========================================================
+
+static const char* pathName(WifiConnectPath p) {
+  switch (p) {
+    case WIFI_PATH_FULL:     return "completo";
+    case WIFI_PATH_FAST:     return "rapido";
+    case WIFI_PATH_FALLBACK: return "rapido_fallido";
+    default:                 return "ninguno";
+  }
+}
+
+void handle_wifi_status_command(uint8_t clientNum, JsonDocument& doc) {
+  if (doc.containsKey("ip_fija")) {
+    static_ip = doc["ip_fija"] | false;
+    Preferences prefs;
+    prefs.begin(WIFI_NVS_NAMESPACE, false);
+    prefs.putBool(WIFI_NVS_STATIC, static_ip);
+    prefs.end();
+  }
+  if (doc["olvidar"] | false) {
+    Preferences prefs;
+    prefs.begin(WIFI_NVS_NAMESPACE, false);
+    prefs.remove(WIFI_NVS_KEY);
+    prefs.end();
+    cache_valid = false;
+  }
+
+  StaticJsonDocument<384> responseDoc;
+  responseDoc["status"] = "ok";
+  responseDoc["accion"] = "respuesta_estado_wifi";
+  responseDoc["camino"] = pathName(path);
+  if (ip_ms) responseDoc["ms_hasta_ip"] = ip_ms;
+  else responseDoc["ms_hasta_ip"] = nullptr;
+  responseDoc["rssi"] = WiFi.RSSI();
+  responseDoc["ip_fija"] = static_ip;
+  responseDoc["cache_valido"] = cache_valid;
+  if (cache_valid) {
+    char bssid[18];
+    snprintf(bssid, sizeof(bssid), "%02X:%02X:%02X:%02X:%02X:%02X",
+             cache.bssid[0], cache.bssid[1], cache.bssid[2],
+             cache.bssid[3], cache.bssid[4], cache.bssid[5]);
+    JsonObject c = responseDoc.createNestedObject("cache");
+    c["bssid"] = bssid;
+    c["canal"] = cache.channel;
+    c["ip"] = IPAddress(cache.ip).toString();
+    c["gateway"] = IPAddress(cache.gateway).toString();
+  }
+  String output; serializeJson(responseDoc, output);
+  enviarRespuesta(clientNum, output);
+}
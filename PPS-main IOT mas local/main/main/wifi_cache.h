@@ -0,0 +1,58 @@
+#ifndef WIFI_CACHE_H
+#define WIFI_CACHE_H
+
+#include <Arduino.h>
+#include <ArduinoJson.h>
+
+// ==========================================================
+// RECONEXIÓN WIFI RÁPIDA (BSSID / CANAL / IP EN NVS)
+// ==========================================================
+// Tras la primera conexión exitosa se guardan en NVS el BSSID, el canal y
+// el lease obtenido (IP, gateway, máscara, DNS). En el siguiente arranque
+// WiFi.begin() recibe canal y BSSID y se salta el barrido de todos los
+// canales; con "ip_fija" activada además se reutiliza el lease como IP
+// estática y no se espera al DHCP.
+// Si el camino rápido no da IP en WIFI_FAST_TIMEOUT_MS se relanza la
+// asociación completa (barrido + DHCP) y el caché se reescribe al conectar.
+// El caché queda atado a las credenciales: si cambian, se ignora.
+
+enum WifiConnectPath : uint8_t {
+  WIFI_PATH_NONE,       // Sin credenciales
+  WIFI_PATH_FULL,       // Barrido completo (sin caché válido)
+  WIFI_PATH_FAST,       // Canal + BSSID del caché
+  WIFI_PATH_FALLBACK    // El camino rápido falló y se barrió
+};
+
+/**
+ * @brief Lanza la asociación: rápida si hay caché válido, completa si no.
+ * No bloquea; la pila WiFi negocia en su propia tarea.
+ */
+void wifi_cache_begin(const String& ssid, const String& pass);
+
+/**
+ * @brief Pasa al barrido completo si el camino rápido no conectó a tiempo.
+ * Llamar mientras se espera la conexión.
+ */
+void wifi_cache_service();
+
+/**
+ * @brief Registra el tiempo hasta la IP y actualiza el caché si cambió
+ * algún parámetro (solo escribe en flash cuando hay diferencias).
+ */
+void wifi_cache_on_connected();
+
+WifiConnectPath wifi_cache_path();
+
+/**
+ * @brief Milisegundos desde WiFi.begin() hasta tener IP, o 0 si aún no hay.
+ */
+uint32_t wifi_cache_time_to_ip_ms();
+
+/**
+ * @brief Acción "estado_wifi": camino usado, tiempo hasta IP y caché.
+ * Acepta "ip_fija" (bool) para activar el lease estático y "olvidar"
+ * para borrar el caché (el próximo arranque barre).
+ */
+void handle_wifi_status_command(uint8_t clientNum, JsonDocument& doc);
+
+#endif // WIFI_CACHE_H
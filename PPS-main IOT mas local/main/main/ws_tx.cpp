@@ -0,0 +1,144 @@
+#include <WebSocketsServer.h>
+#include <lwip/sockets.h>
+#include "ws_tx.h"
+#include "config.h"
+#include "latency_metrics.h"
+
+extern WebSocketsServer webSocket;
+
+// La librería guarda los clientes como miembro protegido; un puntero a
+// miembro formado desde una clase derivada permite leerlos sin copiarla.
+struct WsClientAccess : WebSocketsServer {
+  static WEBSOCKETS_NETWORK_CLASS* tcp(WebSocketsServer& server, uint8_t num) {
+    WSclient_t (WebSocketsServerCore::*clients)[WEBSOCKETS_SERVER_CLIENT_MAX] = &WsClientAccess::_clients;
+    return (server.*clients)[num].tcp;
+  }
+};
+
+// sendTXT() escribe en el socket de forma síncrona: con la ventana TCP del
+// cliente llena se queda reintentando dentro de loop(). Se consulta antes
+// con select() sin espera y el cliente que no acepta datos se salta.
+static bool clientWritable(uint8_t num) {
+  if (num >= WEBSOCKETS_SERVER_CLIENT_MAX) return false;
+  WEBSOCKETS_NETWORK_CLASS* tcp = WsClientAccess::tcp(webSocket, num);
+  if (!tcp) return false;
+  int fd = tcp->fd();
+  if (fd < 0) return false;
+  fd_set wfds;
+  FD_ZERO(&wfds);
+  FD_SET(fd, &wfds);
+  struct timeval tv = {0, 0};
+  return select(fd + 1, nullptr, &wfds, nullptr, &tv) > 0;
+}
+
+static_assert(WS_TX_SLOTS >= WEBSOCKETS_SERVER_CLIENT_MAX, "WS_TX_SLOTS debe cubrir todos los clientes de la libreria");
+
+// Anillo de tamaño fijo; los String se reutilizan entre mensajes
+template <uint8_t N>
+struct MsgRing {
+  String msgs[N];
+  uint8_t head = 0;
+  uint8_t count = 0;
+
+  bool full() const { return count == N; }
+  void push(const String& m) { msgs[(head + count) % N] = m; count++; }
+  String& front() { return msgs[head]; }
+  void pop() { msgs[head] = String(); head = (head + 1) % N; count--; }
+  void clear() { while (count) pop(); head = 0; }
+};
+
+struct ClientQueue {
+  MsgRing<WS_ACK_QUEUE_DEPTH> acks;
+  MsgRing<WS_STATE_QUEUE_DEPTH> states;
+  WsClientStats stats;
+};
+
+static ClientQueue queues[WS_TX_SLOTS];
+static uint8_t client_count = 0;
+
+bool ws_tx_client_connected(uint8_t num) {
+  if (num >= WS_TX_SLOTS) return false;
+  if (client_count >= WS_MAX_CLIENTS) return false;
+  ClientQueue& q = queues[num];
+  q.acks.clear();
+  q.states.clear();
+  q.stats = WsClientStats();
+  q.stats.connected = true;
+  client_count++;
+  return true;
+}
+
+void ws_tx_client_disconnected(uint8_t num) {
+  if (num >= WS_TX_SLOTS || !queues[num].stats.connected) return;
+  ClientQueue& q = queues[num];
+  q.acks.clear();
+  q.states.clear();
+  q.stats.connected = false;
+  q.stats.ack_depth = q.stats.state_depth = 0;
+  client_count--;
+}
+
+void ws_tx_send(uint8_t num, const String& json, bool is_ack) {
+  if (num >= WS_TX_SLOTS || !queues[num].stats.connected) return;
+  ClientQueue& q = queues[num];
+
+  if (is_ack) {
+    if (q.acks.full()) {
+      // No lee sus respuestas: se lo desconecta en lugar de perder una
+      Serial.printf("[Cliente %u] Cola de respuestas llena, desconectando.\n", num);
+      q.stats.overflows++;
+      uint32_t overflows = q.stats.overflows;
+      ws_tx_client_disconnected(num);
+      q.stats.overflows = overflows;
+      webSocket.disconnect(num);
+      return;
+    }
+    q.acks.push(json);
+  } else {
+    if (q.states.full()) {
+      q.states.pop();
+      q.stats.state_dropped++;
+    }
+    q.states.push(json);
+  }
+
+  q.stats.ack_depth = q.acks.count;
+  q.stats.state_depth = q.states.count;
+  uint8_t depth = q.acks.count + q.states.count;
+  if (depth > q.stats.max_depth) q.stats.max_depth = depth;
+}
+
+void ws_tx_service() {
+  for (uint8_t num = 0; num < WS_TX_SLOTS; num++) {
+    ClientQueue& q = queues[num];
+    if (!q.stats.connected) continue;
+    for (uint8_t n = 0; n < WS_TX_PER_LOOP; n++) {
+      if (!q.acks.count && !q.states.count) break;
+      if (!clientWritable(num)) {
+        // Contrapresión real: los mensajes esperan en la cola y crecen con ella
+        q.stats.blocked++;
+        break;
+      }
+      uint32_t t0 = metrics_cycles();
+      if (q.acks.count) {
+        webSocket.sendTXT(num, q.acks.front());
+        q.acks.pop();
+      } else {
+        webSocket.sendTXT(num, q.states.front());
+        q.states.pop();
+      }
+      metrics_record(METRIC_SEND, metrics_cycles() - t0);   // Fuera de un comando: "fondo"
+      q.stats.sent++;
+    }
+    q.stats.ack_depth = q.acks.count;
+    q.stats.state_depth = q.states.count;
+  }
+}
+
+const WsClientStats& ws_tx_stats(uint8_t num) {
+  return queues[num < WS_TX_SLOTS ? num : 0].stats;
+}
+
+uint8_t ws_tx_client_count() {
+  return client_count;
+}
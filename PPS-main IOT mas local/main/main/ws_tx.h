@@ -0,0 +1,57 @@
+#ifndef WS_TX_H
+#define WS_TX_H
+
+#include <Arduino.h>
+
+// ==========================================================
+// COLAS DE SALIDA POR CLIENTE WEBSOCKET
+// ==========================================================
+// Los handlers no escriben en el socket: encolan y ws_tx_service() envía
+// desde loop() un máximo de WS_TX_PER_LOOP mensajes por cliente y vuelta,
+// así un navegador lento no frena el procesamiento de los demás. Solo se
+// envía a un cliente cuyo socket acepta datos (select() sin espera); si su
+// ventana TCP está llena los mensajes quedan en su cola hasta la próxima vuelta.
+//
+// Dos clases de mensaje por cliente:
+//   - Respuestas a comandos: nunca se descartan. Si su cola se llena el
+//     cliente no está leyendo y se lo desconecta.
+//   - Estado (progreso, actualizaciones): solo importa el último; con la
+//     cola llena se descarta el más viejo.
+// Las respuestas salen antes que el estado.
+//
+// WEBSOCKETS_SERVER_CLIENT_MAX lo fija la librería al compilarse; el límite
+// configurable es WS_MAX_CLIENTS (config.h): los clientes de más se rechazan.
+
+#define WS_TX_SLOTS  8   // Clientes que se siguen (>= WEBSOCKETS_SERVER_CLIENT_MAX)
+
+struct WsClientStats {
+  bool connected;
+  uint8_t ack_depth;       // Respuestas en cola
+  uint8_t state_depth;     // Mensajes de estado en cola
+  uint8_t max_depth;       // Máxima profundidad total observada
+  uint32_t sent;
+  uint32_t state_dropped;  // Estados viejos reemplazados
+  uint32_t overflows;      // Desconexiones por cola de respuestas llena
+  uint32_t blocked;        // Vueltas en que el socket no aceptaba datos
+};
+
+/**
+ * @brief Registra un cliente nuevo. @return false si se superó WS_MAX_CLIENTS.
+ */
+bool ws_tx_client_connected(uint8_t num);
+void ws_tx_client_disconnected(uint8_t num);
+
+/**
+ * @brief Encola un mensaje. @param is_ack true para respuestas a comandos.
+ */
+void ws_tx_send(uint8_t num, const String& json, bool is_ack);
+
+/**
+ * @brief Vacía las colas de a poco. Llamar en cada loop().
+ */
+void ws_tx_service();
+
+const WsClientStats& ws_tx_stats(uint8_t num);
+uint8_t ws_tx_client_count();
+
+#endif // WS_TX_H